@@ -0,0 +1,480 @@
+// SPDX-License-Identifier: Apache-2.0
+
+// Calibrates every surface listed in a manifest: load -> SVI -> Heston calibration
+// -> Heston repricing -> write. Each step is a pipeline stage with its own workers
+// and a bounded queue in front of it, so loading and writing overlap with
+// calibration of other surfaces. Finishes with a throughput, per-stage latency and
+// stage utilization summary.
+
+#include "Base/Macros/Inform.hpp"
+#include "Base/Macros/Require.hpp"
+#include "Base/Macros/Unreachable.hpp"
+#include <UnifiedVol.hpp>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+using namespace uv;
+
+namespace
+{
+enum class Format
+{
+    CSV,
+    Binary
+};
+
+enum Stage : std::size_t
+{
+    Load,
+    SVI,
+    HestonCalibrate,
+    HestonReprice,
+    Write,
+    numStages
+};
+
+constexpr std::array<std::string_view, numStages> stageNames{
+    "load",
+    "svi",
+    "heston",
+    "reprice",
+    "write"
+};
+
+struct Options
+{
+    std::filesystem::path manifest;
+    std::filesystem::path outDir{"results"};
+    Format format{Format::CSV};
+    int workers{-1};
+    // Zero entries are filled in from the thread budget.
+    std::array<std::size_t, numStages> stageWorkers{};
+    std::size_t queueCapacity{4};
+};
+
+struct Job
+{
+    io::csv::ManifestEntry entry;
+    std::optional<core::MarketState<double>> marketState;
+    std::optional<core::VolSurface<double>> sviSurface;
+    std::optional<core::VolSurface<double>> hestonSurface;
+    models::heston::Params<double> params{0.0, 0.0, 0.0, 0.0, 0.0};
+    std::array<double, numStages> ms{};
+};
+
+struct Outcome
+{
+    bool ok{false};
+    std::string error;
+    std::array<double, numStages> ms{};
+    models::heston::Params<double> params{0.0, 0.0, 0.0, 0.0, 0.0};
+};
+
+using Pricer =
+    models::heston::price::Pricer<double, models::heston::calibrate::defaultNodes>;
+
+[[noreturn]] void usage(int status)
+{
+    std::cerr << "Usage: unifiedvol_batch <manifest.csv> [--workers N] [--out DIR]"
+                 " [--format csv|binary] [--stage-workers L,S,H,R,W]"
+                 " [--queue-capacity N]\n";
+    std::exit(status);
+}
+
+template <typename N> bool parseNumber(std::string_view text, N& value)
+{
+    const auto [end, ec] =
+        std::from_chars(text.data(), text.data() + text.size(), value);
+    return ec == std::errc{} && end == text.data() + text.size();
+}
+
+bool parseStageWorkers(std::string_view text, std::array<std::size_t, numStages>& out)
+{
+    for (std::size_t s{0}; s < numStages; ++s)
+    {
+        const auto comma{text.find(',')};
+        const bool last{s + 1 == numStages};
+
+        if (last != (comma == std::string_view::npos))
+            return false;
+        if (!parseNumber(text.substr(0, comma), out[s]) || out[s] == 0)
+            return false;
+
+        if (!last)
+            text.remove_prefix(comma + 1);
+    }
+
+    return true;
+}
+
+Options parseArgs(int argc, char* argv[])
+{
+    Options opt{};
+
+    for (int i{1}; i < argc; ++i)
+    {
+        const std::string_view arg{argv[i]};
+
+        if (arg == "-h" || arg == "--help")
+            usage(EXIT_SUCCESS);
+
+        if (!arg.starts_with("--"))
+        {
+            if (!opt.manifest.empty())
+                usage(EXIT_FAILURE);
+            opt.manifest = arg;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+            usage(EXIT_FAILURE);
+        const std::string_view value{argv[++i]};
+
+        if (arg == "--workers")
+        {
+            if (!parseNumber(value, opt.workers))
+                usage(EXIT_FAILURE);
+        }
+        else if (arg == "--stage-workers")
+        {
+            if (!parseStageWorkers(value, opt.stageWorkers))
+                usage(EXIT_FAILURE);
+        }
+        else if (arg == "--queue-capacity")
+        {
+            if (!parseNumber(value, opt.queueCapacity) || opt.queueCapacity == 0)
+                usage(EXIT_FAILURE);
+        }
+        else if (arg == "--out")
+            opt.outDir = value;
+        else if (arg == "--format" && (value == "csv" || value == "binary"))
+            opt.format = value == "csv" ? Format::CSV : Format::Binary;
+        else
+            usage(EXIT_FAILURE);
+    }
+
+    if (opt.manifest.empty())
+        usage(EXIT_FAILURE);
+
+    return opt;
+}
+
+void writeSurface(
+    const std::filesystem::path& path,
+    const core::VolSurface<double>& surface,
+    Format format
+)
+{
+    switch (format)
+    {
+    case Format::CSV:
+        io::csv::write::volSurface(path, surface);
+        return;
+    case Format::Binary:
+        io::binary::write(path, surface);
+        return;
+    }
+
+    UNREACHABLE(Format, format);
+}
+
+// Every stage but Heston calibration gets one worker; calibration dominates the
+// runtime and takes the rest of the thread budget.
+std::array<std::size_t, numStages> defaultStageWorkers(int budget)
+{
+    std::array<std::size_t, numStages> workers{};
+    workers.fill(1);
+
+    const int others{static_cast<int>(numStages) - 1};
+    workers[HestonCalibrate] = static_cast<std::size_t>(std::max(budget - others, 1));
+    return workers;
+}
+
+execution::Pipeline<Job> makePipeline(const Options& opt)
+{
+    const std::string_view ext{opt.format == Format::CSV ? "csv" : "uvs"};
+
+    std::array<execution::Pipeline<Job>::Stage, numStages> fns{
+        [](Job& job)
+        {
+            job.marketState =
+                io::csv::load::marketState(job.entry.file, job.entry.marketData);
+        },
+        [](Job& job) { job.sviSurface = models::svi::buildSurface(*job.marketState); },
+        [](Job& job)
+        {
+            Pricer pricer{};
+            job.params = models::heston::calibrate::calibrate(
+                *job.sviSurface,
+                job.marketState->interestCurve,
+                models::heston::calibrate::Config{},
+                pricer
+            );
+        },
+        [](Job& job)
+        {
+            Pricer pricer{};
+            pricer.setParams(job.params);
+            job.hestonSurface =
+                models::heston::buildSurface(*job.sviSurface, *job.marketState, pricer);
+        },
+        [outDir = opt.outDir, ext, format = opt.format](Job& job)
+        {
+            writeSurface(
+                outDir / std::format("{}_svi.{}", job.entry.name, ext),
+                *job.sviSurface,
+                format
+            );
+            writeSurface(
+                outDir / std::format("{}_heston.{}", job.entry.name, ext),
+                *job.hestonSurface,
+                format
+            );
+
+            // Release the surfaces as soon as they are on disk.
+            job.marketState.reset();
+            job.sviSurface.reset();
+            job.hestonSurface.reset();
+        }
+    };
+
+    execution::Pipeline<Job> pipeline;
+    for (std::size_t s{0}; s < numStages; ++s)
+    {
+        pipeline.addStage(
+            std::string{stageNames[s]},
+            [s, fn = std::move(fns[s])](Job& job)
+            {
+                const auto start{std::chrono::steady_clock::now()};
+                fn(job);
+                job.ms[s] = std::chrono::duration<double, std::milli>(
+                                std::chrono::steady_clock::now() - start
+                )
+                                .count();
+            },
+            opt.stageWorkers[s],
+            opt.queueCapacity
+        );
+    }
+
+    return pipeline;
+}
+
+Outcome toOutcome(const execution::PipelineResult<Job>& result)
+{
+    Outcome outcome{.ms = result.item.ms, .params = result.item.params};
+
+    if (!result.error)
+    {
+        outcome.ok = true;
+        return outcome;
+    }
+
+    try
+    {
+        std::rethrow_exception(result.error);
+    }
+    catch (const std::exception& e)
+    {
+        outcome.error = std::format("{}: {}", stageNames[result.failedStage], e.what());
+    }
+    catch (...)
+    {
+        outcome.error = std::format("{}: unknown error", stageNames[result.failedStage]);
+    }
+
+    return outcome;
+}
+
+double percentile(Vector<double> values, double q)
+{
+    if (values.empty())
+        return 0.0;
+
+    // Nearest-rank percentile.
+    std::sort(values.begin(), values.end());
+    const double n{static_cast<double>(values.size())};
+    const auto rank{static_cast<std::size_t>(std::ceil(q * n))};
+    return values[std::clamp<std::size_t>(rank, 1, values.size()) - 1];
+}
+
+void writeResults(
+    const std::filesystem::path& path,
+    std::span<const io::csv::ManifestEntry> entries,
+    std::span<const Outcome> outcomes
+)
+{
+    std::ofstream file{path};
+    REQUIRE_FILE_OPENED(file.is_open(), path.string());
+
+    file << "name,status";
+    for (const auto name : stageNames)
+        file << ',' << name << "Ms";
+    file << ",kappa,theta,sigma,rho,v0,error\n";
+
+    for (std::size_t i{0}; i < entries.size(); ++i)
+    {
+        const Outcome& o{outcomes[i]};
+        file << entries[i].name << ',' << (o.ok ? "ok" : "failed");
+
+        for (const double ms : o.ms)
+            file << std::format(",{:.3f}", ms);
+
+        if (o.ok)
+        {
+            file << std::format(
+                ",{},{},{},{},{},",
+                o.params.kappa,
+                o.params.theta,
+                o.params.sigma,
+                o.params.rho,
+                o.params.v0
+            );
+        }
+        else
+        {
+            std::string error{o.error};
+            std::replace(error.begin(), error.end(), ',', ';');
+            std::replace(error.begin(), error.end(), '\n', ' ');
+            file << ",,,,,," << error;
+        }
+        file << '\n';
+    }
+}
+
+std::string summarize(
+    std::span<const Outcome> outcomes,
+    const execution::PipelineStats& stats
+)
+{
+    const double wallSeconds{stats.wallMs / 1'000.0};
+    std::size_t succeeded{0};
+    std::array<Vector<double>, numStages> stageMs;
+
+    for (const Outcome& o : outcomes)
+    {
+        if (!o.ok)
+            continue;
+
+        ++succeeded;
+        for (std::size_t s{0}; s < numStages; ++s)
+            stageMs[s].push_back(o.ms[s]);
+    }
+
+    std::string text{std::format(
+        "Processed {} surfaces in {:.3f} s: {} ok, {} failed, {:.2f} surfaces/s\n",
+        outcomes.size(),
+        wallSeconds,
+        succeeded,
+        outcomes.size() - succeeded,
+        wallSeconds > 0.0 ? static_cast<double>(succeeded) / wallSeconds : 0.0
+    )};
+
+    // Utilization is the fraction of the stage's worker time spent working;
+    // starved and blocked are the fractions spent waiting on the previous stage
+    // and on a full queue to the next one. The bottleneck is the stage with high
+    // utilization whose predecessors are blocked.
+    text += std::format(
+        "{:<10}{:>9}{:>12}{:>12}{:>8}{:>9}{:>9}\n",
+        "stage",
+        "workers",
+        "p50 ms",
+        "p99 ms",
+        "util",
+        "starved",
+        "blocked"
+    );
+    for (std::size_t s{0}; s < numStages; ++s)
+    {
+        const execution::StageStats& stage{stats.stages[s]};
+        const double capacityMs{static_cast<double>(stage.workers) * stats.wallMs};
+        const auto share = [&](double ms)
+        { return capacityMs > 0.0 ? 100.0 * ms / capacityMs : 0.0; };
+
+        text += std::format(
+            "{:<10}{:>9}{:>12.3f}{:>12.3f}{:>7.1f}%{:>8.1f}%{:>8.1f}%\n",
+            stageNames[s],
+            stage.workers,
+            percentile(stageMs[s], 0.50),
+            percentile(stageMs[s], 0.99),
+            share(stage.busyMs),
+            share(stage.starvedMs),
+            share(stage.blockedMs)
+        );
+    }
+
+    return text;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        Options opt{parseArgs(argc, argv)};
+
+        initialize(Config{.logToFile = false, .numThreads = opt.workers});
+
+        if (opt.stageWorkers[Load] == 0)
+            opt.stageWorkers = defaultStageWorkers(execution::requestThreads(-1));
+
+        const Vector<io::csv::ManifestEntry> entries{io::csv::readManifest(opt.manifest)};
+        std::filesystem::create_directories(opt.outDir);
+
+        Vector<Job> jobs;
+        jobs.reserve(entries.size());
+        for (const auto& entry : entries)
+            jobs.push_back(Job{.entry = entry});
+
+        execution::Pipeline<Job> pipeline{makePipeline(opt)};
+        const auto results{pipeline.run(std::move(jobs))};
+
+        Vector<Outcome> outcomes;
+        outcomes.reserve(results.size());
+        for (const auto& result : results)
+            outcomes.push_back(toOutcome(result));
+
+        writeResults(opt.outDir / "results.csv", entries, outcomes);
+
+        INFO("\n" + summarize(outcomes, pipeline.stats()));
+
+        for (std::size_t i{0}; i < entries.size(); ++i)
+        {
+            if (!outcomes[i].ok)
+                INFO(std::format("FAILED {}: {}", entries[i].name, outcomes[i].error));
+        }
+
+        const bool allOk{std::all_of(
+            outcomes.begin(),
+            outcomes.end(),
+            [](const Outcome& o) { return o.ok; }
+        )};
+
+        return allOk ? EXIT_SUCCESS : 3;
+    }
+    catch (const errors::UnifiedVolError& e)
+    {
+        std::cerr << e.what() << '\n';
+        return 2;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "std::exception: " << e.what() << '\n';
+        return 1;
+    }
+}
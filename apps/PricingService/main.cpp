@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: Apache-2.0
+
+// Calibrates every surface in a batch manifest, then serves price, implied vol and
+// greek requests for them over a local Unix-domain socket until interrupted. Latency
+// percentiles are reported on exit.
+
+#include "Base/Macros/Inform.hpp"
+#include <UnifiedVol.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+
+using namespace uv;
+
+namespace
+{
+struct Options
+{
+    std::filesystem::path manifest;
+    std::filesystem::path socket{"/tmp/unifiedvol.sock"};
+    std::size_t maxBatch{256};
+    long batchWindowUs{100};
+};
+
+std::atomic<bool> interrupted{false};
+
+extern "C" void onSignal(int)
+{
+    interrupted.store(true);
+}
+
+[[noreturn]] void usage(int status)
+{
+    std::cerr << "Usage: unifiedvol_pricing_service <manifest.csv> [--socket PATH]"
+                 " [--max-batch N] [--batch-window-us N]\n";
+    std::exit(status);
+}
+
+Options parseArgs(int argc, char* argv[])
+{
+    Options opt{};
+    bool haveManifest{false};
+
+    for (int i{1}; i < argc; ++i)
+    {
+        const std::string_view arg{argv[i]};
+
+        if (arg == "-h" || arg == "--help")
+            usage(EXIT_SUCCESS);
+
+        if (arg == "--socket" && i + 1 < argc)
+            opt.socket = argv[++i];
+        else if (arg == "--max-batch" && i + 1 < argc)
+            opt.maxBatch = static_cast<std::size_t>(std::stoul(argv[++i]));
+        else if (arg == "--batch-window-us" && i + 1 < argc)
+            opt.batchWindowUs = std::stol(argv[++i]);
+        else if (arg.starts_with("--") || haveManifest)
+            usage(EXIT_FAILURE);
+        else
+        {
+            opt.manifest = arg;
+            haveManifest = true;
+        }
+    }
+
+    if (!haveManifest)
+        usage(EXIT_FAILURE);
+
+    return opt;
+}
+
+Vector<service::CalibratedSurface> calibrateAll(const std::filesystem::path& manifest)
+{
+    Vector<service::CalibratedSurface> surfaces;
+
+    for (const io::csv::ManifestEntry& entry : io::csv::readManifest(manifest))
+    {
+        const models::intraday::Engine<double> engine{
+            io::csv::load::marketState(entry.file, entry.marketData)
+        };
+
+        surfaces.push_back(
+            {.name = entry.name,
+             .marketData = entry.marketData,
+             .sviParams = engine.sviParams(),
+             .hestonParams = engine.hestonParams()}
+        );
+
+        INFO(std::format("Calibrated {}", entry.name));
+    }
+
+    return surfaces;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        const Options opt{parseArgs(argc, argv)};
+
+        initialize(Config{.logToFile = false});
+
+        service::BatchPricer pricer{calibrateAll(opt.manifest)};
+        const std::size_t numSurfaces{pricer.numSurfaces()};
+
+        service::Server server{
+            std::move(pricer),
+            service::Config{
+                .socketPath = opt.socket,
+                .maxBatch = opt.maxBatch,
+                .batchWindow = std::chrono::microseconds{opt.batchWindowUs}
+            }
+        };
+
+#if defined(SIGPIPE)
+        std::signal(SIGPIPE, SIG_IGN);
+#endif
+        std::signal(SIGINT, onSignal);
+        std::signal(SIGTERM, onSignal);
+
+        server.start();
+        INFO(std::format(
+            "Serving {} surfaces on {}",
+            numSurfaces,
+            server.socketPath().string()
+        ));
+
+        while (!interrupted.load())
+            std::this_thread::sleep_for(std::chrono::milliseconds{100});
+
+        server.stop();
+
+        const service::LatencySummary s{server.latency()};
+        INFO(std::format(
+            "Served {} requests in {} batches with {} pricing calls: p50 {:.1f} us, "
+            "p90 {:.1f} us, p99 {:.1f} us, max {:.1f} us",
+            s.requests,
+            s.batches,
+            s.pricingCalls,
+            s.p50Us,
+            s.p90Us,
+            s.p99Us,
+            s.maxUs
+        ));
+
+        return EXIT_SUCCESS;
+    }
+    catch (const errors::UnifiedVolError& e)
+    {
+        std::cerr << e.what() << '\n';
+        return 2;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "std::exception: " << e.what() << '\n';
+        return 1;
+    }
+}
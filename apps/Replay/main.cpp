@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: Apache-2.0
+
+// Replays a recorded tick file against one surface from a batch manifest: the
+// surface is calibrated once, then every update is applied incrementally and its
+// recalibration latency is reported.
+
+#include "Base/Macros/Inform.hpp"
+#include <UnifiedVol.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+using namespace uv;
+
+namespace
+{
+struct Options
+{
+    std::filesystem::path manifest;
+    std::filesystem::path ticks;
+    std::string name;
+    bool heston{true};
+};
+
+[[noreturn]] void usage(int status)
+{
+    std::cerr << "Usage: unifiedvol_replay <manifest.csv> <ticks.csv> [--name NAME]"
+                 " [--no-heston]\n";
+    std::exit(status);
+}
+
+Options parseArgs(int argc, char* argv[])
+{
+    Options opt{};
+    std::size_t positional{0};
+
+    for (int i{1}; i < argc; ++i)
+    {
+        const std::string_view arg{argv[i]};
+
+        if (arg == "-h" || arg == "--help")
+            usage(EXIT_SUCCESS);
+
+        if (arg == "--no-heston")
+            opt.heston = false;
+        else if (arg == "--name" && i + 1 < argc)
+            opt.name = argv[++i];
+        else if (arg.starts_with("--"))
+            usage(EXIT_FAILURE);
+        else if (positional == 0)
+        {
+            opt.manifest = arg;
+            ++positional;
+        }
+        else if (positional == 1)
+        {
+            opt.ticks = arg;
+            ++positional;
+        }
+        else
+            usage(EXIT_FAILURE);
+    }
+
+    if (positional != 2)
+        usage(EXIT_FAILURE);
+
+    return opt;
+}
+
+const io::csv::ManifestEntry&
+findEntry(const Vector<io::csv::ManifestEntry>& entries, std::string_view name)
+{
+    if (name.empty())
+        return entries.front();
+
+    const auto it{std::find_if(
+        entries.begin(),
+        entries.end(),
+        [&](const io::csv::ManifestEntry& e) { return e.name == name; }
+    )};
+
+    if (it == entries.end())
+    {
+        errors::raise(
+            errors::ErrorCode::InvalidArgument,
+            std::format("No manifest entry named '{}'", name)
+        );
+    }
+
+    return *it;
+}
+
+double percentile(Vector<double> values, double q)
+{
+    if (values.empty())
+        return 0.0;
+
+    // Nearest-rank percentile.
+    std::sort(values.begin(), values.end());
+    const double n{static_cast<double>(values.size())};
+    const auto rank{static_cast<std::size_t>(std::ceil(q * n))};
+    return values[std::clamp<std::size_t>(rank, 1, values.size()) - 1];
+}
+
+std::string describeSlices(const Vector<std::size_t>& slices)
+{
+    std::string text;
+
+    for (const std::size_t i : slices)
+        text += (text.empty() ? "" : " ") + std::to_string(i);
+
+    return text.empty() ? std::string{"-"} : text;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        const Options opt{parseArgs(argc, argv)};
+
+        initialize(Config{.logToFile = false});
+
+        const Vector<io::csv::ManifestEntry> entries{io::csv::readManifest(opt.manifest)};
+        const io::csv::ManifestEntry& entry{findEntry(entries, opt.name)};
+        const Vector<core::QuoteUpdate<double>> ticks{io::csv::readTicks(opt.ticks)};
+
+        models::intraday::Engine<double> engine{
+            io::csv::load::marketState(entry.file, entry.marketData),
+            models::intraday::Config{.recalibrateHeston = opt.heston}
+        };
+
+        const Vector<models::intraday::UpdateStats> updates{
+            models::intraday::replay(engine, std::span{ticks})
+        };
+
+        std::string text{std::format(
+            "{:>6}{:>8}{:>12}{:>10}{:>11}{:>10}  {}\n",
+            "seq",
+            "quotes",
+            "svi ms",
+            "heston ms",
+            "total ms",
+            "heston",
+            "refit slices"
+        )};
+
+        Vector<double> totalMs;
+        totalMs.reserve(updates.size());
+
+        for (const auto& u : updates)
+        {
+            totalMs.push_back(u.totalMs);
+            text += std::format(
+                "{:>6}{:>8}{:>12.3f}{:>10.3f}{:>11.3f}{:>10}  {}\n",
+                u.seq,
+                u.quotes,
+                u.sviMs,
+                u.hestonMs,
+                u.totalMs,
+                opt::toString(u.hestonTermination),
+                describeSlices(u.refitSlices)
+            );
+        }
+
+        text += std::format(
+            "Replayed {} updates for {}: p50 {:.3f} ms, p99 {:.3f} ms, max {:.3f} ms\n",
+            updates.size(),
+            entry.name,
+            percentile(totalMs, 0.50),
+            percentile(totalMs, 0.99),
+            percentile(totalMs, 1.00)
+        );
+
+        const auto& p{engine.hestonParams()};
+        text += std::format(
+            "Heston: kappa={:.6f}, theta={:.6f}, sigma={:.6f}, rho={:.6f}, v0={:.6f}\n",
+            p.kappa,
+            p.theta,
+            p.sigma,
+            p.rho,
+            p.v0
+        );
+
+        INFO("\n" + text);
+
+        return EXIT_SUCCESS;
+    }
+    catch (const errors::UnifiedVolError& e)
+    {
+        std::cerr << e.what() << '\n';
+        return 2;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "std::exception: " << e.what() << '\n';
+        return 1;
+    }
+}
@@ -51,6 +51,12 @@ int main(int argc, char* argv[])
 
         io::report::volatility(hestonVolSurface);
 
+        if constexpr (utils::Profiler::enabled())
+        {
+            INFO("\n" + utils::Profiler::instance().summaryTable());
+            utils::Profiler::instance().writeChromeTrace("profile.json");
+        }
+
         return 0;
 
         return EXIT_SUCCESS;
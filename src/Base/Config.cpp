@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Base/Config.hpp"
+#include "Base/Execution/Affinity.hpp"
+#include "Base/Execution/Executor.hpp"
 #include "Base/Utils/Detail/Log.hpp"
 
 namespace uv
@@ -12,16 +14,39 @@ void applyLogConfig(const Config& cfg)
     utils::Log& log = utils::Log::instance();
 
     log.enableConsole(cfg.logToConsole);
+    log.setFlushInterval(cfg.logFlushInterval);
+    log.setOverflow(cfg.logOverflow);
 
     if (cfg.logToFile)
     {
         log.setFile(cfg.logFile);
     }
 }
+
+// Pinning uses the configured cpulist, or the process affinity mask (which
+// reflects cgroup cpusets) when none is given.
+void applyExecutionConfig(const Config& cfg)
+{
+    execution::Executor& executor{execution::Executor::instance()};
+
+    if (!cfg.pinThreads)
+    {
+        executor.configure(cfg.numThreads);
+        return;
+    }
+
+    const Vector<int> cpus{
+        cfg.cpuList.empty() ? execution::allowedCpus()
+                            : execution::parseCpuList(cfg.cpuList)
+    };
+
+    executor.configure(cfg.numThreads, cpus);
+}
 } // namespace detail
 
 void initialize(const Config& cfg)
 {
     detail::applyLogConfig(cfg);
+    detail::applyExecutionConfig(cfg);
 }
 } // namespace uv
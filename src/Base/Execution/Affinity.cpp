@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Execution/Affinity.hpp"
+#include "Base/Errors/Errors.hpp"
+#include "Base/Execution/ThreadPolicy.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <string>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace uv::execution
+{
+namespace detail
+{
+int parseCpu(std::string_view token, std::string_view list)
+{
+    const char* last{token.data() + token.size()};
+    int cpu{-1};
+    const auto [end, ec] = std::from_chars(token.data(), last, cpu);
+
+    if (ec != std::errc{} || end != last || cpu < 0)
+    {
+        errors::raise(
+            errors::ErrorCode::InvalidArgument,
+            std::format("Invalid CPU list '{}'", list)
+        );
+    }
+
+    return cpu;
+}
+} // namespace detail
+
+Vector<int> parseCpuList(std::string_view list)
+{
+    Vector<int> cpus;
+
+    while (!list.empty() && (list.back() == '\n' || list.back() == ' '))
+        list.remove_suffix(1);
+
+    std::string_view rest{list};
+
+    while (!rest.empty())
+    {
+        const std::size_t comma{rest.find(',')};
+        const std::string_view range{rest.substr(0, comma)};
+        const std::size_t dash{range.find('-')};
+
+        const int first{detail::parseCpu(range.substr(0, dash), list)};
+        const int last{
+            (dash == std::string_view::npos)
+                ? first
+                : detail::parseCpu(range.substr(dash + 1), list)
+        };
+
+        if (last < first)
+        {
+            errors::raise(
+                errors::ErrorCode::InvalidArgument,
+                std::format("Invalid CPU list '{}'", list)
+            );
+        }
+
+        for (int cpu{first}; cpu <= last; ++cpu)
+            cpus.push_back(cpu);
+
+        rest = (comma == std::string_view::npos) ? std::string_view{}
+                                                 : rest.substr(comma + 1);
+    }
+
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+
+    return cpus;
+}
+
+Vector<int> allowedCpus()
+{
+    Vector<int> cpus;
+
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+
+    if (sched_getaffinity(0, sizeof(set), &set) == 0)
+    {
+        for (int cpu{0}; cpu < CPU_SETSIZE; ++cpu)
+        {
+            if (CPU_ISSET(cpu, &set))
+                cpus.push_back(cpu);
+        }
+    }
+#endif
+
+    if (cpus.empty())
+    {
+        for (int cpu{0}; cpu < detail::hardwareThreads(); ++cpu)
+            cpus.push_back(cpu);
+    }
+
+    return cpus;
+}
+
+int numaNode(int cpu)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path cpuDir{std::format("/sys/devices/system/cpu/cpu{}", cpu)};
+    std::error_code ec;
+
+    for (fs::directory_iterator it{cpuDir, ec}, end; !ec && it != end; it.increment(ec))
+    {
+        const std::string name{it->path().filename().string()};
+        int node{0};
+
+        if (name.starts_with("node") &&
+            std::from_chars(name.data() + 4, name.data() + name.size(), node).ec ==
+                std::errc{})
+        {
+            return node;
+        }
+    }
+
+    return 0;
+}
+
+Vector<CpuSlot> compactPlacement(std::span<const int> cpus)
+{
+    Vector<CpuSlot> slots;
+    slots.reserve(cpus.size());
+
+    for (const int cpu : cpus)
+        slots.push_back(CpuSlot{cpu, numaNode(cpu)});
+
+    std::stable_sort(
+        slots.begin(),
+        slots.end(),
+        [](const CpuSlot& a, const CpuSlot& b) { return a.node < b.node; }
+    );
+
+    return slots;
+}
+
+bool pinCurrentThread(int cpu) noexcept
+{
+#if defined(__linux__)
+    if (cpu < 0 || cpu >= CPU_SETSIZE)
+        return false;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    static_cast<void>(cpu);
+    return false;
+#endif
+}
+} // namespace uv::execution
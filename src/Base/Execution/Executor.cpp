@@ -0,0 +1,360 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Execution/Executor.hpp"
+#include "Base/Errors/Errors.hpp"
+#include "Base/Execution/ThreadPolicy.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <limits>
+
+namespace uv::execution
+{
+namespace detail
+{
+constexpr std::size_t notAWorker{std::numeric_limits<std::size_t>::max()};
+constexpr std::chrono::microseconds helpInterval{100};
+
+thread_local std::size_t workerIndex{notAWorker};
+thread_local int workerNode{-1};
+thread_local int taskDepth{0};
+
+bool samePlacement(std::span<const CpuSlot> a, std::span<const CpuSlot> b) noexcept
+{
+    return std::equal(
+        a.begin(),
+        a.end(),
+        b.begin(),
+        b.end(),
+        [](const CpuSlot& x, const CpuSlot& y) { return x.cpu == y.cpu; }
+    );
+}
+} // namespace detail
+
+Executor& Executor::instance()
+{
+    static Executor g;
+    return g;
+}
+
+Executor::Executor()
+{
+    const int numThreads{detail::hardwareThreads()};
+
+    concurrency_.store(numThreads, std::memory_order_relaxed);
+    start(static_cast<std::size_t>(numThreads - 1));
+}
+
+Executor::~Executor()
+{
+    stop();
+}
+
+void Executor::configure(int numThreads, std::span<const int> cpus)
+{
+    Vector<CpuSlot> placement;
+
+    if (!cpus.empty())
+    {
+        const Vector<int> allowed{allowedCpus()};
+
+        for (const int cpu : cpus)
+        {
+            if (!std::binary_search(allowed.begin(), allowed.end(), cpu))
+            {
+                errors::raise(
+                    errors::ErrorCode::InvalidArgument,
+                    std::format("CPU {} is not in the process affinity mask", cpu)
+                );
+            }
+        }
+
+        placement = compactPlacement(cpus);
+    }
+
+    const int numAvailable{
+        placement.empty() ? detail::hardwareThreads() : static_cast<int>(placement.size())
+    };
+    const int resolved{detail::resolveThreads(numThreads, numAvailable)};
+
+    std::lock_guard lock{configMutex_};
+
+    if (resolved == concurrency_.load(std::memory_order_relaxed) &&
+        detail::samePlacement(placement, placement_))
+    {
+        return;
+    }
+
+    stop();
+
+    concurrency_.store(resolved, std::memory_order_relaxed);
+    placement_ = std::move(placement);
+    start(static_cast<std::size_t>(resolved - 1));
+}
+
+int Executor::concurrency() const noexcept
+{
+    return concurrency_.load(std::memory_order_relaxed);
+}
+
+std::span<const CpuSlot> Executor::placement() const noexcept
+{
+    return placement_;
+}
+
+void Executor::submit(Task task)
+{
+    const std::size_t numQueues{queues_.size()};
+    const std::size_t index{
+        (detail::workerIndex < numQueues)
+            ? detail::workerIndex
+            : nextQueue_.fetch_add(1, std::memory_order_relaxed) % numQueues
+    };
+
+    {
+        Queue& queue{*queues_[index]};
+        std::lock_guard lock{queue.mutex};
+        queue.tasks.push_back(std::move(task));
+    }
+
+    {
+        std::lock_guard lock{sleepMutex_};
+        queued_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    wake_.notify_one();
+}
+
+bool Executor::runPending()
+{
+    Task task;
+
+    if (!tryPop(detail::workerIndex, task))
+        return false;
+
+    run(task);
+    return true;
+}
+
+bool Executor::insideTask() noexcept
+{
+    return detail::taskDepth > 0;
+}
+
+int Executor::currentNode() noexcept
+{
+    return detail::workerNode;
+}
+
+void Executor::start(std::size_t numWorkers)
+{
+    stopping_ = false;
+    queues_.clear();
+
+    const std::size_t numQueues{std::max<std::size_t>(numWorkers, 1)};
+
+    for (std::size_t i{0}; i < numQueues; ++i)
+        queues_.push_back(std::make_unique<Queue>());
+
+    // Victims on the thief's own node come first, then the rest in ring order.
+    const auto nodeOf = [this](std::size_t worker)
+    {
+        return placement_.empty() ? 0
+                                  : placement_[(worker + 1) % placement_.size()].node;
+    };
+
+    stealOrder_.assign(numQueues, {});
+
+    for (std::size_t i{0}; i < numQueues; ++i)
+    {
+        for (std::size_t k{1}; k < numQueues; ++k)
+            stealOrder_[i].push_back((i + k) % numQueues);
+
+        std::stable_partition(
+            stealOrder_[i].begin(),
+            stealOrder_[i].end(),
+            [&](std::size_t victim) { return nodeOf(victim) == nodeOf(i); }
+        );
+    }
+
+    workers_.reserve(numWorkers);
+
+    for (std::size_t i{0}; i < numWorkers; ++i)
+        workers_.emplace_back([this, i] { work(i); });
+}
+
+void Executor::stop()
+{
+    {
+        std::lock_guard lock{sleepMutex_};
+        stopping_ = true;
+    }
+
+    wake_.notify_all();
+    workers_.clear();
+
+    Task task;
+
+    while (tryPop(detail::notAWorker, task))
+        run(task);
+}
+
+void Executor::work(std::size_t index)
+{
+    detail::workerIndex = index;
+
+    if (!placement_.empty())
+    {
+        const CpuSlot& slot{placement_[(index + 1) % placement_.size()]};
+
+        if (pinCurrentThread(slot.cpu))
+            detail::workerNode = slot.node;
+    }
+
+    Task task;
+
+    while (true)
+    {
+        if (tryPop(index, task))
+        {
+            run(task);
+            continue;
+        }
+
+        std::unique_lock lock{sleepMutex_};
+
+        wake_.wait(
+            lock,
+            [this] { return stopping_ || queued_.load(std::memory_order_relaxed) > 0; }
+        );
+
+        if (stopping_ && queued_.load(std::memory_order_relaxed) <= 0)
+            return;
+    }
+}
+
+bool Executor::tryPop(std::size_t index, Task& task)
+{
+    if (index >= queues_.size())
+    {
+        for (const std::unique_ptr<Queue>& queue : queues_)
+        {
+            if (steal(*queue, task))
+                return true;
+        }
+
+        return false;
+    }
+
+    {
+        Queue& own{*queues_[index]};
+        std::lock_guard lock{own.mutex};
+
+        if (!own.tasks.empty())
+        {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            queued_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    for (const std::size_t victim : stealOrder_[index])
+    {
+        if (steal(*queues_[victim], task))
+            return true;
+    }
+
+    return false;
+}
+
+bool Executor::steal(Queue& victim, Task& task)
+{
+    std::lock_guard lock{victim.mutex};
+
+    if (victim.tasks.empty())
+        return false;
+
+    task = std::move(victim.tasks.front());
+    victim.tasks.pop_front();
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+void Executor::run(Task& task)
+{
+    const TaskScope scope;
+
+    task();
+    task = nullptr;
+}
+
+TaskScope::TaskScope() noexcept
+{
+    ++detail::taskDepth;
+}
+
+TaskScope::~TaskScope()
+{
+    --detail::taskDepth;
+}
+
+TaskGroup::TaskGroup()
+    : TaskGroup(Executor::instance())
+{
+}
+
+TaskGroup::TaskGroup(Executor& executor)
+    : executor_(executor)
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+    drain();
+}
+
+void TaskGroup::wait()
+{
+    drain();
+
+    std::exception_ptr failure;
+    std::swap(failure, failure_);
+
+    if (failure)
+        std::rethrow_exception(failure);
+}
+
+void TaskGroup::finish(std::exception_ptr failure) noexcept
+{
+    std::lock_guard lock{mutex_};
+
+    if (failure && !failure_)
+        failure_ = failure;
+
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        done_.notify_all();
+}
+
+void TaskGroup::drain() noexcept
+{
+    while (pending_.load(std::memory_order_acquire) != 0)
+    {
+        if (executor_.runPending())
+            continue;
+
+        std::unique_lock lock{mutex_};
+
+        done_.wait_for(
+            lock,
+            detail::helpInterval,
+            [this] { return pending_.load(std::memory_order_acquire) == 0; }
+        );
+    }
+
+    // Synchronises with the last finish() so that it has released the mutex
+    // before the group can be destroyed.
+    std::lock_guard lock{mutex_};
+}
+} // namespace uv::execution
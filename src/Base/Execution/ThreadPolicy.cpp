@@ -2,6 +2,7 @@
 
 #include "Base/Execution/ThreadPolicy.hpp"
 #include "Base/Errors/Errors.hpp"
+#include "Base/Execution/Executor.hpp"
 
 #include <algorithm>
 #include <format>
@@ -12,7 +13,7 @@ namespace uv::execution
 {
 namespace detail
 {
-int availableThreads() noexcept
+int hardwareThreads() noexcept
 {
     const unsigned int hw{std::thread::hardware_concurrency()};
     if (hw == 0u)
@@ -26,12 +27,9 @@ int availableThreads() noexcept
     )};
     return static_cast<int>(capped);
 }
-} // namespace detail
 
-int requestThreads(int numRequested)
+int resolveThreads(int numRequested, int numAvailable)
 {
-    const int numAvailable{detail::availableThreads()};
-
     if (numRequested < 0)
     {
         return std::clamp(numAvailable + numRequested + 1, 1, numAvailable);
@@ -47,5 +45,15 @@ int requestThreads(int numRequested)
         std::format("Cannot request {} number of threads", numRequested)
     );
 }
+} // namespace detail
+
+int requestThreads(int numRequested)
+{
+    const int numThreads{
+        detail::resolveThreads(numRequested, Executor::instance().concurrency())
+    };
+
+    return Executor::insideTask() ? 1 : numThreads;
+}
 
 } // namespace uv::execution
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Utils/CycleClock.hpp"
+
+#include <chrono>
+
+namespace uv::utils
+{
+namespace detail
+{
+// Spins for a few milliseconds and compares the counter against steady_clock.
+double calibrateNsPerCycle()
+{
+    if constexpr (!CycleClock::hasTsc())
+    {
+        return 1.0;
+    }
+    else
+    {
+        using clock = std::chrono::steady_clock;
+
+        constexpr auto window{std::chrono::milliseconds{10}};
+
+        const clock::time_point t0{clock::now()};
+        const std::uint64_t c0{CycleClock::start()};
+
+        clock::time_point t1{clock::now()};
+
+        while (t1 - t0 < window)
+            t1 = clock::now();
+
+        const std::uint64_t c1{CycleClock::stop()};
+        const double ns{std::chrono::duration<double, std::nano>(t1 - t0).count()};
+
+        return (c1 > c0) ? ns / static_cast<double>(c1 - c0) : 1.0;
+    }
+}
+} // namespace detail
+
+double CycleClock::nsPerCycle()
+{
+    static const double value{detail::calibrateNsPerCycle()};
+    return value;
+}
+
+double CycleClock::toNs(std::uint64_t cycles)
+{
+    return static_cast<double>(cycles) * nsPerCycle();
+}
+} // namespace uv::utils
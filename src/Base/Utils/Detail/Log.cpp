@@ -4,11 +4,11 @@
 #include "Base/Macros/Require.hpp"
 
 #include <array>
-#include <chrono>
+#include <cstdio>
 #include <ctime>
 #include <filesystem>
 #include <format>
-#include <iostream>
+#include <iterator>
 #include <string>
 #include <string_view>
 #include <system_error>
@@ -18,13 +18,96 @@ namespace uv::utils
 
 using errors::ErrorCode;
 
+namespace detail
+{
+// Lines are written once this many bytes are pending, even if more are queued.
+constexpr std::size_t batchBytes{std::size_t{1} << 16};
+
+std::uint32_t threadTag() noexcept
+{
+    static std::atomic<std::uint32_t> next{1};
+    thread_local const std::uint32_t tag{next.fetch_add(1, std::memory_order_relaxed)};
+    return tag;
+}
+
+// Formats log lines, reusing the calendar part of the timestamp while the second
+// does not change.
+class LineFormat
+{
+  public:
+    void append(
+        std::string& out,
+        std::chrono::system_clock::time_point time,
+        Level lvl,
+        std::uint32_t thread,
+        std::string_view msg
+    )
+    {
+        using namespace std::chrono;
+
+        const std::time_t tt{system_clock::to_time_t(time)};
+        const auto ms = duration_cast<milliseconds>(time.time_since_epoch()) % 1000;
+
+        if (tt != second_)
+        {
+            std::tm tm{};
+#if defined(_WIN32)
+            localtime_s(&tm, &tt);
+#else
+            localtime_r(&tt, &tm);
+#endif
+            // NOSONAR -- chrono time-zone formatting is not portable across
+            // supported libstdc++.
+            std::strftime( // NOSONAR
+                timestamp_.data(),
+                timestamp_.size(),
+                "%Y-%m-%d %H:%M:%S",
+                &tm
+            );
+            second_ = tt;
+        }
+
+        const char* lvlStr = (lvl == Level::Info) ? "INFO" : "WARN";
+
+        std::format_to(
+            std::back_inserter(out),
+            "[{}.{:03}][{}][T{}] {}\n",
+            timestamp_.data(),
+            ms.count(),
+            lvlStr,
+            thread,
+            msg
+        );
+    }
+
+  private:
+    std::time_t second_{-1};
+    std::array<char, 20> timestamp_{};
+};
+} // namespace detail
+
 Log& Log::instance()
 {
     static Log g;
     return g;
 }
 
-Log::Log() = default;
+Log::Log()
+    : writer_([this](std::stop_token stop) { run(stop); })
+{
+}
+
+Log::~Log()
+{
+    writer_.request_stop();
+
+    {
+        std::lock_guard lock{wakeMutex_};
+    }
+    wake_.notify_one();
+
+    writer_.join();
+}
 
 void Log::setFile(std::string_view filename)
 {
@@ -42,57 +125,212 @@ void Log::setFile(std::string_view filename)
 
     std::filesystem::path fullPath = logDir / filename;
 
-    file_.open(fullPath, std::ios::out | std::ios::app);
+    // Messages queued so far belong to the previous file.
+    flush();
 
-    fileEnabled_ = file_.is_open();
+    std::lock_guard lock{fileMutex_};
+
+    if (file_.is_open())
+        file_.close();
+
+    file_.open(fullPath, std::ios::out | std::ios::app);
 
-    REQUIRE_FILE_OPENED(fileEnabled_, fullPath);
+    REQUIRE_FILE_OPENED(file_.is_open(), fullPath);
 }
 
 void Log::enableConsole(bool enabled) noexcept
 {
-    consoleEnabled_ = enabled;
+    consoleEnabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void Log::setFlushInterval(std::chrono::milliseconds interval) noexcept
+{
+    flushIntervalMs_.store(
+        interval.count() < 1 ? 1 : static_cast<std::int64_t>(interval.count()),
+        std::memory_order_relaxed
+    );
+}
+
+void Log::setOverflow(Overflow policy) noexcept
+{
+    overflow_.store(policy, std::memory_order_relaxed);
 }
 
 void Log::log(Level lvl, std::string_view msg)
 {
-    using namespace std::chrono;
+    Record record{
+        std::chrono::system_clock::now(),
+        lvl,
+        detail::threadTag(),
+        consoleEnabled_.load(std::memory_order_relaxed),
+        std::string{msg}
+    };
 
-    const auto now = system_clock::now();
-    const auto tt = system_clock::to_time_t(now);
-    const auto ms = duration_cast<milliseconds>(now.time_since_epoch()) % 1000;
+    if (!queue_.tryPush(record))
+    {
+        if (overflow_.load(std::memory_order_relaxed) == Overflow::Drop)
+        {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
 
-    std::tm tm{};
-#if defined(_WIN32)
-    localtime_s(&tm, &tt);
-#else
-    localtime_r(&tt, &tm);
-#endif
+        do
+        {
+            wake_.notify_one();
+            std::this_thread::yield();
+        } while (!queue_.tryPush(record));
+    }
+
+    wake_.notify_one();
+}
 
-    const char* lvlStr = (lvl == Level::Info) ? "INFO" : "WARN";
+void Log::flush()
+{
+    const std::size_t target{queue_.pushed()};
+    std::size_t current{flushTarget_.load(std::memory_order_relaxed)};
 
-    std::array<char, 20> timestamp{};
-    // NOSONAR -- chrono time-zone formatting is not portable across supported libstdc++.
-    std::strftime( // NOSONAR
-        timestamp.data(),
-        timestamp.size(),
-        "%Y-%m-%d %H:%M:%S",
-        &tm
+    while (current < target && !flushTarget_.compare_exchange_weak(current, target))
+    {
+    }
+
+    std::unique_lock lock{wakeMutex_};
+    wake_.notify_one();
+
+    flushed_.wait(
+        lock,
+        [&] { return durable_.load(std::memory_order_acquire) >= target; }
     );
-    const std::string line{
-        std::format("[{}.{:03}][{}] {}\n", timestamp.data(), ms.count(), lvlStr, msg)
-    };
+}
+
+std::uint64_t Log::dropped() const noexcept
+{
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+void Log::run(std::stop_token stop)
+{
+    using namespace std::chrono;
+
+    detail::LineFormat format;
+    std::string console;
+    std::string lines;
+    Record record;
+    std::size_t written{0};
+    std::uint64_t reported{0};
+    auto lastFlush{steady_clock::now()};
 
-    if (consoleEnabled_)
+    while (true)
     {
-        std::cout << line << std::flush;
+        bool popped{false};
+
+        while (lines.size() < detail::batchBytes && queue_.tryPop(record))
+        {
+            const std::size_t start{lines.size()};
+
+            format.append(lines, record.time, record.level, record.thread, record.msg);
+
+            if (record.console)
+                console.append(lines, start);
+
+            ++written;
+            popped = true;
+        }
+
+        if (const std::uint64_t drops{dropped_.load(std::memory_order_relaxed)};
+            drops != reported)
+        {
+            const std::size_t start{lines.size()};
+
+            format.append(
+                lines,
+                system_clock::now(),
+                Level::Warn,
+                0,
+                std::format("{} log messages dropped: queue full", drops - reported)
+            );
+
+            if (consoleEnabled_.load(std::memory_order_relaxed))
+                console.append(lines, start);
+
+            reported = drops;
+        }
+
+        write(console, lines);
+
+        const auto now{steady_clock::now()};
+        const milliseconds interval{flushIntervalMs_.load(std::memory_order_relaxed)};
+        const std::size_t durable{durable_.load(std::memory_order_relaxed)};
+
+        if (written != durable &&
+            (now - lastFlush >= interval ||
+             flushTarget_.load(std::memory_order_acquire) > durable))
+        {
+            sync(written);
+            lastFlush = now;
+        }
+
+        if (stop.stop_requested() && written == queue_.pushed())
+            break;
+
+        if (popped)
+            continue;
+
+        // A producer has claimed a slot but not published it yet.
+        if (!idle(written, stop))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Producers notify without the lock, so a missed wake-up costs at most
+        // one flush interval.
+        std::unique_lock lock{wakeMutex_};
+        wake_.wait_for(lock, interval, [&] { return !idle(written, stop); });
+    }
+
+    sync(written);
+}
+
+void Log::write(std::string& console, std::string& file)
+{
+    if (!console.empty())
+    {
+        std::fwrite(console.data(), 1, console.size(), stdout);
+        std::fflush(stdout);
+        console.clear();
     }
 
-    if (fileEnabled_)
+    if (!file.empty())
     {
-        file_ << line;
-        file_.flush();
+        std::lock_guard lock{fileMutex_};
+
+        if (file_.is_open())
+            file_.write(file.data(), static_cast<std::streamsize>(file.size()));
+
+        file.clear();
     }
 }
 
+void Log::sync(std::size_t written)
+{
+    {
+        std::lock_guard lock{fileMutex_};
+
+        if (file_.is_open())
+            file_.flush();
+    }
+
+    {
+        std::lock_guard lock{wakeMutex_};
+        durable_.store(written, std::memory_order_release);
+    }
+    flushed_.notify_all();
+}
+
+bool Log::idle(std::size_t written, const std::stop_token& stop) const noexcept
+{
+    return !stop.stop_requested() && queue_.pushed() == written &&
+           flushTarget_.load(std::memory_order_acquire) <= written;
+}
+
 } // namespace uv::utils
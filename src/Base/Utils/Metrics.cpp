@@ -0,0 +1,313 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Utils/Metrics.hpp"
+#include "Base/Utils/CycleClock.hpp"
+#include "Base/Macros/Require.hpp"
+#include "Base/Macros/Unreachable.hpp"
+#include "Base/Types.hpp"
+
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+
+namespace uv::utils
+{
+namespace detail
+{
+struct MetricsRegistry
+{
+    std::mutex mutex;
+    Vector<std::unique_ptr<MetricsShard>> shards;
+};
+
+// Shards outlive their threads so that work done by finished threads still
+// shows up in snapshots.
+MetricsRegistry& metricsRegistry()
+{
+    static MetricsRegistry registry;
+    return registry;
+}
+
+MetricsShard& registerMetricsShard()
+{
+    MetricsRegistry& registry{metricsRegistry()};
+    std::lock_guard lock{registry.mutex};
+
+    registry.shards.push_back(std::make_unique<MetricsShard>());
+    return *registry.shards.back();
+}
+
+std::string_view help(Counter c) noexcept
+{
+    using enum Counter;
+
+    switch (c)
+    {
+    case CharFunction:
+        return "Heston characteristic function evaluations.";
+    case CharFunctionCached:
+        return "Heston characteristic function evaluations with cached terms.";
+    case Integrals:
+        return "Tanh-sinh integrals computed.";
+    case QuadratureNodes:
+        return "Integrand evaluations across all tanh-sinh integrals.";
+    case ImpliedVolSolves:
+        return "Implied volatility inversions.";
+    case NLoptObjective:
+        return "NLopt objective evaluations.";
+    case NLoptConstraint:
+        return "NLopt constraint callback evaluations.";
+    case CeresResidual:
+        return "Ceres residual evaluations.";
+    case CeresJacobian:
+        return "Ceres Jacobian evaluations.";
+    }
+
+    UNREACHABLE(Counter, c);
+}
+
+std::string_view help(Histogram h) noexcept
+{
+    using enum Histogram;
+
+    switch (h)
+    {
+    case QuadratureNodes:
+        return "Integrand evaluations per tanh-sinh integral before early exit.";
+    case CallPriceCycles:
+        return "CPU cycles per Heston Pricer::callPrice call.";
+    case ImpliedVolCycles:
+        return "CPU cycles per implied volatility call.";
+    }
+
+    UNREACHABLE(Histogram, h);
+}
+} // namespace detail
+
+double HistogramSnapshot::mean() const noexcept
+{
+    return (count == 0) ? 0.0 : static_cast<double>(sum) / static_cast<double>(count);
+}
+
+std::uint64_t HistogramSnapshot::quantile(double q) const noexcept
+{
+    if (count == 0)
+        return 0;
+
+    const auto rank{
+        static_cast<std::uint64_t>(std::ceil(q * static_cast<double>(count)))
+    };
+    std::uint64_t cumulative{0};
+
+    for (std::size_t b{0}; b + 1 < histogramBuckets; ++b)
+    {
+        cumulative += buckets[b];
+
+        if (cumulative >= rank)
+            return std::uint64_t{1} << b;
+    }
+
+    return std::uint64_t{1} << (histogramBuckets - 1);
+}
+
+std::uint64_t MetricsSnapshot::operator[](Counter c) const noexcept
+{
+    return counters[static_cast<std::size_t>(c)];
+}
+
+const HistogramSnapshot& MetricsSnapshot::operator[](Histogram h) const noexcept
+{
+    return histograms[static_cast<std::size_t>(h)];
+}
+
+MetricsSnapshot MetricsSnapshot::operator-(const MetricsSnapshot& earlier) const noexcept
+{
+    MetricsSnapshot delta{*this};
+
+    for (std::size_t i{0}; i < numCounters; ++i)
+        delta.counters[i] -= earlier.counters[i];
+
+    for (std::size_t h{0}; h < numHistograms; ++h)
+    {
+        for (std::size_t b{0}; b < histogramBuckets; ++b)
+            delta.histograms[h].buckets[b] -= earlier.histograms[h].buckets[b];
+
+        delta.histograms[h].count -= earlier.histograms[h].count;
+        delta.histograms[h].sum -= earlier.histograms[h].sum;
+    }
+
+    return delta;
+}
+
+MetricsSnapshot Metrics::snapshot()
+{
+    MetricsSnapshot snap;
+    snap.nsPerCycle = CycleClock::nsPerCycle();
+
+    detail::MetricsRegistry& registry{detail::metricsRegistry()};
+    std::lock_guard lock{registry.mutex};
+
+    for (const auto& shard : registry.shards)
+    {
+        for (std::size_t i{0}; i < numCounters; ++i)
+            snap.counters[i] += shard->counters[i].load(std::memory_order_relaxed);
+
+        for (std::size_t h{0}; h < numHistograms; ++h)
+        {
+            HistogramSnapshot& hist{snap.histograms[h]};
+
+            for (std::size_t b{0}; b < histogramBuckets; ++b)
+            {
+                const std::uint64_t n{
+                    shard->buckets[h][b].load(std::memory_order_relaxed)
+                };
+                hist.buckets[b] += n;
+                hist.count += n;
+            }
+
+            hist.sum += shard->sums[h].load(std::memory_order_relaxed);
+        }
+    }
+
+    return snap;
+}
+
+void Metrics::reset()
+{
+    detail::MetricsRegistry& registry{detail::metricsRegistry()};
+    std::lock_guard lock{registry.mutex};
+
+    for (const auto& shard : registry.shards)
+    {
+        for (auto& c : shard->counters)
+            c.store(0, std::memory_order_relaxed);
+
+        for (auto& hist : shard->buckets)
+        {
+            for (auto& b : hist)
+                b.store(0, std::memory_order_relaxed);
+        }
+
+        for (auto& s : shard->sums)
+            s.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::string Metrics::prometheus(const MetricsSnapshot& snapshot)
+{
+    std::string out;
+    auto it{std::back_inserter(out)};
+
+    for (std::size_t i{0}; i < numCounters; ++i)
+    {
+        const auto c{static_cast<Counter>(i)};
+        const std::string_view name{toString(c)};
+
+        std::format_to(it, "# HELP {} {}\n", name, detail::help(c));
+        std::format_to(it, "# TYPE {} counter\n", name);
+        std::format_to(it, "{} {}\n", name, snapshot[c]);
+    }
+
+    for (std::size_t h{0}; h < numHistograms; ++h)
+    {
+        const auto hist{static_cast<Histogram>(h)};
+        const std::string_view name{toString(hist)};
+        const HistogramSnapshot& values{snapshot[hist]};
+
+        std::format_to(it, "# HELP {} {}\n", name, detail::help(hist));
+        std::format_to(it, "# TYPE {} histogram\n", name);
+
+        std::uint64_t cumulative{0};
+
+        for (std::size_t b{0}; b < histogramBuckets; ++b)
+        {
+            cumulative += values.buckets[b];
+
+            if (b + 1 < histogramBuckets)
+            {
+                std::format_to(
+                    it,
+                    "{}_bucket{{le=\"{}\"}} {}\n",
+                    name,
+                    std::uint64_t{1} << b,
+                    cumulative
+                );
+            }
+            else
+            {
+                std::format_to(it, "{}_bucket{{le=\"+Inf\"}} {}\n", name, cumulative);
+            }
+        }
+
+        std::format_to(it, "{}_sum {}\n", name, values.sum);
+        std::format_to(it, "{}_count {}\n", name, values.count);
+    }
+
+    if (snapshot.nsPerCycle > 0.0)
+    {
+        out.append("# HELP uv_ns_per_cycle Calibrated nanoseconds per cycle count.\n");
+        out.append("# TYPE uv_ns_per_cycle gauge\n");
+        std::format_to(it, "uv_ns_per_cycle {}\n", snapshot.nsPerCycle);
+    }
+
+    return out;
+}
+
+void Metrics::writePrometheus(const std::filesystem::path& path)
+{
+    std::ofstream file{path, std::ios::out | std::ios::trunc};
+
+    REQUIRE_FILE_OPENED(file.is_open(), path);
+
+    file << prometheus(snapshot());
+}
+
+std::string_view toString(Counter c) noexcept
+{
+    using enum Counter;
+
+    switch (c)
+    {
+    case CharFunction:
+        return "uv_charfunction_calls_total";
+    case CharFunctionCached:
+        return "uv_charfunction_cached_calls_total";
+    case Integrals:
+        return "uv_quadrature_integrals_total";
+    case QuadratureNodes:
+        return "uv_quadrature_nodes_total";
+    case ImpliedVolSolves:
+        return "uv_implied_vol_solves_total";
+    case NLoptObjective:
+        return "uv_nlopt_objective_evals_total";
+    case NLoptConstraint:
+        return "uv_nlopt_constraint_evals_total";
+    case CeresResidual:
+        return "uv_ceres_residual_evals_total";
+    case CeresJacobian:
+        return "uv_ceres_jacobian_evals_total";
+    }
+
+    UNREACHABLE(Counter, c);
+}
+
+std::string_view toString(Histogram h) noexcept
+{
+    using enum Histogram;
+
+    switch (h)
+    {
+    case QuadratureNodes:
+        return "uv_quadrature_nodes_per_integral";
+    case CallPriceCycles:
+        return "uv_heston_call_price_cycles";
+    case ImpliedVolCycles:
+        return "uv_implied_vol_cycles";
+    }
+
+    UNREACHABLE(Histogram, h);
+}
+} // namespace uv::utils
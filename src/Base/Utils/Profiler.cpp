@@ -0,0 +1,324 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Utils/Profiler.hpp"
+#include "Base/Macros/Require.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string_view>
+#include <utility>
+
+namespace uv::utils
+{
+namespace detail
+{
+thread_local std::uint64_t zonePath{0};
+thread_local std::uint32_t zoneDepth{0};
+
+// FNV-1a of the name folded into the parent path, so that equal names under
+// different parents aggregate separately.
+std::uint64_t childPath(std::uint64_t parent, const char* name) noexcept
+{
+    std::uint64_t hash{14695981039346656037ull ^ parent};
+
+    for (const char* c{name}; *c != '\0'; ++c)
+    {
+        hash ^= static_cast<unsigned char>(*c);
+        hash *= 1099511628211ull;
+    }
+
+    return (hash == 0) ? 1 : hash;
+}
+
+double toMs(std::int64_t ns) noexcept
+{
+    return static_cast<double>(ns) * 1e-6;
+}
+
+void appendJsonString(std::string& out, std::string_view s)
+{
+    out.push_back('"');
+
+    for (const char c : s)
+    {
+        if (c == '"' || c == '\\')
+            out.push_back('\\');
+
+        if (static_cast<unsigned char>(c) < 0x20)
+            std::format_to(std::back_inserter(out), "\\u{:04x}", static_cast<int>(c));
+        else
+            out.push_back(c);
+    }
+
+    out.push_back('"');
+}
+} // namespace detail
+
+Profiler& Profiler::instance()
+{
+    static Profiler g;
+    return g;
+}
+
+Profiler::Profiler()
+    : epoch_(std::chrono::steady_clock::now())
+{
+}
+
+std::shared_ptr<Profiler::ThreadBuffer> Profiler::registerThread()
+{
+    auto buffer{std::make_shared<ThreadBuffer>()};
+
+    std::lock_guard lock{mutex_};
+    buffer->thread = static_cast<std::uint32_t>(buffers_.size() + 1);
+    buffers_.push_back(buffer);
+
+    return buffer;
+}
+
+Profiler::ThreadBuffer& Profiler::localBuffer()
+{
+    thread_local const std::shared_ptr<ThreadBuffer> buffer{registerThread()};
+    return *buffer;
+}
+
+void Profiler::record(const ZoneEvent& event)
+{
+    ThreadBuffer& buffer{localBuffer()};
+
+    std::lock_guard lock{buffer.mutex};
+    buffer.events.push_back(event);
+    buffer.events.back().thread = buffer.thread;
+}
+
+void Profiler::reset()
+{
+    std::lock_guard lock{mutex_};
+
+    for (const auto& buffer : buffers_)
+    {
+        std::lock_guard bufferLock{buffer->mutex};
+        buffer->events.clear();
+    }
+}
+
+std::int64_t Profiler::nowNs() const noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - epoch_
+    )
+        .count();
+}
+
+Vector<ZoneEvent> Profiler::events() const
+{
+    Vector<ZoneEvent> all;
+    std::lock_guard lock{mutex_};
+
+    for (const auto& buffer : buffers_)
+    {
+        std::lock_guard bufferLock{buffer->mutex};
+        all.insert(all.end(), buffer->events.begin(), buffer->events.end());
+    }
+
+    std::sort(
+        all.begin(),
+        all.end(),
+        [](const ZoneEvent& a, const ZoneEvent& b) { return a.startNs < b.startNs; }
+    );
+
+    return all;
+}
+
+Vector<ZoneStats> Profiler::summary() const
+{
+    const Vector<ZoneEvent> all{events()};
+
+    struct Node
+    {
+        std::uint64_t parent{0};
+        const char* name{nullptr};
+        std::uint32_t depth{0};
+        Vector<std::int64_t> durations;
+    };
+
+    std::map<std::uint64_t, Node> nodes;
+
+    for (const ZoneEvent& e : all)
+    {
+        Node& node{nodes[e.path]};
+        node.parent = e.parent;
+        node.name = e.name;
+        node.depth = e.depth;
+        node.durations.push_back(e.durationNs);
+    }
+
+    // Component lists order parents before children and siblings by name.
+    std::map<Vector<std::string_view>, const Node*> ordered;
+
+    for (const auto& [path, node] : nodes)
+    {
+        Vector<std::string_view> components;
+
+        for (const Node* n{&node}; n != nullptr;)
+        {
+            components.push_back(n->name);
+
+            const auto parent{nodes.find(n->parent)};
+            n = (n->depth == 0 || parent == nodes.end()) ? nullptr : &parent->second;
+        }
+
+        std::reverse(components.begin(), components.end());
+        ordered.emplace(std::move(components), &node);
+    }
+
+    Vector<ZoneStats> stats;
+    stats.reserve(ordered.size());
+
+    for (auto& [components, node] : ordered)
+    {
+        Vector<std::int64_t> durations{node->durations};
+        std::sort(durations.begin(), durations.end());
+
+        std::int64_t total{0};
+        for (const std::int64_t d : durations)
+            total += d;
+
+        const std::size_t n{durations.size()};
+        const auto rank{
+            static_cast<std::size_t>(std::ceil(0.99 * static_cast<double>(n)))
+        };
+
+        ZoneStats s;
+
+        for (const std::string_view c : components)
+        {
+            if (!s.path.empty())
+                s.path.push_back('/');
+            s.path.append(c);
+        }
+
+        s.name = node->name;
+        s.depth = node->depth;
+        s.count = n;
+        s.totalMs = detail::toMs(total);
+        s.minMs = detail::toMs(durations.front());
+        s.meanMs = s.totalMs / static_cast<double>(n);
+        s.p99Ms = detail::toMs(durations[std::max<std::size_t>(rank, 1) - 1]);
+        s.maxMs = detail::toMs(durations.back());
+
+        stats.push_back(std::move(s));
+    }
+
+    return stats;
+}
+
+std::string Profiler::summaryTable() const
+{
+    const Vector<ZoneStats> stats{summary()};
+
+    std::string out{std::format(
+        "{:<40} {:>8} {:>12} {:>10} {:>10} {:>10} {:>10}\n",
+        "Zone",
+        "Count",
+        "Total ms",
+        "Mean ms",
+        "Min ms",
+        "P99 ms",
+        "Max ms"
+    )};
+
+    for (const ZoneStats& s : stats)
+    {
+        const std::string label{std::string(2 * s.depth, ' ') + s.name};
+
+        std::format_to(
+            std::back_inserter(out),
+            "{:<40} {:>8} {:>12.3f} {:>10.3f} {:>10.3f} {:>10.3f} {:>10.3f}\n",
+            label,
+            s.count,
+            s.totalMs,
+            s.meanMs,
+            s.minMs,
+            s.p99Ms,
+            s.maxMs
+        );
+    }
+
+    return out;
+}
+
+std::string Profiler::chromeTrace() const
+{
+    const Vector<ZoneEvent> all{events()};
+
+    std::string out{"{\"displayTimeUnit\":\"ms\",\"traceEvents\":["};
+
+    for (std::size_t i{0}; i < all.size(); ++i)
+    {
+        const ZoneEvent& e{all[i]};
+
+        if (i > 0)
+            out.push_back(',');
+
+        out.append("{\"name\":");
+        detail::appendJsonString(out, e.name);
+        std::format_to(
+            std::back_inserter(out),
+            ",\"cat\":\"uv\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,"
+            "\"tid\":{}}}",
+            static_cast<double>(e.startNs) * 1e-3,
+            static_cast<double>(e.durationNs) * 1e-3,
+            e.thread
+        );
+    }
+
+    out.append("]}\n");
+
+    return out;
+}
+
+void Profiler::writeChromeTrace(const std::filesystem::path& path) const
+{
+    std::ofstream file{path, std::ios::out | std::ios::trunc};
+
+    REQUIRE_FILE_OPENED(file.is_open(), path);
+
+    file << chromeTrace();
+}
+
+Zone::Zone(const char* name) noexcept
+    : name_(name),
+      parent_(detail::zonePath),
+      path_(detail::childPath(detail::zonePath, name)),
+      depth_(detail::zoneDepth),
+      startNs_(Profiler::instance().nowNs())
+{
+    detail::zonePath = path_;
+    ++detail::zoneDepth;
+}
+
+Zone::~Zone()
+{
+    const std::int64_t endNs{Profiler::instance().nowNs()};
+
+    detail::zonePath = parent_;
+    detail::zoneDepth = depth_;
+
+    Profiler::instance().record(
+        ZoneEvent{
+            .name = name_,
+            .path = path_,
+            .parent = parent_,
+            .depth = depth_,
+            .thread = 0,
+            .startNs = startNs_,
+            .durationNs = endNs - startNs_
+        }
+    );
+}
+} // namespace uv::utils
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "IO/CSV/Manifest.hpp"
+#include "Base/Errors/Errors.hpp"
+#include "Base/Macros/Require.hpp"
+#include "IO/CSV/Detail/Read.hpp"
+
+#include <array>
+#include <format>
+#include <fstream>
+#include <string_view>
+
+namespace uv::io::csv
+{
+namespace
+{
+constexpr std::array<std::string_view, 5> columns{
+    "name",
+    "file",
+    "spot",
+    "rate",
+    "dividendYield"
+};
+} // namespace
+
+Vector<ManifestEntry> readManifest(const std::filesystem::path& path)
+{
+    std::ifstream file{path};
+    REQUIRE_FILE_OPENED(file.is_open(), path.string());
+
+    const std::string filename{path.string()};
+    const std::filesystem::path base{path.parent_path()};
+
+    Vector<ManifestEntry> entries;
+    std::string line;
+    std::size_t lineNo{0};
+    bool sawHeader{false};
+
+    while (std::getline(file, line))
+    {
+        ++lineNo;
+
+        const std::string_view trimmed{detail::trimView(line)};
+        if (trimmed.empty() || trimmed.front() == '#')
+            continue;
+
+        const auto cells{detail::splitComma(trimmed)};
+
+        if (cells.size() != columns.size())
+        {
+            errors::raise(
+                errors::ErrorCode::DataFormat,
+                std::format(
+                    "{}: expected {} columns at line {}, got {}",
+                    filename,
+                    columns.size(),
+                    lineNo,
+                    cells.size()
+                )
+            );
+        }
+
+        if (!sawHeader)
+        {
+            for (std::size_t j{0}; j < columns.size(); ++j)
+            {
+                if (detail::trimView(cells[j]) != columns[j])
+                {
+                    errors::raise(
+                        errors::ErrorCode::DataFormat,
+                        std::format(
+                            "{}: expected column '{}' at position {}",
+                            filename,
+                            columns[j],
+                            j + 1
+                        )
+                    );
+                }
+            }
+            sawHeader = true;
+            continue;
+        }
+
+        const std::string_view name{detail::trimView(cells[0])};
+        const std::filesystem::path surface{std::string{detail::trimView(cells[1])}};
+
+        if (name.empty() || surface.empty())
+        {
+            errors::raise(
+                errors::ErrorCode::DataFormat,
+                std::format("{}: empty name or file at line {}", filename, lineNo)
+            );
+        }
+
+        const detail::Options numeric{.allowPercent = false};
+        const auto number = [&](std::size_t col, std::string_view what)
+        {
+            return detail::parseNumberCellOrThrow<double>(
+                cells[col],
+                what,
+                lineNo,
+                col + 1,
+                numeric
+            );
+        };
+
+        const double spot{number(2, "spot")};
+        REQUIRE_POSITIVE(spot);
+
+        entries.push_back(ManifestEntry{
+            .name = std::string{name},
+            .file = surface.is_absolute() ? surface : base / surface,
+            .marketData = {
+                .interestRate = number(3, "rate"),
+                .dividendYield = number(4, "dividendYield"),
+                .spot = spot
+            }
+        });
+    }
+
+    if (entries.empty())
+    {
+        errors::raise(
+            errors::ErrorCode::DataFormat,
+            std::format("{}: manifest has no entries", filename)
+        );
+    }
+
+    return entries;
+}
+} // namespace uv::io::csv
@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "IO/CSV/Ticks.hpp"
+#include "Base/Errors/Errors.hpp"
+#include "Base/Macros/Require.hpp"
+#include "IO/CSV/Detail/Read.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <string_view>
+
+namespace uv::io::csv
+{
+namespace
+{
+constexpr std::array<std::string_view, 4> columns{"seq", "maturity", "moneyness", "vol"};
+
+std::uint64_t parseSeq(
+    std::string_view cell,
+    std::string_view filename,
+    std::size_t lineNo
+)
+{
+    const std::string_view trimmed{detail::trimView(cell)};
+    std::uint64_t seq{};
+
+    const auto [end, ec] =
+        std::from_chars(trimmed.data(), trimmed.data() + trimmed.size(), seq);
+
+    if (trimmed.empty() || ec != std::errc{} || end != trimmed.data() + trimmed.size())
+    {
+        errors::raise(
+            errors::ErrorCode::DataFormat,
+            std::format("{}: invalid sequence number at line {}", filename, lineNo)
+        );
+    }
+
+    return seq;
+}
+} // namespace
+
+Vector<core::QuoteUpdate<double>> readTicks(const std::filesystem::path& path)
+{
+    std::ifstream file{path};
+    REQUIRE_FILE_OPENED(file.is_open(), path.string());
+
+    const std::string filename{path.string()};
+
+    Vector<core::QuoteUpdate<double>> ticks;
+    std::string line;
+    std::size_t lineNo{0};
+    bool sawHeader{false};
+
+    while (std::getline(file, line))
+    {
+        ++lineNo;
+
+        const std::string_view trimmed{detail::trimView(line)};
+        if (trimmed.empty() || trimmed.front() == '#')
+            continue;
+
+        const auto cells{detail::splitComma(trimmed)};
+
+        if (cells.size() != columns.size())
+        {
+            errors::raise(
+                errors::ErrorCode::DataFormat,
+                std::format(
+                    "{}: expected {} columns at line {}, got {}",
+                    filename,
+                    columns.size(),
+                    lineNo,
+                    cells.size()
+                )
+            );
+        }
+
+        if (!sawHeader)
+        {
+            for (std::size_t j{0}; j < columns.size(); ++j)
+            {
+                if (detail::trimView(cells[j]) != columns[j])
+                {
+                    errors::raise(
+                        errors::ErrorCode::DataFormat,
+                        std::format(
+                            "{}: expected column '{}' at position {}",
+                            filename,
+                            columns[j],
+                            j + 1
+                        )
+                    );
+                }
+            }
+            sawHeader = true;
+            continue;
+        }
+
+        const detail::Options numeric{.allowPercent = false};
+        const auto number = [&](std::size_t col, std::string_view what)
+        {
+            return detail::parseNumberCellOrThrow<double>(
+                cells[col],
+                what,
+                lineNo,
+                col + 1,
+                numeric
+            );
+        };
+
+        const std::uint64_t seq{parseSeq(cells[0], filename, lineNo)};
+
+        if (!ticks.empty() && seq < ticks.back().seq)
+        {
+            errors::raise(
+                errors::ErrorCode::DataFormat,
+                std::format("{}: sequence number decreases at line {}", filename, lineNo)
+            );
+        }
+
+        const core::QuoteUpdate<double> tick{
+            .seq = seq,
+            .maturity = number(1, "maturity"),
+            .moneyness = number(2, "moneyness"),
+            .vol = number(3, "vol")
+        };
+
+        REQUIRE_NON_NEGATIVE(tick.maturity);
+        REQUIRE_POSITIVE(tick.moneyness);
+        REQUIRE_NON_NEGATIVE(tick.vol);
+
+        ticks.push_back(tick);
+    }
+
+    if (ticks.empty())
+    {
+        errors::raise(
+            errors::ErrorCode::DataFormat,
+            std::format("{}: tick file has no updates", filename)
+        );
+    }
+
+    return ticks;
+}
+} // namespace uv::io::csv
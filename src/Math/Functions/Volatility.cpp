@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Math/Functions/Volatility.hpp"
+#include "Base/Utils/Metrics.hpp"
 #include "Math/Functions/Detail/JackelDeclare.hpp"
 
 namespace uv::math::vol::detail
@@ -8,6 +9,8 @@ namespace uv::math::vol::detail
 
 double impliedVolJackelCall(double callPrice, double t, double dF, double F, double K)
 {
+    utils::Metrics::add(utils::Counter::ImpliedVolSolves);
+
     return implied_volatility_from_a_transformed_rational_guess(
         callPrice / dF,
         F,
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Models/Heston/Calibrate/Detail/MaturitySlice.hpp"
+#include "Base/Macros/Profile.hpp"
 #include "Base/Macros/Require.hpp"
 #include "Math/Functions/Volatility.hpp"
 
@@ -58,6 +59,8 @@ Vector<MaturitySlice> makeSlices(
     const opt::cost::WeightATM<double>& weightATM
 )
 {
+    PROFILE_ZONE("heston::makeSlices");
+
     validateInputs(maturities, discountFactors, forwards, strikes, vol);
 
     const std::size_t numStrikes{strikes.size()};
@@ -57,4 +57,42 @@ std::unique_ptr<::ceres::LossFunction> makeLoss(Loss a, double lossParam)
     UNREACHABLE(Loss, a);
 }
 
+StopCallback::StopCallback(const StopCondition& stop) noexcept
+    : stop_(stop)
+{
+}
+
+::ceres::CallbackReturnType StopCallback::operator()(const ::ceres::IterationSummary&)
+{
+    reason_ = stop_.check();
+
+    return reason_ ? ::ceres::SOLVER_TERMINATE_SUCCESSFULLY : ::ceres::SOLVER_CONTINUE;
+}
+
+std::optional<Termination> StopCallback::reason() const noexcept
+{
+    return reason_;
+}
+
+Termination toTermination(
+    ::ceres::TerminationType type,
+    std::optional<Termination> stopReason
+) noexcept
+{
+    switch (type)
+    {
+    case ::ceres::CONVERGENCE:
+        return Termination::Converged;
+    case ::ceres::NO_CONVERGENCE:
+        return Termination::MaxEval;
+    case ::ceres::USER_SUCCESS:
+        return stopReason.value_or(Termination::Converged);
+    case ::ceres::FAILURE:
+    case ::ceres::USER_FAILURE:
+        return Termination::Failed;
+    }
+
+    return Termination::Failed;
+}
+
 } // namespace uv::opt::ceres::detail
@@ -49,4 +49,30 @@ std::string_view toString(const ::nlopt::result& r) noexcept
     return toString(toStatus(r));
 }
 
+Termination toTermination(NLoptStatus s, std::optional<Termination> stopReason) noexcept
+{
+    using enum NLoptStatus;
+
+    switch (s)
+    {
+    case Success:
+    case StopvalReached:
+    case FtolReached:
+    case XtolReached:
+    case RoundoffLimited:
+        return Termination::Converged;
+    case MaxevalReached:
+    case MaxtimeReached:
+        return Termination::MaxEval;
+    case ForcedStop:
+        return stopReason.value_or(Termination::Cancelled);
+    case Failure:
+    case InvalidArgs:
+    case OutOfMemory:
+        return Termination::Failed;
+    }
+
+    return Termination::Failed;
+}
+
 } // namespace uv::opt::nlopt::detail
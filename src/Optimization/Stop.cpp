@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Optimization/Stop.hpp"
+#include "Base/Macros/Unreachable.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace uv::opt
+{
+StopCondition StopCondition::within(Clock::duration budget, std::stop_token token)
+{
+    return StopCondition{.token = std::move(token), .deadline = Clock::now() + budget};
+}
+
+bool StopCondition::active() const noexcept
+{
+    return token.stop_possible() || deadline != Clock::time_point::max();
+}
+
+std::optional<Termination> StopCondition::check() const noexcept
+{
+    if (token.stop_requested())
+        return Termination::Cancelled;
+
+    if (deadline != Clock::time_point::max() && Clock::now() >= deadline)
+        return Termination::DeadlineExceeded;
+
+    return std::nullopt;
+}
+
+bool isTruncated(Termination termination) noexcept
+{
+    return termination == Termination::Cancelled ||
+           termination == Termination::DeadlineExceeded;
+}
+
+Termination worst(Termination a, Termination b) noexcept
+{
+    return std::max(a, b);
+}
+
+std::string_view toString(Termination termination) noexcept
+{
+    using enum Termination;
+
+    switch (termination)
+    {
+    case Converged:
+        return "CONVERGED";
+    case MaxEval:
+        return "MAX_EVAL";
+    case Failed:
+        return "FAILED";
+    case DeadlineExceeded:
+        return "DEADLINE_EXCEEDED";
+    case Cancelled:
+        return "CANCELLED";
+    }
+
+    UNREACHABLE(Termination, termination);
+}
+} // namespace uv::opt
@@ -0,0 +1,281 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Service/BatchPricer.hpp"
+#include "Base/Errors/Errors.hpp"
+#include "Base/Macros/Require.hpp"
+#include "Math/Functions/Black.hpp"
+#include "Math/Functions/Volatility.hpp"
+#include "Models/SVI/LocalVol.hpp"
+#include "Models/SVI/Math.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <format>
+#include <tuple>
+#include <utility>
+
+namespace uv::service
+{
+namespace
+{
+struct Keyed
+{
+    std::size_t request;
+    std::size_t surface;
+};
+
+bool validInputs(const Request& request) noexcept
+{
+    return std::isfinite(request.maturity) && request.maturity > 0.0 &&
+           std::isfinite(request.strike) && request.strike > 0.0;
+}
+
+// Total variance is linear in maturity at fixed log-moneyness between slices.
+double sviVol(const Vector<models::svi::Params<double>>& params, double t, double k)
+{
+    const auto weights{models::svi::detail::timeWeights(params, t)};
+
+    const double w{
+        weights.lowerWeight * models::svi::totalVariance(params[weights.lower], k) +
+        weights.upperWeight * models::svi::totalVariance(params[weights.upper], k)
+    };
+
+    if (!(w > 0.0))
+    {
+        errors::raise(
+            errors::ErrorCode::OutOfRange,
+            std::format("SVI total variance {} is not positive at t={}, k={}", w, t, k)
+        );
+    }
+
+    return std::sqrt(w / t);
+}
+} // namespace
+
+BatchPricer::BatchPricer(Vector<CalibratedSurface> surfaces, double spotBump)
+    : spotBump_{spotBump}
+{
+    REQUIRE_POSITIVE(spotBump_);
+
+    entries_.reserve(surfaces.size());
+
+    for (CalibratedSurface& surface : surfaces)
+    {
+        REQUIRE_POSITIVE(surface.marketData.spot);
+
+        if (surface.sviParams.empty())
+        {
+            errors::raise(
+                errors::ErrorCode::InvalidArgument,
+                std::format("Surface '{}' has no SVI slices", surface.name)
+            );
+        }
+
+        if (!index_.emplace(surface.name, entries_.size()).second)
+        {
+            errors::raise(
+                errors::ErrorCode::InvalidArgument,
+                std::format("Duplicate surface '{}'", surface.name)
+            );
+        }
+
+        models::heston::price::Pricer<double> pricer{};
+        pricer.setParams(surface.hestonParams);
+
+        entries_.push_back({std::move(surface), std::move(pricer)});
+    }
+}
+
+std::size_t BatchPricer::price(
+    std::span<const Request> requests,
+    std::span<Response> responses
+) const
+{
+    REQUIRE_SAME_SIZE(requests, responses);
+
+    Vector<Keyed> keyed;
+    keyed.reserve(requests.size());
+
+    for (std::size_t i{0}; i < requests.size(); ++i)
+    {
+        const Request& request{requests[i]};
+        Response& response{responses[i]};
+
+        response = Response{.id = request.id};
+
+        if (request.kind == RequestKind::Stats || !validInputs(request))
+        {
+            response.status = Status::InvalidRequest;
+            continue;
+        }
+
+        const auto it{index_.find(request.surface)};
+        if (it == index_.end())
+        {
+            response.status = Status::UnknownSurface;
+            continue;
+        }
+
+        keyed.push_back({i, it->second});
+    }
+
+    const auto key = [&](const Keyed& k)
+    {
+        const Request& r{requests[k.request]};
+        return std::tuple{k.surface, r.model, r.maturity};
+    };
+
+    std::stable_sort(
+        keyed.begin(),
+        keyed.end(),
+        [&](const Keyed& a, const Keyed& b) { return key(a) < key(b); }
+    );
+
+    std::size_t pricingCalls{0};
+    Vector<double> strikes;
+    Vector<double> calls;
+    Vector<double> callsUp;
+    Vector<double> callsDown;
+    Vector<double> vols;
+
+    for (std::size_t begin{0}; begin < keyed.size();)
+    {
+        std::size_t end{begin + 1};
+        while (end < keyed.size() && key(keyed[end]) == key(keyed[begin]))
+            ++end;
+
+        const std::span<const Keyed> group{keyed.data() + begin, end - begin};
+        begin = end;
+
+        const Entry& entry{entries_[group.front().surface]};
+        const CalibratedSurface& surface{entry.surface};
+        const Request& first{requests[group.front().request]};
+        const double t{first.maturity};
+        const std::size_t n{group.size()};
+
+        const bool wantsGreeks{std::any_of(
+            group.begin(),
+            group.end(),
+            [&](const Keyed& k)
+            { return requests[k.request].kind == RequestKind::Greeks; }
+        )};
+
+        try
+        {
+            const core::MarketData<double>& market{surface.marketData};
+            const double dF{std::exp(-market.interestRate * t)};
+            const double F{market.spot * std::exp(-market.dividendYield * t) / dF};
+            const double FUp{F * (1.0 + spotBump_)};
+            const double FDown{F * (1.0 - spotBump_)};
+
+            strikes.resize(n);
+            calls.resize(n);
+            vols.assign(n, 0.0);
+            for (std::size_t j{0}; j < n; ++j)
+                strikes[j] = requests[group[j].request].strike;
+
+            if (wantsGreeks)
+            {
+                callsUp.resize(n);
+                callsDown.resize(n);
+            }
+
+            switch (first.model)
+            {
+            case Model::Heston:
+                entry.pricer.callPrice(calls, t, dF, F, strikes);
+                ++pricingCalls;
+
+                if (wantsGreeks)
+                {
+                    entry.pricer.callPrice(callsUp, t, dF, FUp, strikes);
+                    entry.pricer.callPrice(callsDown, t, dF, FDown, strikes);
+                    pricingCalls += 2;
+                }
+
+                for (std::size_t j{0}; j < n; ++j)
+                {
+                    if (requests[group[j].request].kind != RequestKind::Price)
+                        vols[j] = math::vol::impliedVol(calls[j], t, dF, F, strikes[j]);
+                }
+                break;
+
+            case Model::SVI:
+                for (std::size_t j{0}; j < n; ++j)
+                    vols[j] = sviVol(surface.sviParams, t, std::log(strikes[j] / F));
+
+                // Sticky strike: the bumped prices keep each strike's vol.
+                math::black::priceB76<double>(calls, t, dF, F, vols, strikes);
+                ++pricingCalls;
+
+                if (wantsGreeks)
+                {
+                    math::black::priceB76<double>(callsUp, t, dF, FUp, vols, strikes);
+                    math::black::priceB76<double>(callsDown, t, dF, FDown, vols, strikes);
+                    pricingCalls += 2;
+                }
+                break;
+            }
+
+            const double spotStep{spotBump_ * surface.marketData.spot};
+            const double forwardDelta{dF * F / surface.marketData.spot};
+
+            for (std::size_t j{0}; j < n; ++j)
+            {
+                const Request& request{requests[group[j].request]};
+                Response& response{responses[group[j].request]};
+
+                const bool isPut{request.optionType == OptionType::Put};
+                const double parity{isPut ? dF * (F - strikes[j]) : 0.0};
+                const double price{calls[j] - parity};
+
+                switch (request.kind)
+                {
+                case RequestKind::Price:
+                    response.values = {price, 0.0, 0.0, 0.0};
+                    break;
+                case RequestKind::Vol:
+                    response.values = {vols[j], 0.0, 0.0, 0.0};
+                    break;
+                case RequestKind::Greeks:
+                {
+                    const double callDelta{
+                        (callsUp[j] - callsDown[j]) / (2.0 * spotStep)
+                    };
+                    const double gamma{
+                        (callsUp[j] - 2.0 * calls[j] + callsDown[j]) /
+                        (spotStep * spotStep)
+                    };
+
+                    response.values = {
+                        price,
+                        isPut ? callDelta - forwardDelta : callDelta,
+                        gamma,
+                        math::black::vegaB76(t, dF, F, vols[j], strikes[j])
+                    };
+                    break;
+                }
+                case RequestKind::Stats:
+                    break;
+                }
+            }
+        }
+        catch (const std::exception&)
+        {
+            for (const Keyed& k : group)
+                responses[k.request] = Response{
+                    .status = Status::PricingError,
+                    .id = requests[k.request].id
+                };
+        }
+    }
+
+    return pricingCalls;
+}
+
+std::size_t BatchPricer::numSurfaces() const noexcept
+{
+    return entries_.size();
+}
+} // namespace uv::service
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Service/Client.hpp"
+#include "Base/Errors/Errors.hpp"
+
+#include <cstring>
+#include <format>
+
+namespace uv::service
+{
+namespace
+{
+void appendFrame(Vector<std::byte>& out, const Request& request)
+{
+    const RequestHeader header{makeHeader(request)};
+    const std::size_t offset{out.size()};
+
+    out.resize(offset + sizeof(header) + request.surface.size());
+    std::memcpy(out.data() + offset, &header, sizeof(header));
+    std::memcpy(
+        out.data() + offset + sizeof(header),
+        request.surface.data(),
+        request.surface.size()
+    );
+}
+} // namespace
+
+Client::Client(const std::filesystem::path& socketPath)
+    : socket_{detail::connectUnix(socketPath)}
+{
+}
+
+Response Client::call(const Request& request)
+{
+    send(request);
+    return receive(request.id);
+}
+
+Vector<Response> Client::call(std::span<const Request> requests)
+{
+    Vector<std::byte> frames;
+    for (const Request& request : requests)
+        appendFrame(frames, request);
+
+    detail::writeExact(socket_, frames);
+
+    Vector<Response> responses;
+    responses.reserve(requests.size());
+
+    for (const Request& request : requests)
+        responses.push_back(receive(request.id));
+
+    return responses;
+}
+
+Response Client::stats()
+{
+    Request request{};
+    request.id = nextStatsId_++;
+    request.kind = RequestKind::Stats;
+
+    return call(request);
+}
+
+void Client::send(const Request& request)
+{
+    Vector<std::byte> frame;
+    appendFrame(frame, request);
+    detail::writeExact(socket_, frame);
+}
+
+Response Client::receive(std::uint64_t expectedId)
+{
+    Response response{};
+
+    if (!detail::readExact(socket_, std::as_writable_bytes(std::span{&response, 1})))
+    {
+        errors::raise(
+            errors::ErrorCode::FileIO,
+            "Pricing service closed the connection"
+        );
+    }
+
+    validate(response);
+
+    if (response.id != expectedId)
+    {
+        errors::raise(
+            errors::ErrorCode::DataFormat,
+            std::format(
+                "Pricing service answered request {} while {} was expected",
+                response.id,
+                expectedId
+            )
+        );
+    }
+
+    return response;
+}
+} // namespace uv::service
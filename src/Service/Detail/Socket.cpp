@@ -0,0 +1,282 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Service/Detail/Socket.hpp"
+#include "Base/Errors/Errors.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <format>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#define UV_SERVICE_SOCKETS 1
+#endif
+
+// A client that disconnects early must not kill the server with SIGPIPE.
+#if defined(MSG_NOSIGNAL)
+#define UV_SERVICE_SEND_FLAGS MSG_NOSIGNAL
+#else
+#define UV_SERVICE_SEND_FLAGS 0
+#endif
+
+namespace uv::service::detail
+{
+namespace
+{
+[[noreturn]] void raiseSystem(std::string_view what, int error)
+{
+    errors::raise(
+        errors::ErrorCode::FileIO,
+        std::format("{}: {}", what, std::generic_category().message(error))
+    );
+}
+
+#if defined(UV_SERVICE_SOCKETS)
+sockaddr_un makeAddress(const std::filesystem::path& path)
+{
+    const std::string native{path.string()};
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+
+    if (native.empty() || native.size() >= sizeof(address.sun_path))
+    {
+        errors::raise(
+            errors::ErrorCode::InvalidArgument,
+            std::format("Invalid Unix socket path '{}'", native)
+        );
+    }
+
+    std::memcpy(address.sun_path, native.c_str(), native.size() + 1);
+    return address;
+}
+
+Socket openSocket()
+{
+    Socket socket{::socket(AF_UNIX, SOCK_STREAM, 0)};
+    if (!socket)
+        raiseSystem("socket", errno);
+    return socket;
+}
+#else
+[[noreturn]] void unsupported()
+{
+    errors::raise(
+        errors::ErrorCode::NotImplemented,
+        "Unix domain sockets are not supported on this platform"
+    );
+}
+#endif
+} // namespace
+
+Socket::Socket(int fd) noexcept
+    : fd_{fd}
+{
+}
+
+Socket::Socket(Socket&& other) noexcept
+    : fd_{std::exchange(other.fd_, -1)}
+{
+}
+
+Socket& Socket::operator=(Socket&& other) noexcept
+{
+    if (this != &other)
+    {
+        Socket closing{std::move(*this)};
+        fd_ = std::exchange(other.fd_, -1);
+    }
+    return *this;
+}
+
+Socket::~Socket()
+{
+#if defined(UV_SERVICE_SOCKETS)
+    if (fd_ >= 0)
+        ::close(fd_);
+#endif
+}
+
+int Socket::fd() const noexcept
+{
+    return fd_;
+}
+
+Socket::operator bool() const noexcept
+{
+    return fd_ >= 0;
+}
+
+void Socket::shutdown() noexcept
+{
+#if defined(UV_SERVICE_SOCKETS)
+    if (fd_ >= 0)
+        ::shutdown(fd_, SHUT_RDWR);
+#endif
+}
+
+void Socket::shutdownRead() noexcept
+{
+#if defined(UV_SERVICE_SOCKETS)
+    if (fd_ >= 0)
+        ::shutdown(fd_, SHUT_RD);
+#endif
+}
+
+bool socketsSupported() noexcept
+{
+#if defined(UV_SERVICE_SOCKETS)
+    return true;
+#else
+    return false;
+#endif
+}
+
+Socket listenUnix(const std::filesystem::path& path, int backlog)
+{
+#if defined(UV_SERVICE_SOCKETS)
+    const sockaddr_un address{makeAddress(path)};
+    Socket socket{openSocket()};
+
+    std::error_code ignored;
+    std::filesystem::remove(path, ignored);
+
+    if (::bind(
+            socket.fd(),
+            reinterpret_cast<const sockaddr*>(&address),
+            sizeof(address)
+        ) != 0)
+        raiseSystem(std::format("bind {}", path.string()), errno);
+
+    if (::listen(socket.fd(), backlog) != 0)
+        raiseSystem(std::format("listen {}", path.string()), errno);
+
+    return socket;
+#else
+    static_cast<void>(path);
+    static_cast<void>(backlog);
+    unsupported();
+#endif
+}
+
+Socket connectUnix(const std::filesystem::path& path)
+{
+#if defined(UV_SERVICE_SOCKETS)
+    const sockaddr_un address{makeAddress(path)};
+    Socket socket{openSocket()};
+
+    if (::connect(
+            socket.fd(),
+            reinterpret_cast<const sockaddr*>(&address),
+            sizeof(address)
+        ) != 0)
+        raiseSystem(std::format("connect {}", path.string()), errno);
+
+    return socket;
+#else
+    static_cast<void>(path);
+    unsupported();
+#endif
+}
+
+Socket acceptConnection(const Socket& listener)
+{
+#if defined(UV_SERVICE_SOCKETS)
+    while (true)
+    {
+        const int fd{::accept(listener.fd(), nullptr, nullptr)};
+        if (fd >= 0)
+            return Socket{fd};
+        if (errno != EINTR)
+            return Socket{};
+    }
+#else
+    static_cast<void>(listener);
+    unsupported();
+#endif
+}
+
+bool readExact(const Socket& socket, std::span<std::byte> buffer)
+{
+#if defined(UV_SERVICE_SOCKETS)
+    std::size_t done{0};
+
+    while (done < buffer.size())
+    {
+        const ssize_t n{::read(socket.fd(), buffer.data() + done, buffer.size() - done)};
+
+        if (n > 0)
+        {
+            done += static_cast<std::size_t>(n);
+            continue;
+        }
+        if (n == 0)
+        {
+            if (done == 0)
+                return false;
+            errors::raise(errors::ErrorCode::FileIO, "Connection closed mid-message");
+        }
+        if (errno != EINTR)
+            raiseSystem("read", errno);
+    }
+
+    return true;
+#else
+    static_cast<void>(socket);
+    static_cast<void>(buffer);
+    unsupported();
+#endif
+}
+
+void setSendTimeout(const Socket& socket, std::chrono::microseconds timeout)
+{
+#if defined(UV_SERVICE_SOCKETS)
+    const auto us{std::max<std::chrono::microseconds::rep>(timeout.count(), 0)};
+
+    timeval tv{};
+    tv.tv_sec = static_cast<decltype(tv.tv_sec)>(us / 1000000);
+    tv.tv_usec = static_cast<decltype(tv.tv_usec)>(us % 1000000);
+
+    if (::setsockopt(socket.fd(), SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv)) != 0)
+        raiseSystem("setsockopt SO_SNDTIMEO", errno);
+#else
+    static_cast<void>(socket);
+    static_cast<void>(timeout);
+    unsupported();
+#endif
+}
+
+void writeExact(const Socket& socket, std::span<const std::byte> buffer)
+{
+#if defined(UV_SERVICE_SOCKETS)
+    std::size_t done{0};
+
+    while (done < buffer.size())
+    {
+        const ssize_t n{
+            ::send(
+                socket.fd(),
+                buffer.data() + done,
+                buffer.size() - done,
+                UV_SERVICE_SEND_FLAGS
+            )
+        };
+
+        if (n >= 0)
+            done += static_cast<std::size_t>(n);
+        else if (errno != EINTR)
+            raiseSystem("write", errno);
+    }
+#else
+    static_cast<void>(socket);
+    static_cast<void>(buffer);
+    unsupported();
+#endif
+}
+} // namespace uv::service::detail
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Service/Protocol.hpp"
+#include "Base/Errors/Errors.hpp"
+#include "Base/Macros/Unreachable.hpp"
+
+#include <format>
+#include <utility>
+
+namespace uv::service
+{
+RequestHeader makeHeader(const Request& request)
+{
+    if (request.surface.size() > MaxSurfaceNameLength)
+    {
+        errors::raise(
+            errors::ErrorCode::InvalidArgument,
+            std::format(
+                "Surface name is longer than {} bytes: '{}'",
+                MaxSurfaceNameLength,
+                request.surface
+            )
+        );
+    }
+
+    return RequestHeader{
+        .kind = request.kind,
+        .model = request.model,
+        .optionType = request.optionType,
+        .id = request.id,
+        .maturity = request.maturity,
+        .strike = request.strike,
+        .surfaceLength = static_cast<std::uint16_t>(request.surface.size())
+    };
+}
+
+void validate(const RequestHeader& header)
+{
+    const RequestHeader expected{};
+
+    if (header.magic != expected.magic || header.version != expected.version)
+    {
+        errors::raise(
+            errors::ErrorCode::DataFormat,
+            "Not a pricing service request or unsupported protocol version"
+        );
+    }
+
+    if (header.kind > RequestKind::Stats || header.model > Model::SVI ||
+        header.optionType > OptionType::Put ||
+        header.surfaceLength > MaxSurfaceNameLength)
+    {
+        errors::raise(
+            errors::ErrorCode::DataFormat,
+            std::format("Malformed pricing service request {}", header.id)
+        );
+    }
+}
+
+void validate(const Response& response)
+{
+    const Response expected{};
+
+    if (response.magic != expected.magic || response.version != expected.version ||
+        response.status > Status::PricingError)
+    {
+        errors::raise(
+            errors::ErrorCode::DataFormat,
+            "Not a pricing service response or unsupported protocol version"
+        );
+    }
+}
+
+Request makeRequest(const RequestHeader& header, std::string surface)
+{
+    return Request{
+        .id = header.id,
+        .kind = header.kind,
+        .model = header.model,
+        .optionType = header.optionType,
+        .surface = std::move(surface),
+        .maturity = header.maturity,
+        .strike = header.strike
+    };
+}
+
+std::string_view toString(Status status) noexcept
+{
+    using enum Status;
+
+    switch (status)
+    {
+    case Ok:
+        return "OK";
+    case UnknownSurface:
+        return "UNKNOWN_SURFACE";
+    case InvalidRequest:
+        return "INVALID_REQUEST";
+    case PricingError:
+        return "PRICING_ERROR";
+    }
+
+    UNREACHABLE(Status, status);
+}
+} // namespace uv::service
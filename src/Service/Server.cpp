@@ -0,0 +1,391 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Service/Server.hpp"
+#include "Base/Errors/Errors.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace uv::service
+{
+namespace
+{
+double percentile(std::span<const double> sorted, double q) noexcept
+{
+    if (sorted.empty())
+        return 0.0;
+
+    // Nearest-rank percentile.
+    const double n{static_cast<double>(sorted.size())};
+    const auto rank{static_cast<std::size_t>(std::ceil(q * n))};
+    return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+}
+} // namespace
+
+Server::Server(BatchPricer pricer, Config config)
+    : pricer_{std::move(pricer)},
+      config_{std::move(config)}
+{
+    config_.maxBatch = std::max<std::size_t>(config_.maxBatch, 1);
+    config_.latencySamples = std::max<std::size_t>(config_.latencySamples, 1);
+    config_.maxPendingResponses =
+        std::max<std::size_t>(config_.maxPendingResponses, 1);
+
+    listener_ = detail::listenUnix(config_.socketPath);
+    latencyUs_.reserve(config_.latencySamples);
+}
+
+Server::~Server()
+{
+    stop();
+}
+
+void Server::start()
+{
+    if (started_)
+        errors::raise(errors::ErrorCode::InvalidState, "Server already started");
+
+    started_ = true;
+    dispatcher_ = std::jthread{[this] { dispatchLoop(); }};
+    acceptor_ = std::jthread{[this] { acceptLoop(); }};
+}
+
+void Server::stop()
+{
+    if (!listener_)
+        return;
+
+    listener_.shutdown();
+    if (acceptor_.joinable())
+        acceptor_.join();
+
+    Vector<Session> sessions;
+    {
+        const std::lock_guard lock{connectionsMutex_};
+        sessions.swap(sessions_);
+    }
+
+    // Stop reading new requests but keep the write side open so that requests
+    // already queued still get their responses.
+    for (const Session& session : sessions)
+        session.connection->socket.shutdownRead();
+    for (Session& session : sessions)
+    {
+        if (session.reader.joinable())
+            session.reader.join();
+    }
+
+    {
+        const std::lock_guard lock{queueMutex_};
+        stopping_ = true;
+    }
+    queueReady_.notify_all();
+
+    if (dispatcher_.joinable())
+        dispatcher_.join();
+
+    // Every response is now queued, and each writer finishes once its queue is
+    // written or its client is dropped for not reading it.
+    for (Session& session : sessions)
+    {
+        if (session.writer.joinable())
+            session.writer.join();
+    }
+
+    listener_ = detail::Socket{};
+
+    std::error_code ignored;
+    std::filesystem::remove(config_.socketPath, ignored);
+}
+
+LatencySummary Server::latency() const
+{
+    Vector<double> sorted;
+    LatencySummary summary;
+
+    {
+        const std::lock_guard lock{statsMutex_};
+        sorted = latencyUs_;
+        summary = totals_;
+    }
+
+    std::sort(sorted.begin(), sorted.end());
+
+    summary.p50Us = percentile(sorted, 0.50);
+    summary.p90Us = percentile(sorted, 0.90);
+    summary.p99Us = percentile(sorted, 0.99);
+    summary.maxUs = percentile(sorted, 1.00);
+
+    return summary;
+}
+
+const std::filesystem::path& Server::socketPath() const noexcept
+{
+    return config_.socketPath;
+}
+
+void Server::acceptLoop()
+{
+    while (true)
+    {
+        detail::Socket socket{detail::acceptConnection(listener_)};
+        if (!socket)
+            return;
+
+        try
+        {
+            detail::setSendTimeout(socket, config_.writeTimeout);
+        }
+        catch (const std::exception&)
+        {
+            continue;
+        }
+
+        auto connection{std::make_shared<Connection>()};
+        connection->socket = std::move(socket);
+
+        const std::lock_guard lock{connectionsMutex_};
+
+        // Forget connections whose clients have gone. Their writers have finished
+        // and their readers have or are about to, so erasing joins them here, on
+        // the acceptor thread.
+        std::erase_if(
+            sessions_,
+            [](const Session& session) { return session.connection->closed.load(); }
+        );
+
+        std::jthread reader{[this, connection] { readLoop(connection); }};
+        std::jthread writer{[this, connection] { writeLoop(connection); }};
+        sessions_.push_back(
+            {std::move(connection), std::move(reader), std::move(writer)}
+        );
+    }
+}
+
+void Server::readLoop(const std::shared_ptr<Connection>& connection)
+{
+    try
+    {
+        while (true)
+        {
+            RequestHeader header{};
+            if (!detail::readExact(
+                    connection->socket,
+                    std::as_writable_bytes(std::span{&header, 1})
+                ))
+                break;
+
+            validate(header);
+
+            std::string surface(header.surfaceLength, '\0');
+            if (!surface.empty() &&
+                !detail::readExact(
+                    connection->socket,
+                    std::as_writable_bytes(std::span{surface})
+                ))
+                break;
+
+            {
+                const std::lock_guard lock{connection->outboxMutex};
+                ++connection->inFlight;
+            }
+            {
+                const std::lock_guard lock{queueMutex_};
+                queue_.push_back(
+                    {makeRequest(header, std::move(surface)), connection, Clock::now()}
+                );
+            }
+            queueReady_.notify_one();
+        }
+    }
+    catch (const std::exception&)
+    {
+        // A malformed frame leaves the stream unreadable, so the connection is
+        // dropped; other clients are unaffected.
+    }
+
+    {
+        const std::lock_guard lock{connection->outboxMutex};
+        connection->readDone = true;
+    }
+    connection->outboxReady.notify_one();
+}
+
+void Server::writeLoop(const std::shared_ptr<Connection>& connection)
+{
+    Connection& c{*connection};
+    std::unique_lock lock{c.outboxMutex};
+
+    while (true)
+    {
+        c.outboxReady.wait(
+            lock,
+            [&]
+            {
+                return c.dropped || !c.outbox.empty() ||
+                       (c.readDone && c.inFlight == 0);
+            }
+        );
+
+        if (c.dropped || c.outbox.empty())
+            break;
+
+        const Response response{c.outbox.front()};
+        c.outbox.pop_front();
+        lock.unlock();
+
+        bool written{true};
+        try
+        {
+            detail::writeExact(c.socket, std::as_bytes(std::span{&response, 1}));
+        }
+        catch (const std::exception&)
+        {
+            // The client has gone or has stopped reading for longer than the
+            // write timeout.
+            written = false;
+        }
+
+        lock.lock();
+
+        if (!written)
+        {
+            drop(c);
+            break;
+        }
+        --c.inFlight;
+    }
+
+    lock.unlock();
+
+    // Everything the client asked for has been answered, so its end of the stream
+    // is closed too; this also ends a reader left on a malformed frame.
+    c.socket.shutdown();
+    c.closed.store(true);
+}
+
+void Server::dispatchLoop()
+{
+    Vector<Pending> batch;
+    Vector<Request> requests;
+    Vector<Response> responses;
+
+    while (true)
+    {
+        {
+            std::unique_lock lock{queueMutex_};
+            queueReady_.wait(lock, [&] { return stopping_ || !queue_.empty(); });
+
+            if (queue_.empty())
+                return;
+
+            if (config_.batchWindow.count() > 0 && !stopping_ &&
+                queue_.size() < config_.maxBatch)
+            {
+                queueReady_.wait_for(
+                    lock,
+                    config_.batchWindow,
+                    [&] { return stopping_ || queue_.size() >= config_.maxBatch; }
+                );
+            }
+
+            const std::size_t n{std::min(queue_.size(), config_.maxBatch)};
+
+            batch.clear();
+            for (std::size_t i{0}; i < n; ++i)
+            {
+                batch.push_back(std::move(queue_.front()));
+                queue_.pop_front();
+            }
+        }
+
+        requests.clear();
+        for (const Pending& pending : batch)
+            requests.push_back(pending.request);
+
+        responses.resize(batch.size());
+        const std::size_t pricingCalls{pricer_.price(requests, responses)};
+
+        // The summary copies and sorts every latency sample, so it is only taken
+        // for batches that actually ask for it.
+        const auto isStats = [](const Request& request) noexcept
+        { return request.kind == RequestKind::Stats; };
+
+        if (std::any_of(requests.begin(), requests.end(), isStats))
+        {
+            const LatencySummary summary{latency()};
+            for (std::size_t i{0}; i < batch.size(); ++i)
+            {
+                if (!isStats(requests[i]))
+                    continue;
+
+                responses[i] = Response{
+                    .id = requests[i].id,
+                    .values = {
+                        static_cast<double>(summary.requests),
+                        summary.p50Us,
+                        summary.p99Us,
+                        summary.maxUs
+                    }
+                };
+            }
+        }
+
+        for (std::size_t i{0}; i < batch.size(); ++i)
+            deliver(*batch[i].connection, responses[i]);
+
+        record(batch, pricingCalls);
+    }
+}
+
+void Server::deliver(Connection& connection, const Response& response)
+{
+    {
+        const std::lock_guard lock{connection.outboxMutex};
+
+        if (connection.dropped)
+            return;
+
+        if (connection.outbox.size() >= config_.maxPendingResponses)
+            drop(connection);
+        else
+            connection.outbox.push_back(response);
+    }
+    connection.outboxReady.notify_one();
+}
+
+void Server::drop(Connection& connection) noexcept
+{
+    connection.dropped = true;
+    connection.outbox.clear();
+    connection.socket.shutdown();
+}
+
+void Server::record(std::span<const Pending> batch, std::size_t pricingCalls)
+{
+    const auto now{Clock::now()};
+    const std::lock_guard lock{statsMutex_};
+
+    for (const Pending& pending : batch)
+    {
+        const double us{
+            std::chrono::duration<double, std::micro>(now - pending.received).count()
+        };
+
+        if (latencyUs_.size() < config_.latencySamples)
+            latencyUs_.push_back(us);
+        else
+            latencyUs_[nextSample_] = us;
+
+        nextSample_ = (nextSample_ + 1) % config_.latencySamples;
+    }
+
+    totals_.requests += batch.size();
+    totals_.batches += 1;
+    totals_.pricingCalls += pricingCalls;
+}
+} // namespace uv::service
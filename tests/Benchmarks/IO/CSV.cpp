@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "IO/CSV/Detail/Read.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <sstream>
+#include <string>
+
+namespace
+{
+std::string makeSurfaceCsv(std::size_t rows, std::size_t cols)
+{
+    std::string csv{"T"};
+
+    const double dK{1.0 / static_cast<double>(cols)};
+
+    for (std::size_t j{0}; j < cols; ++j)
+        csv += std::format(",{:.4f}", 0.5 + dK * static_cast<double>(j));
+
+    csv += '\n';
+
+    for (std::size_t i{0}; i < rows; ++i)
+    {
+        csv += std::format("{:.6f}", 0.05 + 0.1 * static_cast<double>(i));
+
+        for (std::size_t j{0}; j < cols; ++j)
+            csv += std::format(",{:.6f}", 0.2 + 0.001 * static_cast<double>(i + j));
+
+        csv += '\n';
+    }
+
+    return csv;
+}
+} // namespace
+
+static void BM_ReadLabeledDense(benchmark::State& state)
+{
+    const auto rows{static_cast<std::size_t>(state.range(0))};
+    const std::string csv{makeSurfaceCsv(rows, 32)};
+
+    for (auto _ : state)
+    {
+        std::istringstream in{csv};
+        benchmark::DoNotOptimize(
+            uv::io::csv::detail::readLabeledDenseOrThrow<double>(in, "benchmark")
+        );
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(csv.size()));
+}
+BENCHMARK(BM_ReadLabeledDense)->RangeMultiplier(4)->Range(8, 2048);
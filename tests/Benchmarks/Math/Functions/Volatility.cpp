@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Math/Functions/Black.hpp"
+#include "Math/Functions/Volatility.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+constexpr double t{0.5};
+constexpr double dF{0.98};
+constexpr double F{100.0};
+
+std::vector<double> makeStrikes(std::size_t n)
+{
+    std::vector<double> strikes(n);
+
+    for (std::size_t j{0}; j < n; ++j)
+        strikes[j] = 60.0 + 80.0 * static_cast<double>(j) / static_cast<double>(n);
+
+    return strikes;
+}
+} // namespace
+
+static void BM_PriceB76(benchmark::State& state)
+{
+    const auto n{static_cast<std::size_t>(state.range(0))};
+    const std::vector<double> strikes{makeStrikes(n)};
+    const std::vector<double> vols(n, 0.25);
+    std::vector<double> out(n);
+
+    for (auto _ : state)
+    {
+        uv::math::black::priceB76<double>(out, t, dF, F, vols, strikes, false);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PriceB76)->RangeMultiplier(8)->Range(8, 4096);
+
+static void BM_ImpliedVol(benchmark::State& state)
+{
+    const auto n{static_cast<std::size_t>(state.range(0))};
+    const std::vector<double> strikes{makeStrikes(n)};
+    const std::vector<double> vols(n, 0.25);
+    std::vector<double> prices(n);
+    std::vector<double> out(n);
+
+    uv::math::black::priceB76<double>(prices, t, dF, F, vols, strikes, false);
+
+    for (auto _ : state)
+    {
+        uv::math::vol::impliedVol<double>(out, prices, t, dF, F, strikes, false);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ImpliedVol)->RangeMultiplier(8)->Range(8, 4096);
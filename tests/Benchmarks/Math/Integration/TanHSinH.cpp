@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Math/Integration/TanHSinH.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+
+// Decay rate sets how early the quadrature exits; larger N only helps slow tails.
+template <std::size_t N> static void BM_IntegrateZeroToInf(benchmark::State& state)
+{
+    const uv::math::integration::TanHSinH<double, N> quad;
+    const double decay{static_cast<double>(state.range(0)) / 8.0};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            quad.integrateZeroToInf([decay](double x)
+                                    { return std::exp(-decay * x) * std::cos(x); })
+        );
+    }
+}
+BENCHMARK_TEMPLATE(BM_IntegrateZeroToInf, 32)->Arg(1)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(BM_IntegrateZeroToInf, 64)->Arg(1)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(BM_IntegrateZeroToInf, 128)->Arg(1)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(BM_IntegrateZeroToInf, 256)->Arg(1)->Arg(8)->Arg(64);
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Math/Interpolation/BSpline/Interpolator.hpp"
+#include "Math/Interpolation/Hermite/Interpolator.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t controlPointCount{64};
+
+std::vector<double> makeGrid(double left, double right, std::size_t size)
+{
+    std::vector<double> x(size);
+    const double dx{(right - left) / static_cast<double>(size - 1)};
+
+    for (std::size_t i{0}; i < size; ++i)
+        x[i] = left + static_cast<double>(i) * dx;
+
+    return x;
+}
+
+std::vector<double> makeOpenUniformCubicKnots()
+{
+    std::vector<double> knots(4, 0.0);
+    const std::size_t interiorCount{controlPointCount - 4};
+
+    for (std::size_t i{1}; i <= interiorCount; ++i)
+        knots.push_back(static_cast<double>(i));
+
+    knots.insert(knots.end(), 4, static_cast<double>(interiorCount + 1));
+
+    return knots;
+}
+
+std::vector<double> smooth(const std::vector<double>& x)
+{
+    std::vector<double> y(x.size());
+
+    for (std::size_t i{0}; i < x.size(); ++i)
+        y[i] = 0.2 + 0.05 * std::sin(0.17 * x[i]) + 0.03 * std::cos(0.11 * x[i]);
+
+    return y;
+}
+} // namespace
+
+static void BM_BSplineEvalInplace(benchmark::State& state)
+{
+    const std::vector<double> knots{makeOpenUniformCubicKnots()};
+    const std::vector<double> controlPoints{
+        smooth(makeGrid(0.0, 63.0, controlPointCount))
+    };
+    const uv::math::interp::bspline::BSpline<double, 3> spline{controlPoints, knots};
+
+    const std::vector<double> x{makeGrid(
+        knots[3],
+        knots[controlPointCount],
+        static_cast<std::size_t>(state.range(0))
+    )};
+    std::vector<double> out(x.size());
+
+    for (auto _ : state)
+    {
+        spline.evalInplace(out, x);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BSplineEvalInplace)->RangeMultiplier(8)->Range(64, 262144);
+
+static void BM_PchipInterpolate(benchmark::State& state)
+{
+    const std::vector<double> xs{makeGrid(-1.5, 1.5, 32)};
+    const std::vector<double> ys{smooth(xs)};
+    const std::vector<double> x{
+        makeGrid(-1.4, 1.4, static_cast<std::size_t>(state.range(0)))
+    };
+
+    const uv::math::interp::hermite::PchipInterpolator<double> pchip{};
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(pchip(x, xs, ys, false));
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PchipInterpolate)->RangeMultiplier(8)->Range(64, 262144);
@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Math/LinearAlgebra/Tridiagonal.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <vector>
+
+static void BM_ThomasSolve(benchmark::State& state)
+{
+    const auto n{static_cast<std::size_t>(state.range(0))};
+
+    const std::vector<double> upper(n, -1.0);
+    const std::vector<double> middle(n, 4.0);
+    const std::vector<double> lower(n, -1.0);
+    const std::vector<double> rhs(n, 1.0);
+    std::vector<double> x(n);
+    std::vector<double> scratch(n);
+
+    for (auto _ : state)
+    {
+        x = rhs;
+        uv::math::linear_algebra::thomasSolve<double>(
+            x,
+            upper,
+            middle,
+            lower,
+            scratch,
+            false
+        );
+        benchmark::DoNotOptimize(x.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ThomasSolve)->RangeMultiplier(8)->Range(64, 262144);
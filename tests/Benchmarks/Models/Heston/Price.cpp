@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Models/Heston/Price/Pricer.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <vector>
+
+namespace
+{
+using uv::Complex;
+
+constexpr double kappa{2.0};
+constexpr double theta{0.04};
+constexpr double sigma{0.35};
+constexpr double rho{-0.65};
+constexpr double v0{0.05};
+constexpr double t{1.0};
+
+std::vector<double> makeNodes(std::size_t n)
+{
+    std::vector<double> x(n);
+
+    for (std::size_t i{0}; i < n; ++i)
+        x[i] = 0.05 + 40.0 * static_cast<double>(i) / static_cast<double>(n);
+
+    return x;
+}
+
+uv::models::heston::price::detail::Integrand<double> makeIntegrand(double w)
+{
+    constexpr Complex<double> i{0.0, 1.0};
+    constexpr double alpha{-0.75};
+    const double tanPhi{std::tan(-0.2)};
+    const double sigma2{sigma * sigma};
+
+    return {
+        .iAlpha = {0.0, -alpha},
+        .onePlusITanPhi = {1.0, tanPhi},
+        .c = {-tanPhi * w, w},
+        .tDivTwo = {-t * 0.5},
+        .sigmaRho = {-i * (sigma * rho)},
+        .kappa = kappa,
+        .kappaThetaDivSigma2 = kappa * theta / sigma2,
+        .sigma2 = sigma2,
+        .v0 = v0,
+        .t = t
+    };
+}
+
+uv::models::heston::price::detail::BatchIntegrand<double> makeBatchIntegrand(double w)
+{
+    constexpr Complex<double> i{0.0, 1.0};
+    constexpr double alpha{-0.75};
+    const double tanPhi{std::tan(-0.2)};
+    const double sigma2{sigma * sigma};
+    const double invSigma2{1.0 / sigma2};
+    const double invSigma3{invSigma2 / sigma};
+
+    return {
+        .sigmaRho = {-i * sigma * rho},
+        .tDivTwo = {-t * 0.5},
+        .iAlpha = {-i * alpha},
+        .onePlusITanPhi = {1.0 + i * tanPhi},
+        .dbetaDk = {1.0, 0.0},
+        .c = {(i - tanPhi) * w},
+        .kappa = kappa,
+        .invSigma2 = invSigma2,
+        .kappaThetaDivSigma2 = {kappa * theta * invSigma2},
+        .sigma = sigma,
+        .sigma2 = sigma2,
+        .rho = rho,
+        .v0 = v0,
+        .t = t,
+        .invTheta = {1.0 / theta},
+        .dKdk = {theta * invSigma2},
+        .dKds = {-2.0 * kappa * theta * invSigma3},
+        .invSigma3Two = {-2.0 * invSigma3}
+    };
+}
+} // namespace
+
+static void BM_CharFunction(benchmark::State& state)
+{
+    constexpr Complex<double> i{0.0, 1.0};
+    const std::vector<double> nodes{makeNodes(static_cast<std::size_t>(state.range(0)))};
+    const double sigma2{sigma * sigma};
+
+    for (auto _ : state)
+    {
+        for (const double x : nodes)
+        {
+            benchmark::DoNotOptimize(uv::models::heston::price::detail::charFunction(
+                kappa,
+                kappa * theta / sigma2,
+                sigma2,
+                v0,
+                t,
+                Complex<double>{-t * 0.5},
+                Complex<double>{-i * (sigma * rho)},
+                Complex<double>{x, -0.25}
+            ));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CharFunction)->RangeMultiplier(4)->Range(16, 1024);
+
+static void BM_Integrand(benchmark::State& state)
+{
+    const std::vector<double> nodes{makeNodes(static_cast<std::size_t>(state.range(0)))};
+    const auto integrand{makeIntegrand(0.1)};
+
+    for (auto _ : state)
+    {
+        for (const double x : nodes)
+            benchmark::DoNotOptimize(integrand(x));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Integrand)->RangeMultiplier(4)->Range(16, 1024);
+
+static void BM_BatchIntegrand(benchmark::State& state)
+{
+    const std::vector<double> nodes{makeNodes(static_cast<std::size_t>(state.range(0)))};
+    const auto integrand{makeBatchIntegrand(0.1)};
+
+    for (auto _ : state)
+    {
+        for (const double x : nodes)
+            benchmark::DoNotOptimize(integrand(x));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BatchIntegrand)->RangeMultiplier(4)->Range(16, 1024);
+
+static void BM_HestonCallPriceStrip(benchmark::State& state)
+{
+    const auto numStrikes{static_cast<std::size_t>(state.range(0))};
+
+    const double dK{100.0 / static_cast<double>(numStrikes)};
+
+    std::vector<double> strikes(numStrikes);
+    for (std::size_t j{0}; j < numStrikes; ++j)
+        strikes[j] = 60.0 + dK * static_cast<double>(j);
+
+    std::vector<double> out(numStrikes);
+
+    uv::models::heston::price::Pricer<double> pricer{};
+    pricer.setParams({kappa, theta, sigma, rho, v0});
+
+    for (auto _ : state)
+    {
+        pricer.callPrice(out, t, 0.97, 102.0, strikes, false);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HestonCallPriceStrip)->RangeMultiplier(4)->Range(4, 256);
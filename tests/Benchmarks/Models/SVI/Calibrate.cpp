@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Models/SVI/Calibrate/Detail/Constraints.hpp"
+#include "Models/SVI/Calibrate/Detail/Contexts.hpp"
+#include "Models/SVI/Calibrate/Detail/Objective.hpp"
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+// b, rho, m, sigma in the optimizer's parameterization.
+constexpr std::array<double, 4> x{0.1, -0.4, 0.02, 0.2};
+constexpr double atm{0.04};
+
+struct Slice
+{
+    std::vector<double> logKF;
+    std::vector<double> totalVariance;
+
+    explicit Slice(std::size_t n)
+        : logKF(n),
+          totalVariance(n)
+    {
+        for (std::size_t j{0}; j < n; ++j)
+        {
+            const double k{-1.0 + 2.0 * static_cast<double>(j) / static_cast<double>(n)};
+            logKF[j] = k;
+            totalVariance[j] = atm + 0.1 * (-0.4 * k + std::sqrt(k * k + 0.04));
+        }
+    }
+};
+} // namespace
+
+static void BM_SVIObjective(benchmark::State& state)
+{
+    const Slice slice{static_cast<std::size_t>(state.range(0))};
+    uv::models::svi::detail::ObjectiveContexts ctx{slice.logKF, slice.totalVariance, atm};
+    std::array<double, 4> grad{};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            uv::models::svi::detail::objectiveThunk(4, x.data(), grad.data(), &ctx)
+        );
+        benchmark::DoNotOptimize(grad.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SVIObjective)->RangeMultiplier(4)->Range(8, 512);
+
+static void BM_SVICalendarConstraint(benchmark::State& state)
+{
+    const Slice slice{static_cast<std::size_t>(state.range(0))};
+    const std::vector<double> prevWk(slice.logKF.size(), 0.5 * atm);
+    uv::models::svi::detail::CalendarMContext ctx{slice.logKF, prevWk, atm, 1e-9};
+
+    const auto m{static_cast<unsigned>(slice.logKF.size())};
+    std::vector<double> result(m);
+    std::vector<double> grad(4 * m);
+
+    for (auto _ : state)
+    {
+        uv::models::svi::detail::calendarMConstraint(
+            m,
+            result.data(),
+            4,
+            x.data(),
+            grad.data(),
+            &ctx
+        );
+        benchmark::DoNotOptimize(result.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SVICalendarConstraint)->RangeMultiplier(4)->Range(8, 512);
+
+static void BM_SVIConvexityConstraint(benchmark::State& state)
+{
+    const Slice slice{static_cast<std::size_t>(state.range(0))};
+    uv::models::svi::detail::ConvexityMContext ctx{slice.logKF, atm};
+
+    const auto m{static_cast<unsigned>(slice.logKF.size())};
+    std::vector<double> result(m);
+    std::vector<double> grad(4 * m);
+
+    for (auto _ : state)
+    {
+        uv::models::svi::detail::convexityMConstraint(
+            m,
+            result.data(),
+            4,
+            x.data(),
+            grad.data(),
+            &ctx
+        );
+        benchmark::DoNotOptimize(result.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SVIConvexityConstraint)->RangeMultiplier(4)->Range(8, 512);
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: Apache-2.0
+"""Compare a Google Benchmark JSON run against a stored baseline.
+
+Entries are matched by benchmark name. When a run contains repetitions, the
+median aggregate is used; otherwise the single iteration entry is used. A
+benchmark regresses when its time exceeds the baseline by more than the
+threshold, in which case the script exits with status 1.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path, metric):
+    with open(path, encoding="utf-8") as f:
+        report = json.load(f)
+
+    times = {}
+    medians = {}
+
+    for entry in report.get("benchmarks", []):
+        if entry.get("error_occurred"):
+            continue
+
+        name = entry.get("run_name", entry["name"])
+
+        if entry.get("run_type") == "aggregate":
+            if entry.get("aggregate_name") == "median":
+                medians[name] = entry[metric]
+        else:
+            times.setdefault(name, entry[metric])
+
+    times.update(medians)
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline", help="baseline JSON report")
+    parser.add_argument("current", help="current JSON report")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.10,
+        help="relative slowdown treated as a regression (default: 0.10)",
+    )
+    parser.add_argument(
+        "--metric",
+        choices=("cpu_time", "real_time"),
+        default="cpu_time",
+        help="time field to compare (default: cpu_time)",
+    )
+    args = parser.parse_args()
+
+    baseline = load(args.baseline, args.metric)
+    current = load(args.current, args.metric)
+
+    regressions = []
+    print(f"{'Benchmark':<44} {'Baseline':>12} {'Current':>12} {'Change':>9}")
+
+    for name in sorted(current):
+        if name not in baseline:
+            print(f"{name:<44} {'-':>12} {current[name]:>12.1f} {'new':>9}")
+            continue
+
+        base = baseline[name]
+        change = current[name] / base - 1.0 if base > 0.0 else 0.0
+        flag = ""
+
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions.append(name)
+        elif change < -args.threshold:
+            flag = "  improved"
+
+        print(
+            f"{name:<44} {base:>12.1f} {current[name]:>12.1f} "
+            f"{change:>+8.1%}{flag}"
+        )
+
+    for name in sorted(set(baseline) - set(current)):
+        print(f"{name:<44} {baseline[name]:>12.1f} {'-':>12} {'missing':>9}")
+
+    if regressions:
+        print(
+            f"\n{len(regressions)} benchmark(s) regressed by more than "
+            f"{args.threshold:.0%}: {', '.join(regressions)}"
+        )
+        return 1
+
+    print(f"\nNo regressions beyond {args.threshold:.0%}.")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -3,10 +3,13 @@
 #include "IO/CSV/Load.hpp"
 #include "Math/Functions/Black.hpp"
 #include "Math/Functions/Volatility.hpp"
+#include "Math/PDE/Pricer.hpp"
+#include "Support/TempFile.hpp"
 
 #include <cmath>
 #include <filesystem>
 #include <gtest/gtest.h>
+#include <sstream>
 #include <vector>
 
 TEST(IntegrationLoadAndReport, LoadsExampleCsv)
@@ -27,6 +30,63 @@ TEST(IntegrationLoadAndReport, LoadsExampleCsv)
     EXPECT_DOUBLE_EQ(marketState.volSurface.vol()[0][0], 1.03987);
 }
 
+TEST(IntegrationLoadAndReport, DeAmericanizesPremiumCsvIntoEuropeanVols)
+{
+    const uv::core::MarketData<double> marketData{
+        .interestRate = 0.04,
+        .dividendYield = 0.0,
+        .spot = 100.0
+    };
+    const std::vector<double> maturities{0.5, 1.0};
+    const std::vector<double> moneyness{0.9, 1.0, 1.1};
+    const double vol{0.3};
+
+    uv::math::pde::Pricer<double> pricer{
+        uv::math::pde::DeAmericanizeConfig<double>{}.grid
+    };
+
+    std::ostringstream csv;
+    csv.precision(17);
+    csv << ",0.9,1.0,1.1\n";
+
+    for (const double t : maturities)
+    {
+        const double F{marketData.spot * std::exp(marketData.interestRate * t)};
+        csv << t;
+
+        for (const double m : moneyness)
+        {
+            const double K{marketData.spot * m};
+            csv << ","
+                << pricer.price(
+                       t,
+                       marketData.interestRate,
+                       marketData.dividendYield,
+                       vol,
+                       marketData.spot,
+                       K,
+                       K >= F,
+                       uv::math::pde::Exercise::American
+                   );
+        }
+
+        csv << "\n";
+    }
+
+    const auto path = uv::tests::writeTempFile("uv_american_premiums.csv", csv.str());
+    const auto marketState =
+        uv::io::csv::load::marketStateFromAmericanPrices(path, marketData);
+
+    ASSERT_EQ(marketState.volSurface.numMaturities(), 2U);
+    ASSERT_EQ(marketState.volSurface.numStrikes(), 3U);
+
+    for (std::size_t i{0}; i < 2; ++i)
+    {
+        for (std::size_t j{0}; j < 3; ++j)
+            EXPECT_NEAR(marketState.volSurface.vol()[i][j], vol, 1e-6);
+    }
+}
+
 TEST(IntegrationLoadAndDerivedResults, ComputesDerivedResultsForMarketState)
 {
     const std::vector<double> maturities{0.5, 1.0};
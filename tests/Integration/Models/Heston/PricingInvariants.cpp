@@ -132,3 +132,28 @@ TEST(IntegrationHestonPricingInvariants, SurfacePricesStayWithinNoArbitrageBound
         }
     }
 }
+
+TEST(IntegrationHestonPricingInvariants, ForwardLadderMatchesScalarPrices)
+{
+    uv::models::heston::price::Pricer<double, 160> pricer{};
+    pricer.setParams({2.0, 0.04, 0.30, -0.70, 0.04});
+
+    constexpr double t = 0.75;
+    const std::array<double, 11> forwards{
+        70.0, 80.0, 90.0, 95.0, 99.0, 100.0, 101.0, 105.0, 110.0, 120.0, 140.0
+    };
+    std::array<double, 11> discountFactors{};
+    discountFactors.fill(0.97);
+
+    for (double K : {60.0, 100.0, 150.0})
+    {
+        std::array<double, 11> prices{};
+        pricer.callPriceForwards(prices, t, discountFactors, forwards, K);
+
+        for (std::size_t m = 0; m < forwards.size(); ++m)
+        {
+            EXPECT_NEAR(prices[m], pricer.callPrice(t, 0.97, forwards[m], K), 1e-12)
+                << "F=" << forwards[m] << " K=" << K;
+        }
+    }
+}
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Errors/Errors.hpp"
+#include "Core/QuoteUpdate.hpp"
+#include "IO/CSV/Load.hpp"
+#include "IO/CSV/Ticks.hpp"
+#include "Models/Intraday/Engine.hpp"
+#include "Models/SVI/Calibrate/Calibrate.hpp"
+#include "Models/SVI/Calibrate/Config.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <span>
+
+namespace
+{
+uv::core::MarketState<double> loadSPY()
+{
+    const uv::core::MarketData<double> marketData{
+        .interestRate = 0.0,
+        .dividendYield = 0.0,
+        .spot = 485.77548
+    };
+
+    return uv::io::csv::load::marketState(
+        std::filesystem::path{"data/VolSurface_SPY_04072011.csv"},
+        marketData
+    );
+}
+
+const uv::models::intraday::Config sviOnly{.recalibrateHeston = false};
+} // namespace
+
+TEST(IntegrationModelsIntradayEngine, MarksQuotedMaturitiesDirty)
+{
+    uv::models::intraday::Engine<double> engine{loadSPY(), sviOnly};
+
+    engine.apply(uv::core::QuoteUpdate<double>{1, 0.25, 1.0, 0.3302});
+    engine.apply(uv::core::QuoteUpdate<double>{1, 1.0, 0.9, 0.2531});
+
+    EXPECT_EQ(engine.dirtySlices(), (uv::Vector<std::size_t>{2, 7}));
+    EXPECT_DOUBLE_EQ(engine.marketState().volSurface.vol()[2][8], 0.33121);
+
+    const auto stats = engine.recalibrate();
+
+    EXPECT_EQ(stats.quotes, 2U);
+    EXPECT_TRUE(engine.dirtySlices().empty());
+    EXPECT_DOUBLE_EQ(engine.marketState().volSurface.vol()[2][8], 0.3302);
+}
+
+TEST(IntegrationModelsIntradayEngine, RefitsDirtySliceAndItsSuccessorOnly)
+{
+    uv::models::intraday::Engine<double> engine{loadSPY(), sviOnly};
+    const auto before = engine.sviParams();
+
+    engine.apply(uv::core::QuoteUpdate<double>{1, 0.25, 1.0, 0.3302});
+    const auto stats = engine.recalibrate();
+
+    ASSERT_GE(stats.refitSlices.size(), 2U);
+    EXPECT_EQ(stats.refitSlices[0], 2U);
+    EXPECT_EQ(stats.refitSlices[1], 3U);
+    EXPECT_TRUE(std::is_sorted(stats.refitSlices.begin(), stats.refitSlices.end()));
+
+    for (std::size_t i{0}; i < 2; ++i)
+    {
+        EXPECT_EQ(engine.sviParams()[i].a, before[i].a);
+        EXPECT_EQ(engine.sviParams()[i].b, before[i].b);
+    }
+}
+
+TEST(IntegrationModelsIntradayEngine, RefitMatchesFullCalibrationOfDirtySlice)
+{
+    uv::models::intraday::Engine<double> engine{loadSPY(), sviOnly};
+
+    engine.apply(uv::core::QuoteUpdate<double>{1, 0.5, 1.0, 0.2811});
+    static_cast<void>(engine.recalibrate());
+
+    // Slices before the dirty one are untouched, so a full calibration of the
+    // updated surface sees the same seed and calendar bound for it.
+    const uv::opt::nlopt::Optimizer<4, uv::opt::nlopt::Algorithm::LD_SLSQP> optimizer{
+        uv::models::svi::detail::makeNLoptConfig(sviOnly.svi)
+    };
+    const auto full =
+        uv::models::svi::calibrate(engine.marketState().volSurface, optimizer);
+
+    const auto& p = engine.sviParams()[5];
+    EXPECT_NEAR(p.a, full[5].a, 1e-10);
+    EXPECT_NEAR(p.b, full[5].b, 1e-10);
+    EXPECT_NEAR(p.rho, full[5].rho, 1e-10);
+    EXPECT_NEAR(p.m, full[5].m, 1e-10);
+    EXPECT_NEAR(p.sigma, full[5].sigma, 1e-10);
+}
+
+TEST(IntegrationModelsIntradayEngine, ReplaysRecordedTicksWithWarmStartedHeston)
+{
+    uv::models::intraday::Engine<double> engine{loadSPY()};
+    const auto initial = engine.hestonParams();
+
+    const auto ticks = uv::io::csv::readTicks("data/ticks_SPY_04072011.csv");
+    const auto updates = uv::models::intraday::replay(
+        engine,
+        std::span<const uv::core::QuoteUpdate<double>>{ticks}
+    );
+
+    ASSERT_EQ(updates.size(), ticks.back().seq);
+    EXPECT_EQ(updates[1].quotes, 2U);
+
+    for (const auto& u : updates)
+    {
+        EXPECT_FALSE(u.refitSlices.empty());
+        EXPECT_GE(u.totalMs, u.sviMs);
+    }
+
+    // Small quote moves keep the warm-started parameters close to the initial fit.
+    const auto& p = engine.hestonParams();
+    EXPECT_TRUE(std::isfinite(p.kappa) && std::isfinite(p.v0));
+    EXPECT_NEAR(p.v0, initial.v0, 0.25 * initial.v0);
+    EXPECT_NEAR(p.rho, initial.rho, 0.1);
+}
+
+TEST(IntegrationModelsIntradayEngine, RejectsQuotesOffTheGrid)
+{
+    uv::models::intraday::Engine<double> engine{loadSPY(), sviOnly};
+
+    EXPECT_THROW(
+        engine.apply(uv::core::QuoteUpdate<double>{1, 0.3, 1.0, 0.3}),
+        uv::errors::UnifiedVolError
+    );
+    EXPECT_THROW(
+        engine.apply(uv::core::QuoteUpdate<double>{1, 0.25, 0.97, 0.3}),
+        uv::errors::UnifiedVolError
+    );
+    EXPECT_THROW(
+        engine.apply(uv::core::QuoteUpdate<double>{1, 0.25, 1.0, -0.1}),
+        uv::errors::UnifiedVolError
+    );
+
+    EXPECT_TRUE(engine.dirtySlices().empty());
+    EXPECT_TRUE(engine.recalibrate().refitSlices.empty());
+}
@@ -5,7 +5,10 @@
 #include "Models/SVI/Calibrate/Calibrate.hpp"
 #include "Models/SVI/Calibrate/Config.hpp"
 #include "Optimization/NLopt/Optimizer.hpp"
+#include "Optimization/Stop.hpp"
 
+#include <chrono>
+#include <cstddef>
 #include <gtest/gtest.h>
 #include <limits>
 #include <span>
@@ -121,3 +124,43 @@ TEST(IntegrationSVICalibrationValidation, RejectsInvalidSliceData)
         uv::errors::UnifiedVolError
     );
 }
+
+TEST(IntegrationSVICalibrationValidation, ExpiredDeadlineReturnsTruncatedSurface)
+{
+    const std::vector<double> maturities{0.25, 0.5, 1.0};
+    const std::vector<double> k{-0.2, -0.1, 0.0, 0.1, 0.2};
+
+    uv::core::Matrix<double> logKF{maturities.size(), k.size()};
+    uv::core::Matrix<double> totalVariance{maturities.size(), k.size()};
+    for (std::size_t i{0}; i < maturities.size(); ++i)
+    {
+        for (std::size_t j{0}; j < k.size(); ++j)
+        {
+            logKF[i][j] = k[j];
+            totalVariance[i][j] = maturities[i] * (0.04 + 0.1 * k[j] * k[j]);
+        }
+    }
+
+    const uv::models::svi::Config config{
+        .maxEval = 100,
+        .verbose = false,
+        .stop = uv::opt::StopCondition::within(std::chrono::seconds{-1})
+    };
+    const SVIOptimizer optimizer{uv::models::svi::detail::makeNLoptConfig(config)};
+
+    // NLopt signals the forced stop by throwing; the optimizer must turn that into a
+    // truncated result holding the best point so far.
+    uv::opt::Result<std::vector<uv::models::svi::Params<double>>> result{{}};
+    ASSERT_NO_THROW(
+        result = uv::models::svi::calibrateWithStatus(
+            std::span<const double>{maturities},
+            logKF,
+            totalVariance,
+            optimizer
+        )
+    );
+
+    EXPECT_TRUE(result.truncated());
+    EXPECT_EQ(result.termination, uv::opt::Termination::DeadlineExceeded);
+    EXPECT_EQ(result.params.size(), maturities.size());
+}
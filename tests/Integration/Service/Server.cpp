@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Service/Client.hpp"
+#include "Service/Detail/Socket.hpp"
+#include "Service/Server.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <gtest/gtest.h>
+#include <exception>
+#include <random>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace uv::service;
+
+namespace
+{
+const std::vector<double> maturities{0.25, 0.5, 1.0};
+
+CalibratedSurface makeSurface()
+{
+    uv::Vector<uv::models::svi::Params<double>> svi;
+    for (const double t : maturities)
+        svi.emplace_back(t, 0.04 * t, 0.0, 0.0, 0.0, 0.1);
+
+    return CalibratedSurface{
+        .name = "TEST",
+        .marketData = {.interestRate = 0.03, .dividendYield = 0.01, .spot = 100.0},
+        .sviParams = svi,
+        .hestonParams = {2.0, 0.04, 0.3, -0.7, 0.04}
+    };
+}
+
+std::filesystem::path socketPath(std::string_view name)
+{
+    return std::filesystem::temp_directory_path() /
+           std::format("uv_{}_{}.sock", name, std::random_device{}());
+}
+
+Request priceRequest(std::uint64_t id, double K)
+{
+    return Request{.id = id, .surface = "TEST", .maturity = 0.5, .strike = K};
+}
+} // namespace
+
+TEST(IntegrationServiceServer, BatchesPipelinedRequests)
+{
+    if (!detail::socketsSupported())
+        GTEST_SKIP() << "Unix-domain sockets are not available";
+
+    Server server{
+        BatchPricer{{makeSurface()}},
+        Config{
+            .socketPath = socketPath("batch"),
+            .batchWindow = std::chrono::milliseconds{5}
+        }
+    };
+    server.start();
+
+    Client client{server.socketPath()};
+
+    std::vector<Request> requests;
+    for (std::size_t i{0}; i < 32; ++i)
+        requests.push_back(priceRequest(i, 80.0 + static_cast<double>(i)));
+
+    const uv::Vector<Response> responses{client.call(requests)};
+
+    ASSERT_EQ(responses.size(), requests.size());
+    for (std::size_t i{0}; i < responses.size(); ++i)
+    {
+        EXPECT_EQ(responses[i].id, i);
+        EXPECT_EQ(responses[i].status, Status::Ok);
+        EXPECT_GT(responses[i].values[0], 0.0);
+    }
+
+    // A stats request is dispatched only after the previous batches have been
+    // recorded, so once it returns the summary covers every priced request.
+    const Response stats{client.stats()};
+    EXPECT_EQ(stats.status, Status::Ok);
+    EXPECT_DOUBLE_EQ(stats.values[0], static_cast<double>(requests.size()));
+
+    const LatencySummary summary{server.latency()};
+    EXPECT_GE(summary.requests, requests.size());
+    EXPECT_LT(summary.pricingCalls, requests.size());
+    EXPECT_LE(summary.p50Us, summary.p99Us);
+    EXPECT_LE(summary.p99Us, summary.maxUs);
+}
+
+TEST(IntegrationServiceServer, ServesConcurrentClientsAndFlagsErrors)
+{
+    if (!detail::socketsSupported())
+        GTEST_SKIP() << "Unix-domain sockets are not available";
+
+    Server server{
+        BatchPricer{{makeSurface()}},
+        Config{.socketPath = socketPath("multi")}
+    };
+    server.start();
+
+    std::vector<std::jthread> clients;
+    std::vector<int> failures(4, 0);
+
+    for (std::size_t c{0}; c < failures.size(); ++c)
+    {
+        clients.emplace_back(
+            [&, c]
+            {
+                Client client{server.socketPath()};
+
+                for (std::uint64_t i{0}; i < 50; ++i)
+                {
+                    const Response response{client.call(priceRequest(i, 100.0))};
+                    if (response.status != Status::Ok || response.id != i)
+                        ++failures[c];
+                }
+            }
+        );
+    }
+    clients.clear();
+
+    for (const int f : failures)
+        EXPECT_EQ(f, 0);
+
+    {
+        Client client{server.socketPath()};
+
+        Request unknown{priceRequest(7, 100.0)};
+        unknown.surface = "MISSING";
+        EXPECT_EQ(client.call(unknown).status, Status::UnknownSurface);
+    }
+
+    // Latency is recorded after the responses are written; stopping drains it.
+    server.stop();
+    EXPECT_EQ(server.latency().requests, 201u);
+}
+
+TEST(IntegrationServiceServer, ClientThatStopsReadingDoesNotBlockOthers)
+{
+    if (!detail::socketsSupported())
+        GTEST_SKIP() << "Unix-domain sockets are not available";
+
+    // The write timeout is far longer than the test may take, so the second client
+    // is only answered promptly if the stalled one never blocks the dispatcher.
+    Server server{
+        BatchPricer{{makeSurface()}},
+        Config{
+            .socketPath = socketPath("stall"),
+            .maxPendingResponses = 64,
+            .writeTimeout = std::chrono::seconds{60}
+        }
+    };
+    server.start();
+
+    const detail::Socket stalled{detail::connectUnix(server.socketPath())};
+
+    constexpr std::size_t numStalled{5000};
+    std::size_t sent{0};
+
+    try
+    {
+        for (; sent < numStalled; ++sent)
+        {
+            const Request request{priceRequest(sent, 100.0)};
+            const RequestHeader header{makeHeader(request)};
+
+            detail::writeExact(stalled, std::as_bytes(std::span{&header, 1}));
+            detail::writeExact(stalled, std::as_bytes(std::span{request.surface}));
+        }
+    }
+    catch (const std::exception&)
+    {
+        // The server may drop the stalled client before every request is sent.
+    }
+
+    const auto start{std::chrono::steady_clock::now()};
+    {
+        Client client{server.socketPath()};
+        EXPECT_EQ(client.call(priceRequest(1, 100.0)).status, Status::Ok);
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds{10});
+
+    // The stalled client was dropped: what it can still read ends well short of a
+    // response per request.
+    std::size_t received{0};
+    try
+    {
+        Response response{};
+        const auto frame{std::as_writable_bytes(std::span{&response, 1})};
+
+        while (detail::readExact(stalled, frame))
+            ++received;
+    }
+    catch (const std::exception&)
+    {
+    }
+    EXPECT_GT(sent, 0u);
+    EXPECT_LT(received, numStalled);
+
+    server.stop();
+}
+
+TEST(IntegrationServiceServer, StopRemovesSocketFile)
+{
+    if (!detail::socketsSupported())
+        GTEST_SKIP() << "Unix-domain sockets are not available";
+
+    const std::filesystem::path path{socketPath("stop")};
+
+    {
+        Server server{BatchPricer{{makeSurface()}}, Config{.socketPath = path}};
+        server.start();
+        EXPECT_TRUE(std::filesystem::exists(path));
+
+        Client client{path};
+        EXPECT_EQ(client.call(priceRequest(1, 100.0)).status, Status::Ok);
+    }
+
+    EXPECT_FALSE(std::filesystem::exists(path));
+}
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Math/Interpolation/BSpline/Interpolator.hpp"
+#include "Support/Performance/Baselines.hpp"
 #include "Support/Performance/Budgets.hpp"
 #include "Support/Performance/Timing.hpp"
 
@@ -101,12 +102,18 @@ TEST(PerformanceBSpline, EvaluatesLargeCubicGridWithinThroughputBudget)
     EXPECT_TRUE(std::isfinite(out[out.size() / 2]));
     EXPECT_TRUE(std::isfinite(out.back()));
 
-    const double ms = uv::tests::performance::bestElapsedMs(
+    const auto stats = uv::tests::performance::sampleElapsedMs(
         [&]
         {
             spline.evalInplace(out, x);
         }
     );
 
-    EXPECT_LT(ms, budget.maxMs);
+    EXPECT_LT(stats.medianMs, budget.maxMs);
+
+    const auto comparison{
+        uv::tests::performance::checkBaseline("bsplineLargeEvaluation", stats)
+    };
+    EXPECT_FALSE(comparison.regressed)
+        << uv::tests::performance::describe(stats, comparison);
 }
@@ -2,13 +2,16 @@
 
 #include "Math/LinearAlgebra/Tridiagonal.hpp"
 #include "Support/Math/LinearAlgebra/Tridiagonal.hpp"
+#include "Support/Performance/Baselines.hpp"
 #include "Support/Performance/Budgets.hpp"
 #include "Support/Performance/Timing.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
 #include <gtest/gtest.h>
+#include <vector>
 
 namespace uv::tests::performance::tridiagonal::detail
 {
@@ -23,6 +26,34 @@ template <std::size_t N> std::array<double, N> makeExpectedSolution()
     return x;
 }
 
+struct SweepSystem
+{
+    std::vector<double> upper;
+    std::vector<double> middle;
+    std::vector<double> lower;
+    std::vector<double> rhs;
+};
+
+inline SweepSystem makeSweepSystem(const std::size_t n)
+{
+    SweepSystem system{
+        std::vector<double>(n, -0.5),
+        std::vector<double>(n, 2.0),
+        std::vector<double>(n, -0.5),
+        std::vector<double>(n)
+    };
+
+    system.upper.back() = 0.0;
+    system.lower.front() = 0.0;
+
+    for (std::size_t i{0}; i < n; ++i)
+    {
+        system.rhs[i] = 1.0 + 0.01 * std::sin(0.07 * static_cast<double>(i));
+    }
+
+    return system;
+}
+
 } // namespace uv::tests::performance::tridiagonal::detail
 
 using namespace uv::tests::performance::tridiagonal::detail;
@@ -60,7 +91,7 @@ TEST(PerformanceTridiagonal, SolvesRepeatedSystemsWithinLatencyBudget)
     std::array<double, n> scratch{};
     double checksum{};
 
-    const double ms = uv::tests::performance::bestElapsedMs(
+    const auto stats = uv::tests::performance::sampleElapsedMs(
         [&]
         {
             checksum = 0.0;
@@ -81,5 +112,196 @@ TEST(PerformanceTridiagonal, SolvesRepeatedSystemsWithinLatencyBudget)
 
     EXPECT_NEAR(x[n / 2], expected[n / 2], 1e-12);
     EXPECT_TRUE(std::isfinite(checksum));
-    EXPECT_LT(ms, budget.maxMs);
+    EXPECT_LT(stats.medianMs, budget.maxMs);
+
+    const auto comparison{
+        uv::tests::performance::checkBaseline("tridiagonalThomasSolve/repeated", stats)
+    };
+    EXPECT_FALSE(comparison.regressed)
+        << uv::tests::performance::describe(stats, comparison);
+}
+
+TEST(PerformanceTridiagonal, SolvesBatchedSystemsWithinLatencyBudget)
+{
+    const auto budget = uv::tests::performance::readBudget(
+        "tests/Golden/performance_budgets.json",
+        uv::tests::performance::TridiagonalThomasSolveBudgetKey
+    );
+
+    constexpr std::size_t n{512};
+    constexpr std::size_t batch{8};
+    constexpr std::size_t iterations{250};
+
+    std::vector<double> upper(n * batch);
+    std::vector<double> middle(n * batch);
+    std::vector<double> lower(n * batch);
+
+    for (std::size_t i{0}; i < n; ++i)
+    {
+        for (std::size_t b{0}; b < batch; ++b)
+        {
+            upper[i * batch + b] = (i + 1 < n) ? -0.5 : 0.0;
+            middle[i * batch + b] = 2.0 + 0.01 * static_cast<double>(b);
+            lower[i * batch + b] = (i > 0) ? -0.5 : 0.0;
+        }
+    }
+
+    const auto expected{makeExpectedSolution<n>()};
+    std::vector<double> rhs(n * batch);
+
+    for (std::size_t i{0}; i < n; ++i)
+    {
+        for (std::size_t b{0}; b < batch; ++b)
+        {
+            const std::size_t k{i * batch + b};
+
+            rhs[k] = middle[k] * expected[i];
+            if (i > 0)
+            {
+                rhs[k] += lower[k] * expected[i - 1];
+            }
+            if (i + 1 < n)
+            {
+                rhs[k] += upper[k] * expected[i + 1];
+            }
+        }
+    }
+
+    std::vector<double> x(n * batch);
+    std::vector<double> scratch(n * batch);
+    double checksum{};
+
+    const auto stats = uv::tests::performance::sampleElapsedMs(
+        [&]
+        {
+            checksum = 0.0;
+            for (std::size_t i{0}; i < iterations; ++i)
+            {
+                x = rhs;
+                uv::math::linear_algebra::thomasSolveBatch<double>(
+                    x,
+                    upper,
+                    middle,
+                    lower,
+                    scratch,
+                    batch,
+                    false
+                );
+                checksum += x[i % (n * batch)];
+            }
+        }
+    );
+
+    EXPECT_NEAR(x[(n / 2) * batch + batch - 1], expected[n / 2], 1e-12);
+    EXPECT_TRUE(std::isfinite(checksum));
+    EXPECT_LT(stats.medianMs, budget.maxMs);
+
+    const auto comparison{
+        uv::tests::performance::checkBaseline("tridiagonalThomasSolve/batched", stats)
+    };
+    EXPECT_FALSE(comparison.regressed)
+        << uv::tests::performance::describe(stats, comparison);
+}
+
+TEST(PerformanceTridiagonal, SolvesRuntimeSizedSweepWithinLatencyBudget)
+{
+    const auto budget = uv::tests::performance::readBudget(
+        "tests/Golden/performance_budgets.json",
+        uv::tests::performance::TridiagonalThomasSolveBudgetKey
+    );
+
+    constexpr std::size_t unknownsPerSample{1U << 20};
+
+    uv::math::linear_algebra::TridiagonalWorkspace<double> workspace;
+
+    for (const std::size_t n : {64U, 512U, 4'096U, 32'768U, 262'144U})
+    {
+        const auto system{makeSweepSystem(n)};
+        const std::size_t iterations{std::max<std::size_t>(1, unknownsPerSample / n)};
+
+        std::vector<double> x(n);
+        double checksum{};
+
+        const auto stats = uv::tests::performance::sampleElapsedMs(
+            [&]
+            {
+                checksum = 0.0;
+                for (std::size_t i{0}; i < iterations; ++i)
+                {
+                    x = system.rhs;
+                    uv::math::linear_algebra::thomasSolve<double>(
+                        x,
+                        system.upper,
+                        system.middle,
+                        system.lower,
+                        workspace,
+                        false
+                    );
+                    checksum += x[i % n];
+                }
+            }
+        );
+
+        EXPECT_TRUE(std::isfinite(checksum)) << "n=" << n;
+        EXPECT_LT(stats.medianMs, budget.maxMs) << "n=" << n;
+
+        const auto comparison{uv::tests::performance::checkBaseline(
+            std::format("tridiagonalThomasSolve/sweep/{}", n),
+            stats
+        )};
+        EXPECT_FALSE(comparison.regressed)
+            << "n=" << n << ": "
+            << uv::tests::performance::describe(stats, comparison);
+    }
+}
+
+TEST(PerformanceTridiagonal, PartitionSolvesLargeSystemWithinLatencyBudget)
+{
+    const auto budget = uv::tests::performance::readBudget(
+        "tests/Golden/performance_budgets.json",
+        uv::tests::performance::TridiagonalThomasSolveBudgetKey
+    );
+
+    constexpr std::size_t n{1U << 20};
+    constexpr std::size_t iterations{4};
+
+    const auto system{makeSweepSystem(n)};
+
+    uv::math::linear_algebra::TridiagonalWorkspace<double> workspace;
+    std::vector<double> serial{system.rhs};
+    std::vector<double> x(n);
+
+    uv::math::linear_algebra::thomasSolve<double>(
+        serial,
+        system.upper,
+        system.middle,
+        system.lower,
+        workspace
+    );
+
+    const auto stats = uv::tests::performance::sampleElapsedMs(
+        [&]
+        {
+            for (std::size_t i{0}; i < iterations; ++i)
+            {
+                x = system.rhs;
+                uv::math::linear_algebra::partitionSolve<double>(
+                    x,
+                    system.upper,
+                    system.middle,
+                    system.lower,
+                    workspace
+                );
+            }
+        }
+    );
+
+    EXPECT_NEAR(x[n / 3], serial[n / 3], 1e-12);
+    EXPECT_LT(stats.medianMs, budget.maxMs);
+
+    const auto comparison{
+        uv::tests::performance::checkBaseline("tridiagonalPartitionSolve", stats)
+    };
+    EXPECT_FALSE(comparison.regressed)
+        << uv::tests::performance::describe(stats, comparison);
 }
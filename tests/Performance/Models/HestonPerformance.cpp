@@ -3,7 +3,10 @@
 #include "Core/Curve.hpp"
 #include "Core/Matrix.hpp"
 #include "Core/VolSurface.hpp"
+#include "Models/Heston/MonteCarlo/Pricer.hpp"
+#include "Models/Heston/PDE/Pricer.hpp"
 #include "Models/Heston/Price/Pricer.hpp"
+#include "Support/Performance/Baselines.hpp"
 #include "Support/Performance/Budgets.hpp"
 #include "Support/Performance/Timing.hpp"
 
@@ -40,14 +43,78 @@ TEST(PerformanceHeston, PricesMediumSurfaceWithinThroughputBudget)
     ASSERT_EQ(prices.rows(), maturities.size());
     ASSERT_EQ(prices.cols(), strikes.size());
 
-    const double ms = uv::tests::performance::bestElapsedMs(
+    const auto stats = uv::tests::performance::sampleElapsedMs(
         [&]
         {
             prices = pricer.callPrice(surface, curve);
         }
     );
 
-    EXPECT_LT(ms, budget.maxMs);
+    EXPECT_LT(stats.medianMs, budget.maxMs);
+
+    const auto comparison{
+        uv::tests::performance::checkBaseline("hestonMediumSurface", stats)
+    };
+    EXPECT_FALSE(comparison.regressed)
+        << uv::tests::performance::describe(stats, comparison);
     EXPECT_TRUE(std::isfinite(prices[0][0]));
     EXPECT_TRUE(std::isfinite(prices[prices.rows() - 1][prices.cols() - 1]));
 }
+
+TEST(PerformanceHeston, PricesAmericanPutOnADIGridWithinLatencyBudget)
+{
+    const auto budget = uv::tests::performance::readBudget(
+        "tests/Golden/performance_budgets.json",
+        uv::tests::performance::HestonADIAmericanPutBudgetKey
+    );
+
+    uv::models::heston::pde::Pricer<double> pricer{
+        {.numSpotNodes = 200, .numVarianceNodes = 100, .numTimeSteps = 100}
+    };
+    pricer.setParams({1.5, 0.04, 0.3, -0.9, 0.0625});
+
+    const auto exercise{uv::models::heston::pde::Exercise::American};
+    double price{};
+
+    const auto stats = uv::tests::performance::sampleElapsedMs(
+        [&]
+        {
+            price = pricer.price(0.25, 0.1, 0.0, 100.0, 100.0, false, exercise);
+        }
+    );
+
+    EXPECT_LT(stats.medianMs, budget.maxMs);
+
+    const auto comparison{
+        uv::tests::performance::checkBaseline("hestonAdiAmericanPut", stats)
+    };
+    EXPECT_FALSE(comparison.regressed)
+        << uv::tests::performance::describe(stats, comparison);
+    EXPECT_GT(price, 0.0);
+}
+
+TEST(PerformanceHeston, SimulatesQEPathsWithinThroughputBudget)
+{
+    const auto budget = uv::tests::performance::readBudget(
+        "tests/Golden/performance_budgets.json",
+        uv::tests::performance::HestonMonteCarloBudgetKey
+    );
+
+    uv::models::heston::mc::Pricer<double> pricer{{.numPaths = 1 << 15, .numSteps = 100}};
+    pricer.setParams({1.5, 0.04, 0.5, -0.7, 0.04});
+
+    uv::models::heston::mc::Result<double> result{};
+
+    const auto stats = uv::tests::performance::sampleElapsedMs(
+        [&] { result = pricer.callPrice(1.0, 0.03, 0.01, 100.0, 100.0); }
+    );
+
+    EXPECT_LT(stats.medianMs, budget.maxMs);
+
+    const auto comparison{
+        uv::tests::performance::checkBaseline("hestonMonteCarlo", stats)
+    };
+    EXPECT_FALSE(comparison.regressed)
+        << uv::tests::performance::describe(stats, comparison);
+    EXPECT_GT(result.price, 0.0);
+}
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Core/QuoteUpdate.hpp"
+#include "IO/CSV/Load.hpp"
+#include "Models/Intraday/Engine.hpp"
+#include "Support/Performance/Baselines.hpp"
+#include "Support/Performance/Budgets.hpp"
+#include "Support/Performance/Timing.hpp"
+
+#include <filesystem>
+#include <gtest/gtest.h>
+
+TEST(PerformanceIntraday, RecalibratesSingleExpiryMoveWithinLatencyBudget)
+{
+    const auto budget = uv::tests::performance::readBudget(
+        "tests/Golden/performance_budgets.json",
+        uv::tests::performance::IntradaySingleExpiryUpdateBudgetKey
+    );
+
+    const uv::core::MarketData<double> marketData{
+        .interestRate = 0.0,
+        .dividendYield = 0.0,
+        .spot = 485.77548
+    };
+    uv::models::intraday::Engine<double> engine{
+        uv::io::csv::load::marketState(
+            std::filesystem::path{"data/VolSurface_SPY_04072011.csv"},
+            marketData
+        ),
+        uv::models::intraday::Config{.recalibrateHeston = false}
+    };
+
+    // Alternate the ATM quote of one expiry so every sample refits the same slices.
+    std::uint64_t seq{0};
+    uv::models::intraday::UpdateStats last{};
+
+    const auto stats = uv::tests::performance::sampleElapsedMs(
+        [&]
+        {
+            ++seq;
+            const double vol{seq % 2 == 0 ? 0.33121 : 0.33021};
+            engine.apply(uv::core::QuoteUpdate<double>{seq, 0.25, 1.0, vol});
+            last = engine.recalibrate();
+        }
+    );
+
+    EXPECT_FALSE(last.refitSlices.empty());
+    EXPECT_LT(stats.medianMs, budget.maxMs);
+
+    const auto comparison{
+        uv::tests::performance::checkBaseline("intradaySingleExpiryUpdate", stats)
+    };
+    EXPECT_FALSE(comparison.regressed)
+        << uv::tests::performance::describe(stats, comparison);
+}
@@ -4,6 +4,7 @@
 #include "Models/SVI/Calibrate/Config.hpp"
 #include "Optimization/NLopt/Optimizer.hpp"
 #include "Support/Models/SVI.hpp"
+#include "Support/Performance/Baselines.hpp"
 #include "Support/Performance/Budgets.hpp"
 #include "Support/Performance/Timing.hpp"
 
@@ -29,7 +30,7 @@ TEST(PerformanceSVI, CalibratesSyntheticSurfaceWithinLatencyBudget)
     };
     uv::Vector<uv::models::svi::Params<double>> calibrated;
 
-    const double ms = uv::tests::performance::bestElapsedMs(
+    const auto stats = uv::tests::performance::sampleElapsedMs(
         [&]
         {
             calibrated = uv::models::svi::calibrate(
@@ -42,5 +43,11 @@ TEST(PerformanceSVI, CalibratesSyntheticSurfaceWithinLatencyBudget)
     );
 
     EXPECT_EQ(calibrated.size(), data.maturities.size());
-    EXPECT_LT(ms, budget.maxMs);
+    EXPECT_LT(stats.medianMs, budget.maxMs);
+
+    const auto comparison{
+        uv::tests::performance::checkBaseline("sviSyntheticCalibration", stats)
+    };
+    EXPECT_FALSE(comparison.regressed)
+        << uv::tests::performance::describe(stats, comparison);
 }
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Core/Curve.hpp"
+#include "Core/MarketState.hpp"
+#include "Core/Matrix.hpp"
+#include "Core/VolSurface.hpp"
+#include "Models/Scenario/Engine.hpp"
+#include "Support/Performance/Baselines.hpp"
+#include "Support/Performance/Budgets.hpp"
+#include "Support/Performance/Timing.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(PerformanceScenario, RevaluesHestonSpotLadderWithinBudget)
+{
+    const auto budget = uv::tests::performance::readBudget(
+        "tests/Golden/performance_budgets.json",
+        uv::tests::performance::ScenarioSpotLadderBudgetKey
+    );
+
+    const std::vector<double> maturities{0.1, 0.25, 0.5, 0.75, 1.0, 1.5, 2.0, 3.0};
+    std::vector<double> strikes;
+    std::vector<double> moneyness;
+    for (std::size_t j{0}; j < 15; ++j)
+    {
+        moneyness.push_back(0.7 + 0.05 * static_cast<double>(j));
+        strikes.push_back(100.0 * moneyness.back());
+    }
+
+    std::vector<double> forwards;
+    for (const double t : maturities)
+        forwards.push_back(100.0 * std::exp(0.02 * t));
+
+    const uv::core::MarketState<double> state{
+        uv::core::Curve<double>{0.03, maturities},
+        uv::core::Curve<double>{0.01, maturities},
+        uv::core::VolSurface<double>{
+            maturities,
+            forwards,
+            strikes,
+            moneyness,
+            uv::core::Matrix<double>{maturities.size(), strikes.size(), 0.2}
+        }
+    };
+
+    const uv::models::scenario::Engine<double> engine{
+        state,
+        uv::models::heston::Params<double>{2.0, 0.04, 0.3, -0.7, 0.04}
+    };
+
+    // A +-20% spot ladder in 2% steps under three rate shocks.
+    std::vector<uv::models::scenario::Shock> shocks;
+    for (const double rate : {-0.01, 0.0, 0.01})
+    {
+        for (int s{-10}; s <= 10; ++s)
+            shocks.push_back({.spot = 0.02 * s, .rate = rate});
+    }
+
+    double sum{0.0};
+
+    const auto stats = uv::tests::performance::sampleElapsedMs(
+        [&]
+        {
+            const auto grid{
+                engine.revalue(shocks, uv::models::scenario::Model::Heston)
+            };
+            sum += grid(0, 0, 0);
+        }
+    );
+
+    EXPECT_GT(sum, 0.0);
+    EXPECT_LT(stats.medianMs, budget.maxMs);
+
+    const auto comparison{
+        uv::tests::performance::checkBaseline("scenarioSpotLadder", stats)
+    };
+    EXPECT_FALSE(comparison.regressed)
+        << uv::tests::performance::describe(stats, comparison);
+}
@@ -4,6 +4,7 @@
 #include "Models/Heston/BuildSurface.hpp"
 #include "Models/Heston/Calibrate/Config.hpp"
 #include "Models/SVI/BuildSurface.hpp"
+#include "Support/Performance/Baselines.hpp"
 #include "Support/Performance/Budgets.hpp"
 #include "Support/Performance/Timing.hpp"
 
@@ -40,7 +41,7 @@ TEST(PerformanceExamplePipeline, BuildsSVIAndHestonSurfacesWithinLatencyBudget)
     std::size_t sviMaturities{};
     std::size_t hestonStrikes{};
 
-    const double ms = uv::tests::performance::bestElapsedMs(
+    const auto stats = uv::tests::performance::sampleElapsedMs(
         [&]
         {
             const auto sviVolSurface =
@@ -57,5 +58,11 @@ TEST(PerformanceExamplePipeline, BuildsSVIAndHestonSurfacesWithinLatencyBudget)
 
     EXPECT_EQ(sviMaturities, marketState.volSurface.numMaturities());
     EXPECT_EQ(hestonStrikes, marketState.volSurface.numStrikes());
-    EXPECT_LT(ms, budget.maxMs);
+    EXPECT_LT(stats.medianMs, budget.maxMs);
+
+    const auto comparison{
+        uv::tests::performance::checkBaseline("examplePipeline", stats)
+    };
+    EXPECT_FALSE(comparison.regressed)
+        << uv::tests::performance::describe(stats, comparison);
 }
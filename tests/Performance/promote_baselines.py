@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: Apache-2.0
+"""Promote recorded performance history into the per-machine baselines.
+
+Reads the JSON Lines history written by the performance tests and stores the
+most recent record of every (machine, key) pair in the baselines file. Use
+--machine to promote a single machine only.
+"""
+
+import argparse
+import json
+import sys
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument(
+        "--history",
+        default="build/performance_history.jsonl",
+        help="history file written by the performance tests",
+    )
+    parser.add_argument(
+        "--baselines",
+        default="tests/Golden/performance_baselines.json",
+        help="baselines file to update",
+    )
+    parser.add_argument("--machine", help="only promote records for this CPU model")
+    args = parser.parse_args()
+
+    latest = {}
+    with open(args.history, encoding="utf-8") as f:
+        for line in f:
+            if not line.strip():
+                continue
+            record = json.loads(line)
+            if args.machine and record["machine"] != args.machine:
+                continue
+            latest[(record["machine"], record["key"])] = record
+
+    if not latest:
+        print("No matching history records.", file=sys.stderr)
+        return 1
+
+    with open(args.baselines, encoding="utf-8") as f:
+        baselines = json.load(f)
+
+    machines = baselines.setdefault("machines", {})
+    for (machine, key), record in sorted(latest.items()):
+        machines.setdefault(machine, {})[key] = {
+            "medianMs": record["medianMs"],
+            "lowerMs": record["lowerMs"],
+            "upperMs": record["upperMs"],
+        }
+        print(f"{machine}: {key} = {record['medianMs']:.3f} ms")
+
+    with open(args.baselines, "w", encoding="utf-8") as f:
+        json.dump(baselines, f, indent=2)
+        f.write("\n")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,220 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Support/Memory/Allocation.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace uv::tests::memory
+{
+namespace detail
+{
+// Constant-initialized so the counters are usable from operator new during static
+// initialization and thread start-up.
+constinit thread_local AllocationCounts counts{};
+
+void* allocate(std::size_t size) noexcept
+{
+    if (size == 0)
+        size = 1;
+
+    void* p{std::malloc(size)};
+    if (p)
+    {
+        ++counts.allocations;
+        counts.bytes += size;
+    }
+    return p;
+}
+
+void* allocateAligned(std::size_t size, std::align_val_t alignment) noexcept
+{
+    const auto align{static_cast<std::size_t>(alignment)};
+    if (size == 0)
+        size = align;
+
+#if defined(_WIN32)
+    void* p{_aligned_malloc(size, align)};
+#else
+    void* p{std::aligned_alloc(align, (size + align - 1) / align * align)};
+#endif
+    if (p)
+    {
+        ++counts.allocations;
+        counts.bytes += size;
+    }
+    return p;
+}
+
+void deallocate(void* p) noexcept
+{
+    if (!p)
+        return;
+
+    ++counts.deallocations;
+    std::free(p);
+}
+
+void deallocateAligned(void* p) noexcept
+{
+    if (!p)
+        return;
+
+    ++counts.deallocations;
+#if defined(_WIN32)
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+void* allocateOrThrow(std::size_t size)
+{
+    if (void* p = allocate(size))
+        return p;
+    throw std::bad_alloc{};
+}
+
+void* allocateAlignedOrThrow(std::size_t size, std::align_val_t alignment)
+{
+    if (void* p = allocateAligned(size, alignment))
+        return p;
+    throw std::bad_alloc{};
+}
+} // namespace detail
+
+AllocationCounts threadAllocationCounts() noexcept
+{
+    return detail::counts;
+}
+
+AllocationCounts
+operator-(const AllocationCounts& lhs, const AllocationCounts& rhs) noexcept
+{
+    return {
+        .allocations = lhs.allocations - rhs.allocations,
+        .deallocations = lhs.deallocations - rhs.deallocations,
+        .bytes = lhs.bytes - rhs.bytes
+    };
+}
+
+AllocationScope::AllocationScope() noexcept
+    : start_(threadAllocationCounts())
+{
+}
+
+AllocationCounts AllocationScope::counts() const noexcept
+{
+    return threadAllocationCounts() - start_;
+}
+} // namespace uv::tests::memory
+
+namespace memory = uv::tests::memory::detail;
+
+void* operator new(std::size_t size)
+{
+    return memory::allocateOrThrow(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return memory::allocateOrThrow(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return memory::allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return memory::allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return memory::allocateAlignedOrThrow(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return memory::allocateAlignedOrThrow(size, alignment);
+}
+
+void* operator new(
+    std::size_t size,
+    std::align_val_t alignment,
+    const std::nothrow_t&
+) noexcept
+{
+    return memory::allocateAligned(size, alignment);
+}
+
+void* operator new[](
+    std::size_t size,
+    std::align_val_t alignment,
+    const std::nothrow_t&
+) noexcept
+{
+    return memory::allocateAligned(size, alignment);
+}
+
+void operator delete(void* p) noexcept
+{
+    memory::deallocate(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    memory::deallocate(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    memory::deallocate(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    memory::deallocate(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    memory::deallocate(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    memory::deallocate(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept
+{
+    memory::deallocateAligned(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept
+{
+    memory::deallocateAligned(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept
+{
+    memory::deallocateAligned(p);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept
+{
+    memory::deallocateAligned(p);
+}
+
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    memory::deallocateAligned(p);
+}
+
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    memory::deallocateAligned(p);
+}
@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+namespace uv::tests::memory
+{
+// Heap traffic seen by the replacement operator new/delete on the calling thread.
+// Linking this header's translation unit replaces the global allocation functions
+// for the whole test executable.
+struct AllocationCounts
+{
+    std::size_t allocations{};
+    std::size_t deallocations{};
+    std::size_t bytes{};
+};
+
+AllocationCounts threadAllocationCounts() noexcept;
+
+AllocationCounts
+operator-(const AllocationCounts& lhs, const AllocationCounts& rhs) noexcept;
+
+// Counts allocations made on this thread between construction and counts().
+class AllocationScope
+{
+  public:
+    AllocationScope() noexcept;
+
+    AllocationCounts counts() const noexcept;
+
+  private:
+    AllocationCounts start_;
+};
+
+template <typename F> AllocationCounts countAllocations(F&& f)
+{
+    const AllocationScope scope;
+    std::forward<F>(f)();
+    return scope.counts();
+}
+} // namespace uv::tests::memory
@@ -0,0 +1,213 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "IO/JSON/Read.hpp"
+#include "Support/Performance/Timing.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace uv::tests::performance
+{
+inline constexpr std::string_view BaselinesPath{
+    "tests/Golden/performance_baselines.json"
+};
+inline constexpr std::string_view DefaultHistoryPath{"build/performance_history.jsonl"};
+
+// A run regresses when the lower end of its median confidence interval is more
+// than this fraction above the stored baseline median.
+inline constexpr double RegressionTolerance{0.05};
+
+struct Baseline
+{
+    double medianMs{};
+    double lowerMs{};
+    double upperMs{};
+};
+
+struct Comparison
+{
+    std::optional<Baseline> baseline;
+    double ratio{1.0};
+    bool regressed{};
+};
+
+// Baselines and history are keyed by CPU model so that timings from different
+// machines are never compared against each other.
+inline std::string cpuModel()
+{
+    if (const char* machine = std::getenv("UNIFIEDVOL_PERF_MACHINE"))
+        return machine;
+
+    std::ifstream in{"/proc/cpuinfo"};
+    std::string line;
+
+    while (std::getline(in, line))
+    {
+        if (!line.starts_with("model name"))
+            continue;
+
+        const auto colon{line.find(':')};
+        if (colon == std::string::npos)
+            break;
+
+        const auto begin{line.find_first_not_of(" \t", colon + 1)};
+        return begin == std::string::npos ? std::string{"unknown"} : line.substr(begin);
+    }
+
+    return "unknown";
+}
+
+inline std::optional<Baseline> readBaseline(
+    const std::filesystem::path& path,
+    std::string_view machine,
+    std::string_view key
+)
+{
+    const auto root = uv::io::json::read(path);
+    const auto& machines = root.at("machines").object;
+
+    const auto machineIt = machines.find(machine);
+    if (machineIt == machines.end())
+        return std::nullopt;
+
+    const auto& entries = machineIt->second.object;
+    const auto entryIt = entries.find(key);
+    if (entryIt == entries.end())
+        return std::nullopt;
+
+    const Baseline baseline{
+        .medianMs = entryIt->second.at("medianMs").asNumber(),
+        .lowerMs = entryIt->second.at("lowerMs").asNumber(),
+        .upperMs = entryIt->second.at("upperMs").asNumber()
+    };
+
+    if (!std::isfinite(baseline.medianMs) || baseline.medianMs <= 0.0)
+        throw std::runtime_error(
+            "Performance baseline must be positive and finite: " + std::string{key}
+        );
+
+    return baseline;
+}
+
+inline Comparison compareToBaseline(
+    const SampleSummary& summary,
+    const std::optional<Baseline>& baseline,
+    const double tolerance = RegressionTolerance
+)
+{
+    if (!baseline)
+        return {};
+
+    return {
+        .baseline = baseline,
+        .ratio = summary.medianMs / baseline->medianMs,
+        .regressed = summary.lowerMs > baseline->medianMs * (1.0 + tolerance)
+    };
+}
+
+inline std::filesystem::path historyPath()
+{
+    if (const char* path = std::getenv("UNIFIEDVOL_PERF_HISTORY"))
+        return path;
+
+    return std::filesystem::path{DefaultHistoryPath};
+}
+
+inline std::string jsonEscape(std::string_view text)
+{
+    std::string out;
+    out.reserve(text.size());
+
+    for (const char c : text)
+    {
+        if (c == '"' || c == '\\')
+            out += '\\';
+        if (static_cast<unsigned char>(c) >= 0x20)
+            out += c;
+    }
+
+    return out;
+}
+
+// Appends one JSON object per line so trends can be plotted across runs.
+inline void appendHistory(
+    const std::filesystem::path& path,
+    std::string_view machine,
+    std::string_view key,
+    const SampleSummary& summary,
+    const Comparison& comparison
+)
+{
+    if (path.has_parent_path())
+        std::filesystem::create_directories(path.parent_path());
+
+    std::ofstream out{path, std::ios::app};
+    if (!out)
+        throw std::runtime_error("Could not open performance history: " + path.string());
+
+    const auto now{std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    )};
+    const char* revision{std::getenv("GITHUB_SHA")};
+
+    out << std::format(
+        "{{\"unixTime\": {}, \"revision\": \"{}\", \"machine\": \"{}\", "
+        "\"key\": \"{}\", \"samples\": {}, \"medianMs\": {}, \"lowerMs\": {}, "
+        "\"upperMs\": {}, \"baselineMs\": {}, \"regressed\": {}}}\n",
+        now.count(),
+        jsonEscape(revision ? revision : ""),
+        jsonEscape(machine),
+        jsonEscape(key),
+        summary.samplesMs.size(),
+        summary.medianMs,
+        summary.lowerMs,
+        summary.upperMs,
+        comparison.baseline ? std::format("{}", comparison.baseline->medianMs)
+                            : std::string{"null"},
+        comparison.regressed
+    );
+}
+
+// Compares against the stored baseline for this machine and records the run.
+inline Comparison checkBaseline(std::string_view key, const SampleSummary& summary)
+{
+    const std::string machine{cpuModel()};
+    const Comparison comparison{compareToBaseline(
+        summary,
+        readBaseline(std::filesystem::path{BaselinesPath}, machine, key)
+    )};
+
+    appendHistory(historyPath(), machine, key, summary, comparison);
+    return comparison;
+}
+
+inline std::string describe(const SampleSummary& summary, const Comparison& comparison)
+{
+    std::string text{std::format(
+        "median {:.3f} ms [{:.3f}, {:.3f}] over {} samples",
+        summary.medianMs,
+        summary.lowerMs,
+        summary.upperMs,
+        summary.samplesMs.size()
+    )};
+
+    if (comparison.baseline)
+        text += std::format(
+            ", baseline {:.3f} ms ({:+.1f}%)",
+            comparison.baseline->medianMs,
+            100.0 * (comparison.ratio - 1.0)
+        );
+
+    return text;
+}
+} // namespace uv::tests::performance
@@ -27,15 +27,25 @@ inline constexpr std::string_view BSplineLargeEvaluationBudgetKey{"bsplineLargeE
 };
 inline constexpr std::string_view TridiagonalThomasSolveBudgetKey{"tridiagonalThomasSolve"
 };
+inline constexpr std::string_view HestonADIAmericanPutBudgetKey{"hestonAdiAmericanPut"};
+inline constexpr std::string_view HestonMonteCarloBudgetKey{"hestonMonteCarlo"};
+inline constexpr std::string_view IntradaySingleExpiryUpdateBudgetKey{
+    "intradaySingleExpiryUpdate"
+};
+inline constexpr std::string_view ScenarioSpotLadderBudgetKey{"scenarioSpotLadder"};
 
-inline constexpr std::array<std::string_view, 5> expectedBudgetKeys()
+inline constexpr std::array<std::string_view, 9> expectedBudgetKeys()
 {
     return {
         ExamplePipelineBudgetKey,
         HestonMediumSurfaceBudgetKey,
         SVISyntheticCalibrationBudgetKey,
         BSplineLargeEvaluationBudgetKey,
-        TridiagonalThomasSolveBudgetKey
+        TridiagonalThomasSolveBudgetKey,
+        HestonADIAmericanPutBudgetKey,
+        HestonMonteCarloBudgetKey,
+        IntradaySingleExpiryUpdateBudgetKey,
+        ScenarioSpotLadderBudgetKey
     };
 }
 
@@ -6,32 +6,138 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <random>
 #include <ratio>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace uv::tests::performance
 {
+struct SamplingOptions
+{
+    std::size_t warmups{1};
+    std::size_t minSamples{5};
+    std::size_t maxSamples{30};
+    // Stop sampling once this much time has been spent, after minSamples.
+    double maxTotalMs{3'000.0};
+    // Stop sampling once the confidence interval is this narrow relative to the median.
+    double targetRelativeWidth{0.02};
+    std::size_t resamples{2'000};
+    double confidence{0.95};
+};
+
+struct SampleSummary
+{
+    std::vector<double> samplesMs;
+    double medianMs{};
+    double lowerMs{};
+    double upperMs{};
+
+    double relativeWidth() const
+    {
+        return medianMs > 0.0 ? (upperMs - lowerMs) / medianMs : 0.0;
+    }
+};
+
+inline double median(std::vector<double> values)
+{
+    if (values.empty())
+        throw std::invalid_argument("Median requires at least one value");
+
+    const std::size_t mid{values.size() / 2};
+    std::nth_element(values.begin(), values.begin() + mid, values.end());
+    const double upper{values[mid]};
+
+    if (values.size() % 2 != 0)
+        return upper;
+
+    const double lower{*std::max_element(values.begin(), values.begin() + mid)};
+    return 0.5 * (lower + upper);
+}
+
+// Median with a percentile bootstrap confidence interval. The generator is seeded
+// deterministically so the same samples always give the same interval.
+inline SampleSummary summarize(
+    std::vector<double> samplesMs,
+    const std::size_t resamples = 2'000,
+    const double confidence = 0.95
+)
+{
+    if (samplesMs.empty())
+        throw std::invalid_argument("Performance summary requires at least one sample");
+    if (resamples == 0 || !(confidence > 0.0 && confidence < 1.0))
+        throw std::invalid_argument("Invalid bootstrap settings");
+
+    const std::size_t n{samplesMs.size()};
+    std::mt19937_64 rng{std::uint64_t{0x5eed} + n};
+    std::uniform_int_distribution<std::size_t> pick{0, n - 1};
+
+    std::vector<double> medians(resamples);
+    std::vector<double> resample(n);
+
+    for (double& m : medians)
+    {
+        for (double& v : resample)
+            v = samplesMs[pick(rng)];
+        m = median(resample);
+    }
+
+    std::sort(medians.begin(), medians.end());
+
+    const double tail{0.5 * (1.0 - confidence)};
+    const auto index = [&](double q)
+    {
+        const auto i{static_cast<std::size_t>(q * static_cast<double>(resamples - 1))};
+        return std::min(i, resamples - 1);
+    };
+
+    SampleSummary summary{};
+    summary.medianMs = median(samplesMs);
+    summary.lowerMs = medians[index(tail)];
+    summary.upperMs = medians[index(1.0 - tail)];
+    summary.samplesMs = std::move(samplesMs);
+    return summary;
+}
+
+// Times f repeatedly until the median is pinned down to targetRelativeWidth, the
+// sample cap is hit, or maxTotalMs has been spent.
 template <typename F>
-double bestElapsedMs(F&& f, const std::size_t samples = 3, const std::size_t warmups = 1)
+SampleSummary sampleElapsedMs(F&& f, const SamplingOptions& options = {})
 {
-    if (samples == 0)
-        throw std::invalid_argument("Performance timing requires at least one sample");
+    if (options.minSamples == 0 || options.minSamples > options.maxSamples)
+        throw std::invalid_argument(
+            "Performance sampling requires 0 < minSamples <= maxSamples"
+        );
 
-    for (std::size_t i = 0; i < warmups; ++i)
+    for (std::size_t i = 0; i < options.warmups; ++i)
         f();
 
     std::vector<double> timings;
-    timings.reserve(samples);
-    for (std::size_t i = 0; i < samples; ++i)
+    timings.reserve(options.maxSamples);
+    double totalMs{};
+
+    while (timings.size() < options.maxSamples)
     {
         uv::utils::StopWatch watch;
         watch.StartStopWatch();
         f();
         watch.StopStopWatch();
-        timings.emplace_back(watch.GetTime<std::milli>());
+
+        const double ms{watch.GetTime<std::milli>()};
+        timings.emplace_back(ms);
+        totalMs += ms;
+
+        if (timings.size() < options.minSamples)
+            continue;
+        if (totalMs >= options.maxTotalMs)
+            break;
+        if (summarize(timings, options.resamples, options.confidence).relativeWidth() <=
+            options.targetRelativeWidth)
+            break;
     }
 
-    return *std::min_element(timings.begin(), timings.end());
+    return summarize(std::move(timings), options.resamples, options.confidence);
 }
 } // namespace uv::tests::performance
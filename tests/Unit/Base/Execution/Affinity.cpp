@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Execution/Affinity.hpp"
+#include "Base/Errors/Errors.hpp"
+#include "Base/Execution/Executor.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(UnitBaseExecutionAffinity, ParsesCpuLists)
+{
+    const std::vector<int> cpus{uv::execution::parseCpuList("4-6,0,2,5\n")};
+
+    EXPECT_EQ(cpus, (std::vector<int>{0, 2, 4, 5, 6}));
+    EXPECT_TRUE(uv::execution::parseCpuList("").empty());
+}
+
+TEST(UnitBaseExecutionAffinity, RejectsMalformedCpuLists)
+{
+    EXPECT_THROW(uv::execution::parseCpuList("0-"), uv::errors::UnifiedVolError);
+    EXPECT_THROW(uv::execution::parseCpuList("3-1"), uv::errors::UnifiedVolError);
+    EXPECT_THROW(uv::execution::parseCpuList("a,b"), uv::errors::UnifiedVolError);
+}
+
+TEST(UnitBaseExecutionAffinity, CompactPlacementGroupsCpusByNode)
+{
+    const std::vector<int> allowed{uv::execution::allowedCpus()};
+
+    ASSERT_FALSE(allowed.empty());
+
+    const auto slots = uv::execution::compactPlacement(allowed);
+
+    ASSERT_EQ(slots.size(), allowed.size());
+
+    for (std::size_t i{1}; i < slots.size(); ++i)
+    {
+        EXPECT_LE(slots[i - 1].node, slots[i].node);
+    }
+
+    for (const uv::execution::CpuSlot& slot : slots)
+    {
+        EXPECT_TRUE(std::binary_search(allowed.begin(), allowed.end(), slot.cpu));
+        EXPECT_GE(slot.node, 0);
+    }
+}
+
+TEST(UnitBaseExecutionAffinity, PinnedExecutorIsBoundedByCpuList)
+{
+    uv::execution::Executor& executor{uv::execution::Executor::instance()};
+    const std::vector<int> allowed{uv::execution::allowedCpus()};
+    const std::vector<int> first{allowed.front()};
+
+    executor.configure(-1, first);
+
+    EXPECT_EQ(executor.concurrency(), 1);
+    ASSERT_EQ(executor.placement().size(), 1U);
+    EXPECT_EQ(executor.placement().front().cpu, allowed.front());
+
+    executor.configure(-1);
+
+    EXPECT_TRUE(executor.placement().empty());
+
+    const std::vector<int> forbidden{allowed.back() + 1};
+
+    EXPECT_THROW(executor.configure(-1, forbidden), uv::errors::UnifiedVolError);
+}
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Execution/BoundedQueue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+TEST(UnitBaseExecutionBoundedQueue, PreservesFifoOrderAndDrainsAfterClose)
+{
+    uv::execution::BoundedQueue<int> queue{4};
+
+    for (int i{0}; i < 3; ++i)
+        EXPECT_TRUE(queue.push(i));
+
+    queue.close();
+
+    int value{-1};
+    EXPECT_FALSE(queue.push(value));
+
+    for (int i{0}; i < 3; ++i)
+    {
+        ASSERT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, i);
+    }
+
+    EXPECT_FALSE(queue.pop(value));
+}
+
+TEST(UnitBaseExecutionBoundedQueue, PushBlocksWhileFull)
+{
+    uv::execution::BoundedQueue<int> queue{1};
+    std::atomic<bool> secondPushed{false};
+
+    int first{1};
+    ASSERT_TRUE(queue.push(first));
+
+    std::jthread producer{[&]
+                          {
+                              int second{2};
+                              queue.push(second);
+                              secondPushed.store(true);
+                          }};
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(secondPushed.load());
+
+    int value{};
+    ASSERT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, 1);
+    ASSERT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, 2);
+
+    producer.join();
+    EXPECT_TRUE(secondPushed.load());
+}
+
+TEST(UnitBaseExecutionBoundedQueue, DeliversEveryItemAcrossProducersAndConsumers)
+{
+    constexpr int numProducers{4};
+    constexpr int perProducer{2'000};
+
+    uv::execution::BoundedQueue<int> queue{8};
+    std::atomic<long long> sum{0};
+    std::atomic<int> count{0};
+
+    {
+        std::vector<std::jthread> consumers;
+        for (int c{0}; c < 3; ++c)
+        {
+            consumers.emplace_back(
+                [&]
+                {
+                    int value{};
+                    while (queue.pop(value))
+                    {
+                        sum.fetch_add(value);
+                        count.fetch_add(1);
+                    }
+                }
+            );
+        }
+
+        {
+            std::vector<std::jthread> producers;
+            for (int p{0}; p < numProducers; ++p)
+            {
+                producers.emplace_back(
+                    [&, p]
+                    {
+                        for (int i{0}; i < perProducer; ++i)
+                        {
+                            int value{p * perProducer + i};
+                            queue.push(value);
+                        }
+                    }
+                );
+            }
+        }
+
+        queue.close();
+    }
+
+    constexpr long long n{numProducers * perProducer};
+    EXPECT_EQ(count.load(), n);
+    EXPECT_EQ(sum.load(), n * (n - 1) / 2);
+}
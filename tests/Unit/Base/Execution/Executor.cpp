@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Execution/Executor.hpp"
+#include "Base/Execution/ThreadPolicy.hpp"
+#include "Base/Errors/Errors.hpp"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+TEST(UnitBaseExecutionExecutor, TaskGroupRunsEveryTaskBeforeWaitReturns)
+{
+    std::atomic<int> count{0};
+    uv::execution::TaskGroup group;
+
+    for (int i{0}; i < 100; ++i)
+        group.run([&] { count.fetch_add(1, std::memory_order_relaxed); });
+
+    group.wait();
+
+    EXPECT_EQ(count.load(), 100);
+}
+
+TEST(UnitBaseExecutionExecutor, TaskGroupRethrowsFirstFailureAndFinishesOthers)
+{
+    std::atomic<int> count{0};
+    uv::execution::TaskGroup group;
+
+    for (int i{0}; i < 16; ++i)
+    {
+        group.run(
+            [&, i]
+            {
+                count.fetch_add(1, std::memory_order_relaxed);
+
+                if (i == 7)
+                    throw std::runtime_error("task failure");
+            }
+        );
+    }
+
+    EXPECT_THROW(group.wait(), std::runtime_error);
+    EXPECT_EQ(count.load(), 16);
+    EXPECT_NO_THROW(group.wait());
+}
+
+TEST(UnitBaseExecutionExecutor, NestedGroupsCompleteWithoutDeadlock)
+{
+    std::atomic<int> count{0};
+    uv::execution::TaskGroup outer;
+
+    for (int i{0}; i < 8; ++i)
+    {
+        outer.run(
+            [&]
+            {
+                uv::execution::TaskGroup inner;
+
+                for (int j{0}; j < 8; ++j)
+                    inner.run([&] { count.fetch_add(1, std::memory_order_relaxed); });
+
+                inner.wait();
+            }
+        );
+    }
+
+    outer.wait();
+
+    EXPECT_EQ(count.load(), 64);
+}
+
+TEST(UnitBaseExecutionExecutor, ThreadRequestsInsideTasksAreSerial)
+{
+    std::atomic<int> requested{0};
+    uv::execution::TaskGroup group;
+
+    group.run([&] { requested.store(uv::execution::requestThreads(-1)); });
+    group.wait();
+
+    EXPECT_FALSE(uv::execution::Executor::insideTask());
+    EXPECT_EQ(requested.load(), 1);
+}
+
+TEST(UnitBaseExecutionExecutor, ConfigureBoundsThreadRequests)
+{
+    uv::execution::Executor& executor{uv::execution::Executor::instance()};
+
+    executor.configure(1);
+
+    EXPECT_EQ(executor.concurrency(), 1);
+    EXPECT_EQ(uv::execution::requestThreads(-1), 1);
+    EXPECT_EQ(uv::execution::requestThreads(8), 1);
+
+    executor.configure(-1);
+
+    EXPECT_GE(executor.concurrency(), 1);
+    EXPECT_THROW(executor.configure(0), uv::errors::UnifiedVolError);
+}
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Execution/Parallel.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+TEST(UnitBaseExecutionParallel, VisitsEveryIndexExactlyOnce)
+{
+    constexpr std::size_t begin{3};
+    constexpr std::size_t end{1003};
+
+    std::vector<std::atomic<int>> visits(end);
+
+    uv::execution::parallelFor(
+        begin,
+        end,
+        [&](std::size_t i) { visits[i].fetch_add(1, std::memory_order_relaxed); },
+        4
+    );
+
+    for (std::size_t i{0}; i < end; ++i)
+    {
+        EXPECT_EQ(visits[i].load(), i < begin ? 0 : 1) << "i=" << i;
+    }
+}
+
+TEST(UnitBaseExecutionParallel, EmptyRangeDoesNothing)
+{
+    bool called{false};
+
+    uv::execution::parallelFor(5, 5, [&](std::size_t) { called = true; });
+
+    EXPECT_FALSE(called);
+}
+
+TEST(UnitBaseExecutionParallel, PropagatesWorkerExceptions)
+{
+    EXPECT_THROW(
+        uv::execution::parallelFor(
+            0,
+            64,
+            [](std::size_t i)
+            {
+                if (i == 63)
+                    throw std::runtime_error("worker failure");
+            },
+            4
+        ),
+        std::runtime_error
+    );
+}
+
+TEST(UnitBaseExecutionParallel, HonoursExplicitGrain)
+{
+    constexpr std::size_t end{257};
+
+    std::vector<std::atomic<int>> visits(end);
+
+    uv::execution::parallelFor(
+        0,
+        end,
+        [&](std::size_t i) { visits[i].fetch_add(1, std::memory_order_relaxed); },
+        -1,
+        16
+    );
+
+    for (std::size_t i{0}; i < end; ++i)
+    {
+        EXPECT_EQ(visits[i].load(), 1) << "i=" << i;
+    }
+}
+
+TEST(UnitBaseExecutionParallel, NestedLoopsVisitEveryPair)
+{
+    constexpr std::size_t n{32};
+
+    std::vector<std::atomic<int>> visits(n * n);
+
+    uv::execution::parallelFor(
+        0,
+        n,
+        [&](std::size_t i)
+        {
+            uv::execution::parallelFor(
+                0,
+                n,
+                [&](std::size_t j)
+                { visits[i * n + j].fetch_add(1, std::memory_order_relaxed); }
+            );
+        }
+    );
+
+    for (std::size_t k{0}; k < n * n; ++k)
+    {
+        EXPECT_EQ(visits[k].load(), 1) << "k=" << k;
+    }
+}
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Execution/Pipeline.hpp"
+#include "Base/Errors/Errors.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct Work
+{
+    int value{};
+    std::vector<int> trace;
+};
+
+std::vector<Work> makeWork(int n)
+{
+    std::vector<Work> items(static_cast<std::size_t>(n));
+    for (int i{0}; i < n; ++i)
+        items[static_cast<std::size_t>(i)].value = i;
+    return items;
+}
+} // namespace
+
+TEST(UnitBaseExecutionPipeline, RunsEveryStageInOrderAndKeepsInputOrder)
+{
+    uv::execution::Pipeline<Work> pipeline;
+    pipeline.addStage("double", [](Work& w) { w.value *= 2; w.trace.push_back(0); }, 2)
+        .addStage("add", [](Work& w) { w.value += 1; w.trace.push_back(1); }, 3)
+        .addStage("square", [](Work& w) { w.value *= w.value; w.trace.push_back(2); });
+
+    const auto results = pipeline.run(makeWork(50));
+
+    ASSERT_EQ(results.size(), 50U);
+    for (std::size_t i{0}; i < results.size(); ++i)
+    {
+        const int expected{2 * static_cast<int>(i) + 1};
+        EXPECT_FALSE(results[i].error);
+        EXPECT_EQ(results[i].item.value, expected * expected);
+        EXPECT_EQ(results[i].item.trace, (std::vector<int>{0, 1, 2}));
+    }
+
+    const auto& stats = pipeline.stats();
+    ASSERT_EQ(stats.stages.size(), 3U);
+    EXPECT_EQ(stats.stages[0].name, "double");
+    EXPECT_EQ(stats.stages[1].workers, 3U);
+    for (const auto& stage : stats.stages)
+        EXPECT_EQ(stage.items, 50U);
+}
+
+TEST(UnitBaseExecutionPipeline, FailedItemsSkipLaterStages)
+{
+    std::atomic<int> lastStageCalls{0};
+
+    uv::execution::Pipeline<Work> pipeline;
+    pipeline
+        .addStage(
+            "parse",
+            [](Work& w)
+            {
+                if (w.value % 3 == 0)
+                    throw std::runtime_error("bad input");
+            }
+        )
+        .addStage("write", [&](Work&) { lastStageCalls.fetch_add(1); });
+
+    const auto results = pipeline.run(makeWork(9));
+
+    for (std::size_t i{0}; i < results.size(); ++i)
+    {
+        EXPECT_EQ(static_cast<bool>(results[i].error), i % 3 == 0);
+        if (results[i].error)
+        {
+            EXPECT_EQ(results[i].failedStage, 0U);
+            EXPECT_THROW(std::rethrow_exception(results[i].error), std::runtime_error);
+        }
+    }
+
+    EXPECT_EQ(lastStageCalls.load(), 6);
+    EXPECT_EQ(pipeline.stats().stages[0].failures, 3U);
+    EXPECT_EQ(pipeline.stats().stages[1].items, 6U);
+}
+
+TEST(UnitBaseExecutionPipeline, BoundedQueuesLimitItemsInFlight)
+{
+    constexpr std::size_t capacity{2};
+    std::atomic<int> started{0};
+    std::atomic<int> finished{0};
+    std::atomic<int> maxAhead{0};
+
+    uv::execution::Pipeline<Work> pipeline;
+    pipeline
+        .addStage(
+            "fast",
+            [&](Work&)
+            {
+                const int ahead{started.fetch_add(1) + 1 - finished.load()};
+                int seen{maxAhead.load()};
+                while (ahead > seen && !maxAhead.compare_exchange_weak(seen, ahead))
+                {
+                }
+            }
+        )
+        .addStage(
+            "slow",
+            [&](Work&)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                finished.fetch_add(1);
+            },
+            1,
+            capacity
+        );
+
+    const auto results = pipeline.run(makeWork(20));
+
+    EXPECT_EQ(results.size(), 20U);
+    // At most: one item in the slow stage, `capacity` queued before it, one held by
+    // the fast worker waiting to push, and the one being counted.
+    EXPECT_LE(maxAhead.load(), static_cast<int>(capacity) + 3);
+    EXPECT_GT(pipeline.stats().stages[0].blockedMs, 0.0);
+}
+
+TEST(UnitBaseExecutionPipeline, RejectsRunWithoutStages)
+{
+    uv::execution::Pipeline<Work> pipeline;
+
+    EXPECT_THROW(
+        static_cast<void>(pipeline.run(makeWork(1))),
+        uv::errors::UnifiedVolError
+    );
+}
+
+TEST(UnitBaseExecutionPipeline, HandlesEmptyInput)
+{
+    uv::execution::Pipeline<Work> pipeline;
+    pipeline.addStage("noop", [](Work&) {}, 4);
+
+    EXPECT_TRUE(pipeline.run({}).empty());
+    EXPECT_EQ(pipeline.stats().stages[0].items, 0U);
+}
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Utils/CycleClock.hpp"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+
+using uv::utils::CycleClock;
+
+TEST(UnitBaseUtilsCycleClock, ConvertsCyclesToWallTime)
+{
+    EXPECT_GT(CycleClock::nsPerCycle(), 0.0);
+
+    const auto t0 = std::chrono::steady_clock::now();
+    const std::uint64_t c0{CycleClock::start()};
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+
+    const std::uint64_t c1{CycleClock::stop()};
+    const double wallNs{
+        std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0)
+            .count()
+    };
+
+    ASSERT_GT(c1, c0);
+
+    const double clockNs{CycleClock::toNs(c1 - c0)};
+
+    EXPECT_GT(clockNs, 0.5 * wallNs);
+    EXPECT_LT(clockNs, 1.5 * wallNs);
+}
+
+TEST(UnitBaseUtilsCycleClock, SamplerRecordsOneObservationPerScope)
+{
+    using uv::utils::Histogram;
+    using uv::utils::Metrics;
+
+    const auto before = Metrics::snapshot();
+
+    for (int i{0}; i < 5; ++i)
+    {
+        const uv::utils::CycleSampler sampler{Histogram::ImpliedVolCycles};
+    }
+
+    const auto hist = (Metrics::snapshot() - before)[Histogram::ImpliedVolCycles];
+
+    EXPECT_EQ(hist.count, 5u);
+    EXPECT_LE(hist.quantile(0.5), hist.quantile(0.99));
+}
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Utils/Detail/Log.hpp"
+
+#include <cstddef>
+#include <format>
+#include <gtest/gtest.h>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+std::vector<std::string> capturedLines(const std::string& marker)
+{
+    std::istringstream in{testing::internal::GetCapturedStdout()};
+    std::vector<std::string> lines;
+
+    for (std::string line; std::getline(in, line);)
+    {
+        if (line.find(marker) != std::string::npos)
+            lines.push_back(line);
+    }
+
+    return lines;
+}
+} // namespace
+
+TEST(UnitBaseUtilsLog, FlushWritesEveryMessageTaggedByThread)
+{
+    constexpr int producers{4};
+    constexpr int perProducer{3000};
+
+    uv::utils::Log& log{uv::utils::Log::instance()};
+
+    testing::internal::CaptureStdout();
+
+    {
+        std::vector<std::jthread> threads;
+
+        for (int p{0}; p < producers; ++p)
+        {
+            threads.emplace_back(
+                [&log, p]
+                {
+                    for (int i{0}; i < perProducer; ++i)
+                        log.log(uv::utils::Level::Info, std::format("logtest {} {}", p, i));
+                }
+            );
+        }
+    }
+
+    log.flush();
+
+    const std::vector<std::string> lines{capturedLines("logtest")};
+
+    ASSERT_EQ(lines.size(), static_cast<std::size_t>(producers * perProducer));
+
+    std::map<std::string, std::string> producerOfTag;
+    std::map<int, int> next;
+
+    for (const std::string& line : lines)
+    {
+        const std::size_t tagBegin{line.find("][T")};
+        const std::size_t tagEnd{line.find(']', tagBegin + 1)};
+
+        ASSERT_NE(tagBegin, std::string::npos);
+        ASSERT_NE(line.find("[INFO]"), std::string::npos);
+
+        std::istringstream body{line.substr(line.find("logtest") + 7)};
+        int p{-1};
+        int i{-1};
+        body >> p >> i;
+
+        const std::string tag{line.substr(tagBegin + 3, tagEnd - tagBegin - 3)};
+        const auto [it, inserted] = producerOfTag.emplace(tag, std::to_string(p));
+
+        EXPECT_EQ(it->second, std::to_string(p));
+        EXPECT_EQ(i, next[p]++);
+    }
+
+    EXPECT_EQ(producerOfTag.size(), static_cast<std::size_t>(producers));
+}
+
+TEST(UnitBaseUtilsLog, ConsoleSwitchAppliesWhenMessageIsLogged)
+{
+    uv::utils::Log& log{uv::utils::Log::instance()};
+
+    testing::internal::CaptureStdout();
+
+    log.enableConsole(false);
+    log.log(uv::utils::Level::Warn, "logswitch hidden");
+    log.enableConsole(true);
+    log.log(uv::utils::Level::Warn, "logswitch shown");
+    log.flush();
+
+    const std::vector<std::string> lines{capturedLines("logswitch")};
+
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_NE(lines.front().find("[WARN]"), std::string::npos);
+    EXPECT_NE(lines.front().find("shown"), std::string::npos);
+}
+
+TEST(UnitBaseUtilsLog, BlockingOverflowLosesNothing)
+{
+    constexpr std::size_t count{3 * uv::utils::Log::queueCapacity};
+
+    uv::utils::Log& log{uv::utils::Log::instance()};
+    const std::uint64_t droppedBefore{log.dropped()};
+
+    log.setOverflow(uv::utils::Overflow::Block);
+    testing::internal::CaptureStdout();
+
+    for (std::size_t i{0}; i < count; ++i)
+        log.log(uv::utils::Level::Info, "logblock");
+
+    log.flush();
+
+    EXPECT_EQ(capturedLines("logblock").size(), count);
+    EXPECT_EQ(log.dropped(), droppedBefore);
+}
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Utils/Metrics.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using uv::utils::Counter;
+using uv::utils::Histogram;
+using uv::utils::Metrics;
+
+TEST(UnitBaseUtilsMetrics, SumsCountersAcrossThreads)
+{
+    constexpr std::size_t numThreads{4};
+    constexpr std::size_t perThread{1000};
+
+    const auto before = Metrics::snapshot();
+
+    {
+        std::vector<std::jthread> threads;
+
+        for (std::size_t t{0}; t < numThreads; ++t)
+        {
+            threads.emplace_back(
+                []
+                {
+                    for (std::size_t i{0}; i < perThread; ++i)
+                        Metrics::add(Counter::ImpliedVolSolves);
+
+                    Metrics::add(Counter::CeresJacobian, 3);
+                }
+            );
+        }
+    }
+
+    const auto work = Metrics::snapshot() - before;
+
+    EXPECT_EQ(work[Counter::ImpliedVolSolves], numThreads * perThread);
+    EXPECT_EQ(work[Counter::CeresJacobian], 3 * numThreads);
+    EXPECT_EQ(work[Counter::CharFunction], 0u);
+}
+
+TEST(UnitBaseUtilsMetrics, BucketsHistogramByPowerOfTwo)
+{
+    const auto before = Metrics::snapshot();
+
+    for (const std::uint64_t value : {1u, 2u, 3u, 4u, 5u, 100000u})
+        Metrics::observe(Histogram::QuadratureNodes, value);
+
+    const auto hist = (Metrics::snapshot() - before)[Histogram::QuadratureNodes];
+
+    EXPECT_EQ(hist.count, 6u);
+    EXPECT_EQ(hist.sum, 100015u);
+    EXPECT_EQ(hist.buckets[0], 1u);
+    EXPECT_EQ(hist.buckets[1], 1u);
+    EXPECT_EQ(hist.buckets[2], 2u);
+    EXPECT_EQ(hist.buckets[3], 1u);
+    EXPECT_EQ(hist.buckets[17], 1u);
+    EXPECT_EQ(hist.quantile(0.5), 4u);
+    EXPECT_EQ(hist.quantile(1.0), std::uint64_t{1} << 17);
+}
+
+TEST(UnitBaseUtilsMetrics, FormatsPrometheusText)
+{
+    uv::utils::MetricsSnapshot snap;
+    snap.counters[static_cast<std::size_t>(Counter::NLoptObjective)] = 42;
+    snap.histograms[0].buckets[0] = 2;
+    snap.histograms[0].buckets[2] = 1;
+    snap.histograms[0].count = 3;
+    snap.histograms[0].sum = 6;
+
+    const std::string text{Metrics::prometheus(snap)};
+
+    EXPECT_NE(
+        text.find("# TYPE uv_nlopt_objective_evals_total counter\n"),
+        std::string::npos
+    );
+    EXPECT_NE(text.find("\nuv_nlopt_objective_evals_total 42\n"), std::string::npos);
+    EXPECT_NE(
+        text.find("uv_quadrature_nodes_per_integral_bucket{le=\"2\"} 2\n"),
+        std::string::npos
+    );
+    EXPECT_NE(
+        text.find("uv_quadrature_nodes_per_integral_bucket{le=\"4\"} 3\n"),
+        std::string::npos
+    );
+    EXPECT_NE(
+        text.find("uv_quadrature_nodes_per_integral_bucket{le=\"+Inf\"} 3\n"),
+        std::string::npos
+    );
+    EXPECT_NE(text.find("uv_quadrature_nodes_per_integral_count 3\n"), std::string::npos);
+}
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Utils/Profiler.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+const uv::utils::ZoneStats* find(
+    const std::vector<uv::utils::ZoneStats>& stats,
+    const std::string& path
+)
+{
+    const auto it = std::find_if(
+        stats.begin(),
+        stats.end(),
+        [&path](const uv::utils::ZoneStats& s) { return s.path == path; }
+    );
+
+    return (it == stats.end()) ? nullptr : &*it;
+}
+} // namespace
+
+TEST(UnitBaseUtilsProfiler, AggregatesNestedZonesByPath)
+{
+    uv::utils::Profiler& profiler{uv::utils::Profiler::instance()};
+    profiler.reset();
+
+    {
+        uv::utils::Zone outer{"outer"};
+
+        for (int i{0}; i < 3; ++i)
+        {
+            uv::utils::Zone inner{"inner"};
+        }
+    }
+
+    {
+        uv::utils::Zone inner{"inner"};
+    }
+
+    const std::vector<uv::utils::ZoneStats> stats{profiler.summary()};
+
+    ASSERT_EQ(stats.size(), 3u);
+
+    const uv::utils::ZoneStats* outer{find(stats, "outer")};
+    const uv::utils::ZoneStats* nested{find(stats, "outer/inner")};
+    const uv::utils::ZoneStats* root{find(stats, "inner")};
+
+    ASSERT_NE(outer, nullptr);
+    ASSERT_NE(nested, nullptr);
+    ASSERT_NE(root, nullptr);
+
+    EXPECT_EQ(outer->count, 1u);
+    EXPECT_EQ(nested->count, 3u);
+    EXPECT_EQ(nested->depth, 1u);
+    EXPECT_EQ(root->count, 1u);
+    EXPECT_EQ(root->depth, 0u);
+
+    EXPECT_LT(outer - stats.data(), nested - stats.data());
+    EXPECT_LE(nested->minMs, nested->meanMs);
+    EXPECT_LE(nested->meanMs, nested->p99Ms);
+    EXPECT_LE(nested->p99Ms, nested->maxMs);
+    EXPECT_GE(outer->totalMs, nested->totalMs);
+}
+
+TEST(UnitBaseUtilsProfiler, KeepsPerThreadBuffers)
+{
+    constexpr std::size_t numThreads{3};
+    constexpr std::size_t perThread{50};
+
+    uv::utils::Profiler& profiler{uv::utils::Profiler::instance()};
+    profiler.reset();
+
+    {
+        std::vector<std::jthread> threads;
+
+        for (std::size_t t{0}; t < numThreads; ++t)
+        {
+            threads.emplace_back(
+                []
+                {
+                    for (std::size_t i{0}; i < perThread; ++i)
+                    {
+                        uv::utils::Zone zone{"work"};
+                    }
+                }
+            );
+        }
+    }
+
+    const auto events = profiler.events();
+
+    ASSERT_EQ(events.size(), numThreads * perThread);
+
+    std::vector<std::uint32_t> threadIds;
+
+    for (const auto& e : events)
+        threadIds.push_back(e.thread);
+
+    std::sort(threadIds.begin(), threadIds.end());
+    threadIds.erase(std::unique(threadIds.begin(), threadIds.end()), threadIds.end());
+
+    EXPECT_EQ(threadIds.size(), numThreads);
+    EXPECT_EQ(find(profiler.summary(), "work")->count, numThreads * perThread);
+}
+
+TEST(UnitBaseUtilsProfiler, ExportsChromeTraceEvents)
+{
+    uv::utils::Profiler& profiler{uv::utils::Profiler::instance()};
+    profiler.reset();
+
+    {
+        uv::utils::Zone zone{"quoted \"zone\""};
+    }
+
+    const std::string trace{profiler.chromeTrace()};
+
+    EXPECT_TRUE(trace.starts_with("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[{"));
+    EXPECT_NE(trace.find("\"name\":\"quoted \\\"zone\\\"\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(profiler.summaryTable().find("quoted \"zone\""), std::string::npos);
+
+    profiler.reset();
+
+    EXPECT_EQ(profiler.chromeTrace(), "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[]}\n");
+}
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Utils/RingBuffer.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+TEST(UnitBaseUtilsRingBuffer, RoundsCapacityUpToPowerOfTwo)
+{
+    EXPECT_EQ(uv::utils::RingBuffer<int>{5}.capacity(), 8u);
+    EXPECT_EQ(uv::utils::RingBuffer<int>{8}.capacity(), 8u);
+    EXPECT_EQ(uv::utils::RingBuffer<int>{0}.capacity(), 2u);
+}
+
+TEST(UnitBaseUtilsRingBuffer, KeepsValueWhenFull)
+{
+    uv::utils::RingBuffer<std::string> ring{2};
+
+    for (std::string value : {"a", "b"})
+        ASSERT_TRUE(ring.tryPush(value));
+
+    std::string rejected{"c"};
+
+    EXPECT_FALSE(ring.tryPush(rejected));
+    EXPECT_EQ(rejected, "c");
+    EXPECT_EQ(ring.pushed(), 2u);
+
+    std::string out;
+
+    ASSERT_TRUE(ring.tryPop(out));
+    EXPECT_EQ(out, "a");
+    EXPECT_TRUE(ring.tryPush(rejected));
+
+    ASSERT_TRUE(ring.tryPop(out));
+    EXPECT_EQ(out, "b");
+    ASSERT_TRUE(ring.tryPop(out));
+    EXPECT_EQ(out, "c");
+    EXPECT_FALSE(ring.tryPop(out));
+}
+
+TEST(UnitBaseUtilsRingBuffer, PreservesPerProducerOrder)
+{
+    constexpr int producers{4};
+    constexpr int perProducer{5000};
+
+    uv::utils::RingBuffer<std::pair<int, int>> ring{64};
+    std::vector<std::jthread> threads;
+
+    for (int p{0}; p < producers; ++p)
+    {
+        threads.emplace_back(
+            [&ring, p]
+            {
+                for (int i{0}; i < perProducer; ++i)
+                {
+                    std::pair<int, int> value{p, i};
+
+                    while (!ring.tryPush(value))
+                        std::this_thread::yield();
+                }
+            }
+        );
+    }
+
+    std::vector<int> next(producers, 0);
+    std::pair<int, int> value;
+
+    for (int received{0}; received < producers * perProducer;)
+    {
+        if (!ring.tryPop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        EXPECT_EQ(value.second, next[static_cast<std::size_t>(value.first)]++);
+        ++received;
+    }
+
+    for (const int count : next)
+        EXPECT_EQ(count, perProducer);
+}
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "IO/Binary/VolSurface.hpp"
+#include "Base/Errors/Errors.hpp"
+#include "Core/Matrix.hpp"
+#include "Support/TempFile.hpp"
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+uv::core::VolSurface<double> makeSurface()
+{
+    const std::vector<double> maturities{0.1, 0.5, 1.0};
+    const std::vector<double> forwards{100.1, 100.5, 101.0};
+    const std::vector<double> strikes{80.0, 90.0, 100.0, 110.0};
+    const std::vector<double> moneyness{0.8, 0.9, 1.0, 1.1};
+
+    uv::core::Matrix<double> vol(3, 4);
+    for (std::size_t i{0}; i < 3; ++i)
+        for (std::size_t j{0}; j < 4; ++j)
+            vol[i][j] = 0.2 + 0.01 * static_cast<double>(i + j);
+
+    return uv::core::VolSurface<double>{maturities, forwards, strikes, moneyness, vol};
+}
+} // namespace
+
+TEST(UnitIOBinaryVolSurface, RoundTripsExactly)
+{
+    const auto surface = makeSurface();
+    const auto path = std::filesystem::temp_directory_path() / "unifiedvol_surface.uvs";
+
+    uv::io::binary::write(path, surface);
+    const auto loaded = uv::io::binary::readVolSurface<double>(path);
+
+    ASSERT_EQ(loaded.numMaturities(), surface.numMaturities());
+    ASSERT_EQ(loaded.numStrikes(), surface.numStrikes());
+
+    for (std::size_t i{0}; i < surface.numMaturities(); ++i)
+    {
+        EXPECT_EQ(loaded.maturities()[i], surface.maturities()[i]);
+        EXPECT_EQ(loaded.forwards()[i], surface.forwards()[i]);
+        for (std::size_t j{0}; j < surface.numStrikes(); ++j)
+            EXPECT_EQ(loaded.vol()[i][j], surface.vol()[i][j]);
+    }
+
+    for (std::size_t j{0}; j < surface.numStrikes(); ++j)
+    {
+        EXPECT_EQ(loaded.strikes()[j], surface.strikes()[j]);
+        EXPECT_EQ(loaded.moneyness()[j], surface.moneyness()[j]);
+    }
+}
+
+TEST(UnitIOBinaryVolSurface, RejectsWrongScalarType)
+{
+    const auto path = std::filesystem::temp_directory_path() / "unifiedvol_surface_f.uvs";
+    uv::io::binary::write(path, makeSurface());
+
+    EXPECT_THROW(
+        static_cast<void>(uv::io::binary::readVolSurface<float>(path)),
+        uv::errors::UnifiedVolError
+    );
+}
+
+TEST(UnitIOBinaryVolSurface, RejectsForeignAndTruncatedFiles)
+{
+    const auto foreign = uv::tests::writeTempFile(
+        "unifiedvol_surface_foreign.uvs",
+        "not a surface file, just some text that is long enough for a header"
+    );
+    EXPECT_THROW(
+        static_cast<void>(uv::io::binary::readVolSurface<double>(foreign)),
+        uv::errors::UnifiedVolError
+    );
+
+    const auto path =
+        std::filesystem::temp_directory_path() / "unifiedvol_surface_cut.uvs";
+    uv::io::binary::write(path, makeSurface());
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8);
+
+    EXPECT_THROW(
+        static_cast<void>(uv::io::binary::readVolSurface<double>(path)),
+        uv::errors::UnifiedVolError
+    );
+}
@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "IO/CSV/Manifest.hpp"
+#include "Base/Errors/Errors.hpp"
+#include "Support/TempFile.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(UnitIOCSVManifest, ReadsEntriesAndResolvesRelativePaths)
+{
+    const auto path = uv::tests::writeTempFile(
+        "unifiedvol_manifest.csv",
+        "name,file,spot,rate,dividendYield\n"
+        "# comment\n"
+        "\n"
+        "SPY, surfaces/spy.csv, 485.77, 0.01, 0.015\n"
+        "QQQ,/data/qqq.csv,350,0,0\n"
+    );
+
+    const auto entries = uv::io::csv::readManifest(path);
+
+    ASSERT_EQ(entries.size(), 2U);
+    EXPECT_EQ(entries[0].name, "SPY");
+    EXPECT_EQ(entries[0].file, path.parent_path() / "surfaces/spy.csv");
+    EXPECT_DOUBLE_EQ(entries[0].marketData.spot, 485.77);
+    EXPECT_DOUBLE_EQ(entries[0].marketData.interestRate, 0.01);
+    EXPECT_DOUBLE_EQ(entries[0].marketData.dividendYield, 0.015);
+    EXPECT_EQ(entries[1].file, std::filesystem::path{"/data/qqq.csv"});
+}
+
+TEST(UnitIOCSVManifest, RejectsMalformedManifests)
+{
+    const auto expectRejected = [](const char* name, const char* contents)
+    {
+        const auto path = uv::tests::writeTempFile(name, contents);
+        EXPECT_THROW(
+            static_cast<void>(uv::io::csv::readManifest(path)),
+            uv::errors::UnifiedVolError
+        ) << contents;
+    };
+
+    expectRejected(
+        "unifiedvol_manifest_empty.csv",
+        "name,file,spot,rate,dividendYield\n"
+    );
+    expectRejected(
+        "unifiedvol_manifest_header.csv",
+        "name,path,spot,rate,q\nA,a.csv,1,0,0\n"
+    );
+    expectRejected(
+        "unifiedvol_manifest_columns.csv",
+        "name,file,spot,rate,dividendYield\nA,a.csv,1,0\n"
+    );
+    expectRejected(
+        "unifiedvol_manifest_number.csv",
+        "name,file,spot,rate,dividendYield\nA,a.csv,abc,0,0\n"
+    );
+    expectRejected(
+        "unifiedvol_manifest_spot.csv",
+        "name,file,spot,rate,dividendYield\nA,a.csv,-5,0,0\n"
+    );
+}
+
+TEST(UnitIOCSVManifest, RejectsMissingFile)
+{
+    EXPECT_THROW(
+        static_cast<void>(uv::io::csv::readManifest("does/not/exist.csv")),
+        uv::errors::UnifiedVolError
+    );
+}
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "IO/CSV/Ticks.hpp"
+#include "Base/Errors/Errors.hpp"
+#include "Support/TempFile.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(UnitIOCSVTicks, ReadsUpdatesInOrder)
+{
+    const auto path = uv::tests::writeTempFile(
+        "unifiedvol_ticks.csv",
+        "seq,maturity,moneyness,vol\n"
+        "# comment\n"
+        "\n"
+        "1, 0.25, 1.0, 0.33\n"
+        "1,0.25,1.05,0.29\n"
+        "4,1,0.9,0.27\n"
+    );
+
+    const auto ticks = uv::io::csv::readTicks(path);
+
+    ASSERT_EQ(ticks.size(), 3U);
+    EXPECT_EQ(ticks[0].seq, 1U);
+    EXPECT_DOUBLE_EQ(ticks[0].maturity, 0.25);
+    EXPECT_DOUBLE_EQ(ticks[0].moneyness, 1.0);
+    EXPECT_DOUBLE_EQ(ticks[0].vol, 0.33);
+    EXPECT_EQ(ticks[1].seq, 1U);
+    EXPECT_EQ(ticks[2].seq, 4U);
+    EXPECT_DOUBLE_EQ(ticks[2].moneyness, 0.9);
+}
+
+TEST(UnitIOCSVTicks, ReadsRecordedFixture)
+{
+    const auto ticks = uv::io::csv::readTicks("data/ticks_SPY_04072011.csv");
+
+    ASSERT_FALSE(ticks.empty());
+    for (std::size_t i{1}; i < ticks.size(); ++i)
+        EXPECT_LE(ticks[i - 1].seq, ticks[i].seq);
+}
+
+TEST(UnitIOCSVTicks, RejectsMalformedTickFiles)
+{
+    const auto expectRejected = [](const char* name, const char* contents)
+    {
+        const auto path = uv::tests::writeTempFile(name, contents);
+        EXPECT_THROW(
+            static_cast<void>(uv::io::csv::readTicks(path)),
+            uv::errors::UnifiedVolError
+        ) << contents;
+    };
+
+    expectRejected("unifiedvol_ticks_empty.csv", "seq,maturity,moneyness,vol\n");
+    expectRejected("unifiedvol_ticks_header.csv", "seq,t,k,vol\n1,1,1,0.2\n");
+    expectRejected("unifiedvol_ticks_columns.csv", "seq,maturity,moneyness,vol\n1,1,1\n");
+    expectRejected("unifiedvol_ticks_seq.csv", "seq,maturity,moneyness,vol\nx,1,1,0.2\n");
+    expectRejected(
+        "unifiedvol_ticks_order.csv",
+        "seq,maturity,moneyness,vol\n2,1,1,0.2\n1,1,1,0.2\n"
+    );
+    expectRejected(
+        "unifiedvol_ticks_vol.csv",
+        "seq,maturity,moneyness,vol\n1,1,1,-0.2\n"
+    );
+    expectRejected(
+        "unifiedvol_ticks_moneyness.csv",
+        "seq,maturity,moneyness,vol\n1,1,0,0.2\n"
+    );
+}
@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "IO/CSV/Write.hpp"
+#include "Core/Generate.hpp"
+#include "Core/Matrix.hpp"
+#include "IO/CSV/Load.hpp"
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(UnitIOCSVWrite, RoundTripsThroughMarketStateLoader)
+{
+    const uv::core::MarketData<double> marketData{
+        .interestRate = 0.01,
+        .dividendYield = 0.005,
+        .spot = 100.0
+    };
+    const std::vector<double> maturities{0.25, 1.0 / 3.0, 0.5};
+    const std::vector<double> moneyness{0.8, 1.0, 1.2};
+
+    uv::core::Matrix<double> vol(3, 3);
+    for (std::size_t i{0}; i < 3; ++i)
+        for (std::size_t j{0}; j < 3; ++j)
+        {
+            const double row{0.01 * static_cast<double>(i)};
+            vol[i][j] = 0.2 + row + 0.03 * static_cast<double>(j);
+        }
+
+    const auto original = uv::core::generateMarketState<double>(
+        marketData,
+        maturities,
+        moneyness,
+        vol
+    );
+
+    const auto path = std::filesystem::temp_directory_path() / "unifiedvol_write.csv";
+    uv::io::csv::write::volSurface(path, original.volSurface);
+
+    const auto reloaded = uv::io::csv::load::marketState(path, marketData);
+
+    const auto& a = original.volSurface;
+    const auto& b = reloaded.volSurface;
+
+    ASSERT_EQ(b.numMaturities(), a.numMaturities());
+    ASSERT_EQ(b.numStrikes(), a.numStrikes());
+
+    for (std::size_t i{0}; i < a.numMaturities(); ++i)
+    {
+        EXPECT_EQ(b.maturities()[i], a.maturities()[i]);
+        for (std::size_t j{0}; j < a.numStrikes(); ++j)
+            EXPECT_EQ(b.vol()[i][j], a.vol()[i][j]);
+    }
+
+    for (std::size_t j{0}; j < a.numStrikes(); ++j)
+        EXPECT_EQ(b.moneyness()[j], a.moneyness()[j]);
+}
@@ -15,6 +15,20 @@ TEST(MathPrimitive, NormalPdfAndCdfHaveKnownValues)
     EXPECT_NEAR(uv::math::normalCDF(-1.0), 0.15865525393145707, 1e-15);
 }
 
+TEST(MathPrimitive, NormalInvCdfInvertsNormalCdf)
+{
+    for (const double x : {-8.0, -3.5, -1.0, -1e-3, 0.0, 0.5, 2.0, 4.0})
+    {
+        const double p = uv::math::normalCDF(x);
+
+        EXPECT_NEAR(uv::math::normalInvCDF(p), x, 1e-12 * (1.0 + std::abs(x)));
+    }
+
+    EXPECT_NEAR(uv::math::normalInvCDF(0.975), 1.959963984540054, 1e-14);
+    EXPECT_TRUE(std::isinf(uv::math::normalInvCDF(0.0)));
+    EXPECT_TRUE(std::isinf(uv::math::normalInvCDF(1.0)));
+}
+
 TEST(MathPrimitive, ComplexHelpersMatchStandardLibrary)
 {
     const std::complex<double> z{0.25, -0.2};
@@ -1,9 +1,11 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Math/Integration/TanHSinH.hpp"
+#include "Base/Utils/Metrics.hpp"
 
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <gtest/gtest.h>
 
 TEST(MathIntegrationTanHSinH, IntegratesExponentialOnZeroToInfinity)
@@ -34,3 +36,30 @@ TEST(MathIntegrationTanHSinH, MultiIntegralMatchesScalarMoments)
     EXPECT_NEAR(integrals[0], 1.0, 1e-12);
     EXPECT_NEAR(integrals[1], 1.0, 1e-12);
 }
+
+TEST(MathIntegrationTanHSinH, RecordsNodesConsumedPerIntegral)
+{
+    using uv::utils::Counter;
+    using uv::utils::Histogram;
+    using uv::utils::Metrics;
+
+    const uv::math::integration::TanHSinH<double, 128> integrator;
+    const auto before = Metrics::snapshot();
+
+    std::uint64_t calls{0};
+    integrator.integrateZeroToInf(
+        [&calls](double x)
+        {
+            ++calls;
+            return std::exp(-x);
+        }
+    );
+
+    const auto work = Metrics::snapshot() - before;
+
+    EXPECT_EQ(work[Counter::Integrals], 1u);
+    EXPECT_EQ(work[Counter::QuadratureNodes], calls);
+    EXPECT_LT(calls, 128u);
+    EXPECT_EQ(work[Histogram::QuadratureNodes].count, 1u);
+    EXPECT_EQ(work[Histogram::QuadratureNodes].sum, calls);
+}
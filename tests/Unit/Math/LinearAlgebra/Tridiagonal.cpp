@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 
+#include "Base/Errors/Errors.hpp"
 #include "Math/LinearAlgebra/Tridiagonal.hpp"
 #include "Support/Math/LinearAlgebra/Tridiagonal.hpp"
 
@@ -8,6 +9,8 @@
 #include <cstddef>
 #include <gtest/gtest.h>
 #include <random>
+#include <span>
+#include <vector>
 
 namespace uv::tests::unit::linear_algebra::detail
 {
@@ -62,6 +65,125 @@ template <std::size_t N> void runRandomDiagonallyDominantCases(const std::size_t
         solveAndExpectNear(rhs, upper, middle, lower, expected, 1e-11);
     }
 }
+
+template <std::size_t N> struct InterleavedSystems
+{
+    std::vector<double> upper;
+    std::vector<double> middle;
+    std::vector<double> lower;
+    std::vector<double> rhs;
+    std::vector<double> expected;
+};
+
+template <std::size_t N>
+InterleavedSystems<N> makeInterleavedSystems(const std::size_t batch, bool sharedMatrix)
+{
+    std::mt19937_64 rng{0xB47C4ED0ULL + N + batch};
+    std::uniform_real_distribution<double> offDiagonal{-0.75, 0.75};
+    std::uniform_real_distribution<double> solution{-5.0, 5.0};
+    std::uniform_real_distribution<double> margin{0.25, 2.0};
+
+    const std::size_t matrixLanes{sharedMatrix ? 1 : batch};
+
+    InterleavedSystems<N> systems{
+        std::vector<double>(N * matrixLanes),
+        std::vector<double>(N * matrixLanes),
+        std::vector<double>(N * matrixLanes),
+        std::vector<double>(N * batch),
+        std::vector<double>(N * batch)
+    };
+
+    std::array<double, N> upper{};
+    std::array<double, N> middle{};
+    std::array<double, N> lower{};
+    std::array<double, N> expected{};
+
+    for (std::size_t b{0}; b < batch; ++b)
+    {
+        if (b < matrixLanes)
+        {
+            for (std::size_t i{0}; i < N; ++i)
+            {
+                upper[i] = (i + 1 < N) ? offDiagonal(rng) : 0.0;
+                lower[i] = (i > 0) ? offDiagonal(rng) : 0.0;
+                middle[i] = std::abs(upper[i]) + std::abs(lower[i]) + margin(rng);
+
+                systems.upper[i * matrixLanes + b] = upper[i];
+                systems.middle[i * matrixLanes + b] = middle[i];
+                systems.lower[i * matrixLanes + b] = lower[i];
+            }
+        }
+
+        for (std::size_t i{0}; i < N; ++i)
+        {
+            expected[i] = solution(rng);
+        }
+
+        const auto rhs{uv::tests::math::linear_algebra::multiplyTridiagonal(
+            upper,
+            middle,
+            lower,
+            expected
+        )};
+
+        for (std::size_t i{0}; i < N; ++i)
+        {
+            systems.rhs[i * batch + b] = rhs[i];
+            systems.expected[i * batch + b] = expected[i];
+        }
+    }
+
+    return systems;
+}
+
+struct DynamicSystem
+{
+    std::vector<double> upper;
+    std::vector<double> middle;
+    std::vector<double> lower;
+    std::vector<double> rhs;
+    std::vector<double> expected;
+};
+
+inline DynamicSystem makeDynamicSystem(const std::size_t n)
+{
+    std::mt19937_64 rng{0xD1A6ULL + n};
+    std::uniform_real_distribution<double> offDiagonal{-0.75, 0.75};
+    std::uniform_real_distribution<double> solution{-5.0, 5.0};
+    std::uniform_real_distribution<double> margin{0.25, 2.0};
+
+    DynamicSystem system{
+        std::vector<double>(n),
+        std::vector<double>(n),
+        std::vector<double>(n),
+        std::vector<double>(n),
+        std::vector<double>(n)
+    };
+
+    for (std::size_t i{0}; i < n; ++i)
+    {
+        system.upper[i] = (i + 1 < n) ? offDiagonal(rng) : 0.0;
+        system.lower[i] = (i > 0) ? offDiagonal(rng) : 0.0;
+        system.middle[i] =
+            std::abs(system.upper[i]) + std::abs(system.lower[i]) + margin(rng);
+        system.expected[i] = solution(rng);
+    }
+
+    for (std::size_t i{0}; i < n; ++i)
+    {
+        system.rhs[i] = system.middle[i] * system.expected[i];
+        if (i > 0)
+        {
+            system.rhs[i] += system.lower[i] * system.expected[i - 1];
+        }
+        if (i + 1 < n)
+        {
+            system.rhs[i] += system.upper[i] * system.expected[i + 1];
+        }
+    }
+
+    return system;
+}
 } // namespace uv::tests::unit::linear_algebra::detail
 
 using namespace uv::tests::unit::linear_algebra::detail;
@@ -140,3 +262,327 @@ TEST(MathTridiagonal, ThomasSolveSupportsFloat)
 
     solveAndExpectNear(rhs, upper, middle, lower, expected, 1e-5);
 }
+
+TEST(MathTridiagonal, ThomasSolveBatchSolvesInterleavedSystems)
+{
+    constexpr std::size_t n{16};
+    constexpr std::size_t batch{7};
+
+    auto systems{makeInterleavedSystems<n>(batch, false)};
+    std::vector<double> scratch(n * batch);
+
+    uv::math::linear_algebra::thomasSolveBatch<double>(
+        systems.rhs,
+        systems.upper,
+        systems.middle,
+        systems.lower,
+        scratch,
+        batch
+    );
+
+    for (std::size_t i{0}; i < n * batch; ++i)
+    {
+        EXPECT_NEAR(systems.rhs[i], systems.expected[i], 1e-11) << "i=" << i;
+    }
+}
+
+TEST(MathTridiagonal, ThomasSolveBatchRejectsInconsistentSizes)
+{
+    std::vector<double> x(9);
+    std::vector<double> coefficients(9, 1.0);
+    std::vector<double> shortScratch(8);
+
+    EXPECT_THROW(
+        uv::math::linear_algebra::thomasSolveBatch<double>(
+            x,
+            coefficients,
+            coefficients,
+            coefficients,
+            shortScratch,
+            3
+        ),
+        uv::errors::UnifiedVolError
+    );
+    EXPECT_THROW(
+        uv::math::linear_algebra::thomasSolveBatch<double>(
+            x,
+            coefficients,
+            coefficients,
+            coefficients,
+            x,
+            2
+        ),
+        uv::errors::UnifiedVolError
+    );
+}
+
+TEST(MathTridiagonal, ThomasFactorizationReusesSharedMatrixAcrossRightHandSides)
+{
+    constexpr std::size_t n{32};
+    constexpr std::size_t numRhs{5};
+
+    auto systems{makeInterleavedSystems<n>(numRhs, true)};
+
+    const uv::math::linear_algebra::ThomasFactorization<double> factorization{
+        systems.upper,
+        systems.middle,
+        systems.lower
+    };
+
+    EXPECT_EQ(factorization.size(), n);
+    EXPECT_EQ(factorization.batch(), 1U);
+
+    factorization.solve(systems.rhs);
+
+    for (std::size_t i{0}; i < n * numRhs; ++i)
+    {
+        EXPECT_NEAR(systems.rhs[i], systems.expected[i], 1e-11) << "i=" << i;
+    }
+}
+
+TEST(MathTridiagonal, ThomasFactorizationSolvesContiguousLines)
+{
+    constexpr std::size_t n{24};
+    constexpr std::size_t numLines{6};
+
+    const auto systems{makeInterleavedSystems<n>(numLines, true)};
+
+    const uv::math::linear_algebra::ThomasFactorization<double> factorization{
+        systems.upper,
+        systems.middle,
+        systems.lower
+    };
+
+    std::vector<double> lines(n * numLines);
+
+    for (std::size_t i{0}; i < n; ++i)
+    {
+        for (std::size_t b{0}; b < numLines; ++b)
+        {
+            lines[b * n + i] = systems.rhs[i * numLines + b];
+        }
+    }
+
+    const std::vector<double> original{lines};
+
+    factorization.solveLines(lines, 1, numLines - 1);
+
+    for (std::size_t i{0}; i < n; ++i)
+    {
+        for (std::size_t b{0}; b < numLines; ++b)
+        {
+            const std::size_t k{b * n + i};
+
+            if (b == 0 || b + 1 == numLines)
+            {
+                EXPECT_DOUBLE_EQ(lines[k], original[k]) << "b=" << b << " i=" << i;
+            }
+            else
+            {
+                EXPECT_NEAR(lines[k], systems.expected[i * numLines + b], 1e-11)
+                    << "b=" << b << " i=" << i;
+            }
+        }
+    }
+}
+
+TEST(MathTridiagonal, ThomasFactorizationSolvesRequestedLanesOnly)
+{
+    constexpr std::size_t n{12};
+    constexpr std::size_t batch{6};
+
+    auto systems{makeInterleavedSystems<n>(batch, false)};
+    const std::vector<double> original{systems.rhs};
+
+    const uv::math::linear_algebra::ThomasFactorization<double> factorization{
+        systems.upper,
+        systems.middle,
+        systems.lower,
+        batch
+    };
+
+    factorization.solve(systems.rhs, 2, 5);
+
+    for (std::size_t i{0}; i < n; ++i)
+    {
+        for (std::size_t b{0}; b < batch; ++b)
+        {
+            const std::size_t k{i * batch + b};
+
+            if (b >= 2 && b < 5)
+            {
+                EXPECT_NEAR(systems.rhs[k], systems.expected[k], 1e-11) << "k=" << k;
+            }
+            else
+            {
+                EXPECT_EQ(systems.rhs[k], original[k]) << "k=" << k;
+            }
+        }
+    }
+
+    EXPECT_THROW(
+        factorization.solve(std::span<double>{systems.rhs}.first(n)),
+        uv::errors::UnifiedVolError
+    );
+}
+
+TEST(MathTridiagonal, DynamicThomasSolveReusesWorkspaceAcrossSizes)
+{
+    uv::math::linear_algebra::TridiagonalWorkspace<double> workspace;
+
+    for (const std::size_t n : {2U, 17U, 300U, 64U})
+    {
+        auto system{makeDynamicSystem(n)};
+
+        uv::math::linear_algebra::thomasSolve<double>(
+            system.rhs,
+            system.upper,
+            system.middle,
+            system.lower,
+            workspace
+        );
+
+        for (std::size_t i{0}; i < n; ++i)
+        {
+            EXPECT_NEAR(system.rhs[i], system.expected[i], 1e-11) << "n=" << n;
+        }
+    }
+}
+
+TEST(MathTridiagonal, DynamicThomasSolveRejectsMismatchedSizes)
+{
+    std::vector<double> x(4);
+    std::vector<double> coefficients(4, 1.0);
+    std::vector<double> shortCoefficients(3, 1.0);
+    std::vector<double> scratch(4);
+
+    EXPECT_THROW(
+        uv::math::linear_algebra::thomasSolve<double>(
+            x,
+            coefficients,
+            shortCoefficients,
+            coefficients,
+            scratch
+        ),
+        uv::errors::UnifiedVolError
+    );
+}
+
+TEST(MathTridiagonal, PartitionSolveMatchesKnownSolution)
+{
+    uv::math::linear_algebra::TridiagonalWorkspace<double> workspace;
+
+    for (const std::size_t numBlocks : {2U, 3U, 7U, 16U})
+    {
+        auto system{makeDynamicSystem(1000)};
+
+        uv::math::linear_algebra::partitionSolve<double>(
+            system.rhs,
+            system.upper,
+            system.middle,
+            system.lower,
+            workspace,
+            numBlocks,
+            2
+        );
+
+        for (std::size_t i{0}; i < system.rhs.size(); ++i)
+        {
+            EXPECT_NEAR(system.rhs[i], system.expected[i], 1e-10)
+                << "numBlocks=" << numBlocks << " i=" << i;
+        }
+    }
+}
+
+TEST(MathTridiagonal, PartitionSolveIgnoresUnusedEndpointCoefficients)
+{
+    uv::math::linear_algebra::TridiagonalWorkspace<double> workspace;
+    auto system{makeDynamicSystem(64)};
+
+    system.lower.front() = 1.0e12;
+    system.upper.back() = -1.0e12;
+
+    uv::math::linear_algebra::partitionSolve<double>(
+        system.rhs,
+        system.upper,
+        system.middle,
+        system.lower,
+        workspace,
+        4
+    );
+
+    for (std::size_t i{0}; i < system.rhs.size(); ++i)
+    {
+        EXPECT_NEAR(system.rhs[i], system.expected[i], 1e-10) << "i=" << i;
+    }
+}
+
+TEST(MathTridiagonal, PartitionSolveFallsBackToThomasForSmallSystems)
+{
+    uv::math::linear_algebra::TridiagonalWorkspace<double> workspace;
+    auto system{makeDynamicSystem(5)};
+
+    uv::math::linear_algebra::partitionSolve<double>(
+        system.rhs,
+        system.upper,
+        system.middle,
+        system.lower,
+        workspace,
+        8
+    );
+
+    for (std::size_t i{0}; i < system.rhs.size(); ++i)
+    {
+        EXPECT_NEAR(system.rhs[i], system.expected[i], 1e-12) << "i=" << i;
+    }
+}
+
+TEST(MathTridiagonal, BrennanSchwartzSolveProjectsOntoObstacle)
+{
+    using namespace uv::tests::unit::linear_algebra::detail;
+
+    constexpr std::size_t n{64};
+
+    const auto system{makeDynamicSystem(n)};
+    std::vector<double> scratch(n);
+
+    std::vector<double> inactive(n, -1e6);
+    std::vector<double> unconstrained{system.rhs};
+
+    uv::math::linear_algebra::brennanSchwartzSolve<double>(
+        unconstrained,
+        system.upper,
+        system.middle,
+        system.lower,
+        inactive,
+        scratch
+    );
+
+    std::vector<double> binding(n, 10.0);
+    std::vector<double> projected{system.rhs};
+
+    uv::math::linear_algebra::brennanSchwartzSolve<double>(
+        projected,
+        system.upper,
+        system.middle,
+        system.lower,
+        binding,
+        scratch
+    );
+
+    const uv::math::linear_algebra::ThomasFactorization<double> factorization{
+        system.upper,
+        system.middle,
+        system.lower
+    };
+
+    std::vector<double> factorized{system.rhs};
+    factorization.solveProjected(factorized, binding);
+
+    for (std::size_t i{0}; i < n; ++i)
+    {
+        EXPECT_NEAR(unconstrained[i], system.expected[i], 1e-11);
+        EXPECT_DOUBLE_EQ(projected[i], 10.0);
+        EXPECT_DOUBLE_EQ(factorized[i], projected[i]);
+    }
+}
@@ -6,6 +6,7 @@
 #include <array>
 #include <cmath>
 #include <gtest/gtest.h>
+#include <span>
 #include <vector>
 
 TEST(MathVectorOps, EvaluatesAndReducesVectors)
@@ -93,6 +94,87 @@ TEST(MathVectorOps, SquareRootInplaceRequiresSameSize)
     );
 }
 
+TEST(MathVectorOps, OutputOverloadsMatchAllocatingVersions)
+{
+    namespace la = uv::math::linear_algebra;
+
+    const std::vector<double> a{0.5, 1.5, 2.0, 3.25, 4.0};
+    const std::vector<double> b{2.0, 0.5, 1.25, 0.75, 3.0};
+    std::vector<double> out(a.size());
+
+    la::multiply<double>(out, a, 3.0);
+    EXPECT_EQ(out, la::multiply<double>(a, 3.0));
+
+    la::reciprocal<double>(out, a);
+    EXPECT_EQ(out, la::reciprocal<double>(a));
+
+    la::exponential<double>(out, a);
+    EXPECT_EQ(out, la::exponential<double>(a));
+
+    la::squareRoot<double>(out, a);
+    EXPECT_EQ(out, la::squareRoot<double>(a));
+
+    la::hadamard<double>(out, a, b);
+    EXPECT_EQ(out, la::hadamard<double>(a, b));
+
+    EXPECT_THROW(
+        la::multiply<double>(std::span<double>{out}.first(2), a, 3.0),
+        uv::errors::UnifiedVolError
+    );
+}
+
+TEST(MathVectorOps, InplaceOverloadsOverwriteTheirInput)
+{
+    namespace la = uv::math::linear_algebra;
+
+    const std::vector<double> a{0.25, 1.0, 2.25, 4.0};
+    const std::vector<double> b{4.0, 2.0, 1.0, 0.5};
+    std::vector<double> x;
+
+    x = a;
+    la::multiplyInplace<double>(x, 2.0);
+    EXPECT_EQ(x, la::multiply<double>(a, 2.0));
+
+    x = a;
+    la::reciprocalInplace<double>(x);
+    EXPECT_EQ(x, la::reciprocal<double>(a));
+
+    x = a;
+    la::exponentialInplace<double>(x);
+    EXPECT_EQ(x, la::exponential<double>(a));
+
+    x = a;
+    la::squareRootInplace<double>(x);
+    EXPECT_EQ(x, la::squareRoot<double>(a));
+
+    x = a;
+    la::hadamardInplace<double>(x, b);
+    EXPECT_EQ(x, la::hadamard<double>(a, b));
+}
+
+TEST(MathVectorOps, FusedKernelsComposeWithoutTemporaries)
+{
+    namespace la = uv::math::linear_algebra;
+
+    std::vector<double> x{0.04, 0.09, 0.16};
+
+    la::scaledSquareRoot<double>(x, x, 4.0);
+
+    EXPECT_DOUBLE_EQ(x[0], 0.4);
+    EXPECT_DOUBLE_EQ(x[1], 0.6);
+    EXPECT_DOUBLE_EQ(x[2], 0.8);
+
+    la::scaledExponential<double>(x, x, -2.5);
+
+    EXPECT_DOUBLE_EQ(x[0], std::exp(-1.0));
+    EXPECT_DOUBLE_EQ(x[2], std::exp(-2.0));
+
+    const std::vector<double> y{1.0, 2.0, 3.0};
+    la::transform<double>(x, y, y, [](double u, double v) { return u * v + 1.0; });
+
+    EXPECT_EQ(x, (std::vector<double>{2.0, 5.0, 10.0}));
+}
+
 TEST(MathVectorOps, SequenceAndExtremaHelpersWork)
 {
     const auto sequence = uv::math::linear_algebra::makeSequence<int>(4, 3);
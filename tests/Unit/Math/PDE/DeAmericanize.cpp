@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Math/PDE/DeAmericanize.hpp"
+#include "Base/Errors/Errors.hpp"
+#include "Core/Matrix.hpp"
+#include "Math/Functions/Black.hpp"
+#include "Math/Functions/Volatility.hpp"
+#include "Math/PDE/Pricer.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <gtest/gtest.h>
+
+namespace
+{
+constexpr double r{0.05};
+constexpr double q{0.0};
+constexpr double S{100.0};
+
+constexpr std::array<double, 2> maturities{0.5, 2.0};
+constexpr std::array<double, 4> strikes{80.0, 95.0, 110.0, 130.0};
+
+double smile(double t, double K)
+{
+    const double x{std::log(K / S)};
+    return 0.22 - 0.08 * x + 0.15 * x * x + 0.01 * t;
+}
+
+bool isCall(double t, double K)
+{
+    return K >= S * std::exp((r - q) * t);
+}
+
+uv::core::Matrix<double> americanPrices(const uv::math::pde::Config<double>& grid)
+{
+    uv::math::pde::Pricer<double> pricer{grid};
+    uv::core::Matrix<double> prices{maturities.size(), strikes.size()};
+
+    for (std::size_t i{0}; i < maturities.size(); ++i)
+    {
+        for (std::size_t j{0}; j < strikes.size(); ++j)
+        {
+            const double t{maturities[i]};
+            const double K{strikes[j]};
+
+            prices[i][j] = pricer.price(
+                t,
+                r,
+                q,
+                smile(t, K),
+                S,
+                K,
+                isCall(t, K),
+                uv::math::pde::Exercise::American
+            );
+        }
+    }
+
+    return prices;
+}
+} // namespace
+
+TEST(UnitMathPDEDeAmericanize, RecoversVolsBehindAmericanPremiums)
+{
+    const uv::math::pde::DeAmericanizeConfig<double> config{};
+    const auto prices{americanPrices(config.grid)};
+
+    const auto vols{uv::math::pde::deAmericanize<double>(
+        prices,
+        maturities,
+        strikes,
+        r,
+        q,
+        S,
+        config
+    )};
+
+    for (std::size_t i{0}; i < maturities.size(); ++i)
+    {
+        for (std::size_t j{0}; j < strikes.size(); ++j)
+        {
+            EXPECT_NEAR(vols[i][j], smile(maturities[i], strikes[j]), 1e-6)
+                << "t=" << maturities[i] << " K=" << strikes[j];
+        }
+    }
+}
+
+TEST(UnitMathPDEDeAmericanize, RemovesEarlyExercisePremiumFromPutVols)
+{
+    // Treating the American put premium as European overstates the vol; the
+    // de-Americanized vol must sit below that naive quote.
+    const double t{2.0};
+    const double K{95.0};
+    const uv::math::pde::DeAmericanizeConfig<double> config{};
+
+    uv::math::pde::Pricer<double> pricer{config.grid};
+    const double american{
+        pricer.price(t, r, q, 0.25, S, K, false, uv::math::pde::Exercise::American)
+    };
+
+    const double dF{std::exp(-r * t)};
+    const double F{S * std::exp((r - q) * t)};
+    const double naive{
+        uv::math::vol::impliedVol(american + dF * (F - K), t, dF, F, K)
+    };
+    const double equivalent{uv::math::pde::europeanEquivalentVol(
+        pricer,
+        american,
+        t,
+        r,
+        q,
+        S,
+        K,
+        false,
+        config
+    )};
+
+    EXPECT_NEAR(equivalent, 0.25, 1e-6);
+    EXPECT_GT(naive, equivalent + 5e-3);
+}
+
+TEST(UnitMathPDEDeAmericanize, ThreadedBatchMatchesSerialBatch)
+{
+    const auto prices{americanPrices(uv::math::pde::DeAmericanizeConfig<double>{}.grid)};
+
+    const auto batch = [&](int numThreads)
+    {
+        return uv::math::pde::deAmericanize<double>(
+            prices,
+            maturities,
+            strikes,
+            r,
+            q,
+            S,
+            {.numThreads = numThreads}
+        );
+    };
+
+    const auto lhs{batch(1)};
+    const auto rhs{batch(3)};
+
+    for (std::size_t i{0}; i < maturities.size(); ++i)
+    {
+        for (std::size_t j{0}; j < strikes.size(); ++j)
+            EXPECT_EQ(lhs[i][j], rhs[i][j]);
+    }
+}
+
+TEST(UnitMathPDEDeAmericanize, RejectsUnattainablePremiums)
+{
+    uv::math::pde::Pricer<double> pricer{};
+
+    // An American put is worth at least its exercise value K - S.
+    EXPECT_THROW(
+        uv::math::pde::europeanEquivalentVol(pricer, 15.0, 1.0, r, q, S, 120.0, false),
+        uv::errors::UnifiedVolError
+    );
+    EXPECT_THROW(
+        uv::math::pde::europeanEquivalentVol(pricer, -1.0, 1.0, r, q, S, 90.0, false),
+        uv::errors::UnifiedVolError
+    );
+}
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Errors/Errors.hpp"
+#include "Core/Curve.hpp"
+#include "Core/Matrix.hpp"
+#include "Core/VolSurface.hpp"
+#include "Math/Functions/Black.hpp"
+#include "Math/PDE/Dupire.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+struct Market
+{
+    std::vector<double> maturities{0.25, 0.5, 1.0, 2.0};
+    std::vector<double> forwards{100.5, 101.0, 102.0, 104.1};
+    std::vector<double> strikes{70.0, 85.0, 95.0, 100.0, 105.0, 120.0, 140.0};
+    std::vector<double> moneyness{0.7, 0.85, 0.95, 1.0, 1.05, 1.2, 1.4};
+};
+
+uv::core::VolSurface<double> makeSurface(const Market& market, double vol)
+{
+    const uv::core::Matrix<double>
+        vols{market.maturities.size(), market.strikes.size(), vol};
+
+    return uv::core::VolSurface<double>{
+        market.maturities,
+        market.forwards,
+        market.strikes,
+        market.moneyness,
+        vols
+    };
+}
+} // namespace
+
+TEST(UnitMathPDEDupire, ConstantLocalVolReproducesBlackSurface)
+{
+    const Market market;
+    const auto surface{makeSurface(market, 0.2)};
+    const uv::core::Curve<double> curve{0.03, market.maturities};
+
+    uv::math::pde::DupireSolver<double> solver;
+
+    const auto prices{
+        solver.callPrice(surface, curve, [](double, double) { return 0.2; })
+    };
+    const auto expected{uv::math::black::priceB76(surface, curve)};
+
+    ASSERT_EQ(prices.rows(), surface.numMaturities());
+    ASSERT_EQ(prices.cols(), surface.numStrikes());
+
+    for (std::size_t m{0}; m < prices.rows(); ++m)
+    {
+        for (std::size_t j{0}; j < prices.cols(); ++j)
+        {
+            EXPECT_NEAR(prices[m][j], expected[m][j], 2e-3) << "m=" << m << " j=" << j;
+        }
+    }
+}
+
+TEST(UnitMathPDEDupire, TimeDependentLocalVolMatchesIntegratedVariance)
+{
+    const Market market;
+    const auto surface{makeSurface(market, 0.3)};
+    const uv::core::Curve<double> curve{0.03, market.maturities};
+
+    uv::math::pde::DupireSolver<double> solver;
+
+    const auto prices{
+        solver.callPrice(surface, curve, [](double t, double) { return 0.15 + 0.05 * t; })
+    };
+
+    for (std::size_t m{0}; m < prices.rows(); ++m)
+    {
+        const double t{market.maturities[m]};
+        const double a{0.15};
+        const double b{0.05};
+        const double variance{a * a * t + a * b * t * t + b * b * t * t * t / 3.0};
+        const double vol{std::sqrt(variance / t)};
+
+        for (std::size_t j{0}; j < prices.cols(); ++j)
+        {
+            const double expected{uv::math::black::priceB76(
+                t,
+                curve.interpolateDF(t),
+                market.forwards[m],
+                vol,
+                market.strikes[j]
+            )};
+
+            EXPECT_NEAR(prices[m][j], expected, 2e-3) << "m=" << m << " j=" << j;
+        }
+    }
+}
+
+TEST(UnitMathPDEDupire, RejectsInvalidConfig)
+{
+    EXPECT_THROW(
+        (uv::math::pde::DupireSolver<double>{
+            uv::math::pde::Config<double>{.numNodes = 3}
+        }),
+        uv::errors::UnifiedVolError
+    );
+    EXPECT_THROW(
+        (uv::math::pde::DupireSolver<double>{
+            uv::math::pde::Config<double>{.numTimeSteps = 1, .rannacherSteps = 2}
+        }),
+        uv::errors::UnifiedVolError
+    );
+}
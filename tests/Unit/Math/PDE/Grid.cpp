@@ -4,6 +4,7 @@
 #include "Base/Errors/Errors.hpp"
 
 #include <array>
+#include <vector>
 #include <gtest/gtest.h>
 
 TEST(UnitMathPDEGrid, StoresCoordinatesAndSteps)
@@ -69,3 +70,160 @@ TEST(UnitMathPDEGrid, RejectsInvalidCenteredSinhInputs)
         uv::errors::UnifiedVolError
     );
 }
+
+TEST(UnitMathPDEGrid, StoresRuntimeSizedCoordinatesAndSteps)
+{
+    const std::vector<double> x{-1.0, -0.25, 0.5, 2.0, 2.5};
+    const uv::math::pde::Grid<double> grid{x};
+
+    EXPECT_EQ(grid.size(), 5U);
+    EXPECT_EQ(grid.dx().size(), 4U);
+    EXPECT_DOUBLE_EQ(grid.dx()[0], 0.75);
+    EXPECT_DOUBLE_EQ(grid.dx()[3], 0.5);
+}
+
+TEST(UnitMathPDEGrid, RuntimeGeneratorsMatchFixedExtentGenerators)
+{
+    const auto fixedSinh =
+        uv::math::pde::generateCenteredSinHGrid<double, 7>(-2.0, 2.0, 1.5);
+    const auto runtimeSinh =
+        uv::math::pde::generateCenteredSinHGrid<double>(7, -2.0, 2.0, 1.5);
+    const auto fixedUniform = uv::math::pde::generateUniformGrid<double, 7>(-1.0, 3.0);
+    const auto runtimeUniform = uv::math::pde::generateUniformGrid<double>(7, -1.0, 3.0);
+
+    ASSERT_EQ(runtimeSinh.size(), 7U);
+    ASSERT_EQ(runtimeUniform.size(), 7U);
+
+    for (std::size_t i{0}; i < 7; ++i)
+    {
+        EXPECT_DOUBLE_EQ(runtimeSinh.x()[i], fixedSinh.x()[i]);
+        EXPECT_DOUBLE_EQ(runtimeUniform.x()[i], fixedUniform.x()[i]);
+    }
+}
+
+TEST(UnitMathPDEGrid, RuntimeSizedGridRejectsTooFewNodes)
+{
+    const std::vector<double> x{0.0, 1.0};
+
+    EXPECT_THROW((uv::math::pde::Grid<double>{x}), uv::errors::UnifiedVolError);
+    EXPECT_THROW(
+        (uv::math::pde::generateUniformGrid<double>(2, 0.0, 1.0)),
+        uv::errors::UnifiedVolError
+    );
+}
+
+TEST(UnitMathPDEGrid, CachedStencilsDifferentiateQuadraticsExactly)
+{
+    const std::vector<double> x{-1.0, -0.4, 0.1, 0.3, 1.2, 2.0};
+    const uv::math::pde::Grid<double> grid{x};
+    const uv::math::pde::Stencil<double> first{grid.firstDerivative()};
+    const uv::math::pde::Stencil<double> second{grid.secondDerivative()};
+
+    ASSERT_EQ(first.middle.size(), x.size());
+    ASSERT_EQ(second.middle.size(), x.size());
+
+    for (std::size_t i{1}; i + 1 < x.size(); ++i)
+    {
+        const double fm{x[i - 1] * x[i - 1]};
+        const double f0{x[i] * x[i]};
+        const double fp{x[i + 1] * x[i + 1]};
+
+        EXPECT_NEAR(
+            first.lower[i] * fm + first.middle[i] * f0 + first.upper[i] * fp,
+            2.0 * x[i],
+            1e-12
+        );
+        EXPECT_NEAR(
+            second.lower[i] * fm + second.middle[i] * f0 + second.upper[i] * fp,
+            2.0,
+            1e-12
+        );
+    }
+
+    EXPECT_EQ(first.middle.front(), 0.0);
+    EXPECT_EQ(second.upper.back(), 0.0);
+}
+
+TEST(UnitMathPDEGrid, SingleCenterConcentratedGridMatchesCenteredSinhGrid)
+{
+    const std::array<double, 1> centers{0.0};
+    const auto concentrated =
+        uv::math::pde::generateConcentratedGrid<double>(9, -2.0, 2.0, centers, 2.0);
+    const auto sinh = uv::math::pde::generateCenteredSinHGrid<double>(9, -2.0, 2.0, 2.0);
+
+    ASSERT_EQ(concentrated.size(), 9U);
+
+    for (std::size_t i{0}; i < 9; ++i)
+    {
+        EXPECT_NEAR(concentrated.x()[i], sinh.x()[i], 1e-12);
+    }
+}
+
+TEST(UnitMathPDEGrid, MultiCenterGridClustersNodesAroundEachCenter)
+{
+    const std::array<double, 2> centers{-1.0, 1.5};
+    const auto grid =
+        uv::math::pde::generateConcentratedGrid<double>(61, -3.0, 3.0, centers, 3.0);
+    const auto x = grid.x();
+    const auto dx = grid.dx();
+
+    EXPECT_DOUBLE_EQ(x.front(), -3.0);
+    EXPECT_DOUBLE_EQ(x.back(), 3.0);
+
+    const auto stepAt = [&](double point)
+    {
+        std::size_t i{0};
+
+        while (i + 1 < dx.size() && x[i + 1] < point)
+        {
+            ++i;
+        }
+
+        return dx[i];
+    };
+
+    EXPECT_LT(stepAt(-1.0), stepAt(-2.9));
+    EXPECT_LT(stepAt(-1.0), stepAt(0.25));
+    EXPECT_LT(stepAt(1.5), stepAt(0.25));
+    EXPECT_LT(stepAt(1.5), stepAt(2.9));
+}
+
+TEST(UnitMathPDEGrid, ConcentratedGridWithTinyBetaFallsBackToUniformGrid)
+{
+    const std::array<double, 2> centers{-0.5, 0.5};
+    const auto grid =
+        uv::math::pde::generateConcentratedGrid<double, 5>(-1.0, 1.0, centers, 0.0);
+
+    EXPECT_DOUBLE_EQ(grid.x()[1], -0.5);
+    EXPECT_DOUBLE_EQ(grid.x()[2], 0.0);
+    EXPECT_DOUBLE_EQ(grid.dx()[3], 0.5);
+}
+
+TEST(UnitMathPDEGrid, RejectsInvalidConcentratedGridInputs)
+{
+    const std::array<double, 1> centers{0.0};
+    const std::array<double, 1> outside{4.0};
+
+    EXPECT_THROW(
+        (uv::math::pde::generateConcentratedGrid<double>(
+            7,
+            -1.0,
+            1.0,
+            std::span<const double>{},
+            1.0
+        )),
+        uv::errors::UnifiedVolError
+    );
+    EXPECT_THROW(
+        (uv::math::pde::generateConcentratedGrid<double>(7, 1.0, -1.0, centers, 1.0)),
+        uv::errors::UnifiedVolError
+    );
+    EXPECT_THROW(
+        (uv::math::pde::generateConcentratedGrid<double>(7, -1.0, 1.0, outside, 1.0)),
+        uv::errors::UnifiedVolError
+    );
+    EXPECT_THROW(
+        (uv::math::pde::generateConcentratedGrid<double>(7, -1.0, 1.0, centers, -1.0)),
+        uv::errors::UnifiedVolError
+    );
+}
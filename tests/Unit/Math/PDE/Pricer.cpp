@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Math/PDE/Pricer.hpp"
+#include "Base/Errors/Errors.hpp"
+#include "Math/Functions/Black.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <gtest/gtest.h>
+
+namespace
+{
+constexpr double t{1.0};
+constexpr double r{0.03};
+constexpr double q{0.01};
+constexpr double vol{0.2};
+constexpr double S{100.0};
+} // namespace
+
+TEST(UnitMathPDEPricer, EuropeanPricesMatchBlackScholes)
+{
+    uv::math::pde::Pricer<double> pricer;
+
+    for (const double K : {70.0, 90.0, 100.0, 115.0, 140.0})
+    {
+        for (const bool isCall : {true, false})
+        {
+            const double pde{pricer.price(t, r, q, vol, S, K, isCall)};
+            const double exact{
+                uv::math::black::priceBS(t, r, q, vol, S, K, true, isCall)
+            };
+
+            EXPECT_NEAR(pde, exact, 2e-3) << "K=" << K << " isCall=" << isCall;
+        }
+    }
+}
+
+TEST(UnitMathPDEPricer, StrikeVectorMatchesSingleStrikeSolves)
+{
+    uv::math::pde::Pricer<double> pricer;
+
+    const std::array<double, 4> strikes{80.0, 95.0, 105.0, 125.0};
+    std::array<double, 4> prices{};
+
+    pricer.price(prices, t, r, q, vol, S, strikes, false);
+
+    for (std::size_t j{0}; j < strikes.size(); ++j)
+    {
+        const double exact{
+            uv::math::black::priceBS(t, r, q, vol, S, strikes[j], true, false)
+        };
+
+        EXPECT_NEAR(prices[j], exact, 5e-3) << "K=" << strikes[j];
+    }
+}
+
+TEST(UnitMathPDEPricer, ConstantLocalVolMatchesBlackScholes)
+{
+    uv::math::pde::Pricer<double> pricer;
+
+    const double pde{pricer.price(t, r, q, [](double, double) { return vol; }, S, 110.0)};
+    const double exact{uv::math::black::priceBS(t, r, q, vol, S, 110.0)};
+
+    EXPECT_NEAR(pde, exact, 2e-3);
+}
+
+TEST(UnitMathPDEPricer, AmericanPutCarriesEarlyExercisePremium)
+{
+    uv::math::pde::Pricer<double> pricer;
+
+    constexpr double K{110.0};
+    constexpr double rate{0.06};
+
+    const double european{pricer.price(t, rate, 0.0, vol, S, K, false)};
+    const double american{
+        pricer.price(t, rate, 0.0, vol, S, K, false, uv::math::pde::Exercise::American)
+    };
+
+    const std::array<double, 3> exerciseTimes{0.25, 0.5, 0.75};
+    const double bermudan{pricer.price(
+        t,
+        rate,
+        0.0,
+        vol,
+        S,
+        K,
+        false,
+        uv::math::pde::Exercise::Bermudan,
+        exerciseTimes
+    )};
+
+    EXPECT_GT(american, european + 0.05);
+    EXPECT_GE(american, K - S);
+    EXPECT_GT(bermudan, european);
+    EXPECT_LT(bermudan, american);
+}
+
+TEST(UnitMathPDEPricer, AmericanCallWithoutDividendsEqualsEuropean)
+{
+    uv::math::pde::Pricer<double> pricer;
+
+    const double european{pricer.price(t, 0.05, 0.0, vol, S, 100.0)};
+    const double american{
+        pricer.price(t, 0.05, 0.0, vol, S, 100.0, true, uv::math::pde::Exercise::American)
+    };
+
+    EXPECT_NEAR(american, european, 1e-8);
+}
+
+TEST(UnitMathPDEPricer, RejectsInvalidInputs)
+{
+    EXPECT_THROW(
+        (uv::math::pde::Pricer<double>{uv::math::pde::Config<double>{.numNodes = 3}}),
+        uv::errors::UnifiedVolError
+    );
+
+    uv::math::pde::Pricer<double> pricer;
+
+    EXPECT_THROW(pricer.price(0.0, r, q, vol, S, 100.0), uv::errors::UnifiedVolError);
+    EXPECT_THROW(
+        pricer.price(t, r, q, vol, S, 100.0, false, uv::math::pde::Exercise::Bermudan),
+        uv::errors::UnifiedVolError
+    );
+}
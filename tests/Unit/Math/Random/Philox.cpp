@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Math/Random/Philox.hpp"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+
+namespace
+{
+using uv::math::random::Philox4x32;
+using uv::math::random::PhiloxCounter;
+using uv::math::random::PhiloxKey;
+} // namespace
+
+TEST(MathRandomPhilox, MatchesReferenceKnownAnswerVectors)
+{
+    EXPECT_EQ(
+        Philox4x32(PhiloxKey{0U, 0U})(PhiloxCounter{0U, 0U, 0U, 0U}),
+        (PhiloxCounter{0x6627E8D5U, 0xE169C58DU, 0xBC57AC4CU, 0x9B00DBD8U})
+    );
+
+    EXPECT_EQ(
+        Philox4x32(PhiloxKey{0xFFFFFFFFU, 0xFFFFFFFFU})(
+            PhiloxCounter{0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU}
+        ),
+        (PhiloxCounter{0x408F276DU, 0x41C83B0EU, 0xA20BC7C6U, 0x6D5451FDU})
+    );
+
+    EXPECT_EQ(
+        Philox4x32(PhiloxKey{0xA4093822U, 0x299F31D0U})(
+            PhiloxCounter{0x243F6A88U, 0x85A308D3U, 0x13198A2EU, 0x03707344U}
+        ),
+        (PhiloxCounter{0xD16CFE09U, 0x94FDCCEBU, 0x5001E420U, 0x24126EA1U})
+    );
+}
+
+TEST(MathRandomPhilox, SeedSplitsIntoLowAndHighKeyWords)
+{
+    const Philox4x32 philox{0x0123456789ABCDEFULL};
+
+    EXPECT_EQ(philox.key(), (PhiloxKey{0x89ABCDEFU, 0x01234567U}));
+}
+
+TEST(MathRandomPhilox, UniformsStayInsideOpenUnitInterval)
+{
+    using uv::math::random::toUniform;
+
+    EXPECT_GT(toUniform<double>(0U, 0U), 0.0);
+    EXPECT_LT(toUniform<double>(0xFFFFFFFFU, 0xFFFFFFFFU), 1.0);
+    EXPECT_DOUBLE_EQ(toUniform<double>(0x80000000U, 0U), 0.5 + 0x1p-53);
+
+    static_assert(toUniform<double>(0U, 0U) == 0x1p-53);
+}
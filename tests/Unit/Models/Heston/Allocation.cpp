@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Models/Heston/Calibrate/Detail/MaturitySlice.hpp"
+#include "Models/Heston/Calibrate/Detail/ResidualCost.hpp"
+#include "Models/Heston/Price/Pricer.hpp"
+#include "Support/Memory/Allocation.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+constexpr double t{0.5};
+constexpr double dF{0.99};
+constexpr double F{100.0};
+constexpr std::array<double, 5> p{2.0, 0.04, 0.35, -0.65, 0.05};
+} // namespace
+
+TEST(UnitModelsHestonAllocation, CallPriceDoesNotAllocateInSteadyState)
+{
+    uv::models::heston::price::Pricer<double> pricer{};
+    pricer.setParams({p[0], p[1], p[2], p[3], p[4]});
+
+    const std::vector<double> strikes{80.0, 90.0, 100.0, 110.0, 120.0};
+    std::vector<double> out(strikes.size());
+
+    // The first call may register per-thread metrics storage.
+    double price{pricer.callPrice(t, dF, F, 100.0)};
+
+    const auto counts = uv::tests::memory::countAllocations(
+        [&]
+        {
+            price = pricer.callPrice(t, dF, F, 100.0);
+            price += pricer.callPrice(p[0], p[1], p[2], p[3], p[4], t, dF, F, 90.0);
+            pricer.callPrice(out, t, dF, F, strikes);
+        }
+    );
+
+    EXPECT_TRUE(std::isfinite(price));
+    EXPECT_TRUE(std::isfinite(out.back()));
+    EXPECT_EQ(counts.allocations, 0U);
+}
+
+TEST(UnitModelsHestonAllocation, ResidualAndJacobianDoNotAllocate)
+{
+    uv::models::heston::price::Pricer<double> pricer{};
+
+    uv::models::heston::calibrate::detail::MaturitySlice slice{4};
+    slice.t = t;
+    slice.dF = dF;
+    slice.F = F;
+    slice.K = {85.0, 95.0, 105.0, 115.0};
+    slice.vol = {0.26, 0.23, 0.21, 0.20};
+    slice.w = {1.0, 1.0, 1.0, 1.0};
+
+    using SliceCommon = uv::models::heston::calibrate::detail::
+        SliceCommon<double, uv::models::heston::price::defaultNodes>;
+    const SliceCommon common{slice, pricer};
+
+    std::vector<double> residuals(slice.K.size());
+    std::vector<double> jacobian(5 * slice.K.size());
+
+    common.residualAndJac(p.data(), residuals.data(), jacobian.data());
+
+    const auto counts = uv::tests::memory::countAllocations(
+        [&]
+        {
+            common.residualAndJac(p.data(), residuals.data(), jacobian.data());
+            common.residualOnly(p.data(), residuals.data());
+        }
+    );
+
+    EXPECT_TRUE(std::isfinite(residuals.front()));
+    EXPECT_TRUE(std::isfinite(jacobian.back()));
+    EXPECT_EQ(counts.allocations, 0U);
+}
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Errors/Errors.hpp"
+#include "Models/Heston/MonteCarlo/Pricer.hpp"
+#include "Models/Heston/Params.hpp"
+#include "Models/Heston/Price/Pricer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <span>
+
+namespace
+{
+constexpr double t{1.0};
+constexpr double r{0.03};
+constexpr double q{0.01};
+constexpr double S{100.0};
+
+// Feller condition violated so that both QE branches are exercised.
+const uv::models::heston::Params<double> params{1.5, 0.04, 0.5, -0.7, 0.04};
+
+double fourierCall(double K)
+{
+    uv::models::heston::price::Pricer<double> pricer{};
+    pricer.setParams(params);
+
+    return pricer.callPrice(t, std::exp(-r * t), S * std::exp((r - q) * t), K);
+}
+
+double asianCall(std::span<const double> path)
+{
+    const double average{
+        std::accumulate(path.begin() + 1, path.end(), 0.0) /
+        static_cast<double>(path.size() - 1)
+    };
+
+    return std::max(average - 100.0, 0.0);
+}
+} // namespace
+
+TEST(UnitModelsHestonMonteCarlo, EuropeanCallsMatchFourierPricer)
+{
+    uv::models::heston::mc::Pricer<double> pricer{{.numPaths = 1 << 15, .numSteps = 50}};
+    pricer.setParams(params);
+
+    for (const double K : {80.0, 100.0, 120.0})
+    {
+        const auto result{pricer.callPrice(t, r, q, S, K)};
+
+        EXPECT_GT(result.standardError, 0.0);
+        EXPECT_LT(result.standardError, 0.15);
+        EXPECT_NEAR(result.price, fourierCall(K), 4.0 * result.standardError + 0.02);
+    }
+}
+
+TEST(UnitModelsHestonMonteCarlo, ResultsDoNotDependOnThreadCount)
+{
+    uv::models::heston::mc::Pricer<double> serial{
+        {.numPaths = 4000, .numSteps = 20, .blockSize = 256, .numThreads = 1}
+    };
+    uv::models::heston::mc::Pricer<double> threaded{
+        {.numPaths = 4000, .numSteps = 20, .blockSize = 256, .numThreads = 3}
+    };
+    serial.setParams(params);
+    threaded.setParams(params);
+
+    const auto lhs{serial.price(t, r, q, S, asianCall)};
+    const auto rhs{threaded.price(t, r, q, S, asianCall)};
+
+    EXPECT_EQ(lhs.price, rhs.price);
+    EXPECT_EQ(lhs.standardError, rhs.standardError);
+}
+
+TEST(UnitModelsHestonMonteCarlo, ControlVariateReducesAsianStandardError)
+{
+    uv::models::heston::mc::Pricer<double> plain{
+        {.numPaths = 1 << 14, .numSteps = 50, .controlVariate = false}
+    };
+    uv::models::heston::mc::Pricer<double> controlled{
+        {.numPaths = 1 << 14, .numSteps = 50, .controlVariate = true}
+    };
+    plain.setParams(params);
+    controlled.setParams(params);
+
+    const auto raw{plain.price(t, r, q, S, asianCall)};
+    const auto adjusted{controlled.price(t, r, q, S, asianCall, 100.0)};
+
+    EXPECT_LT(adjusted.standardError, 0.75 * raw.standardError);
+    EXPECT_NEAR(adjusted.price, raw.price, 4.0 * raw.standardError);
+}
+
+TEST(UnitModelsHestonMonteCarlo, RejectsInvalidUsage)
+{
+    uv::models::heston::mc::Pricer<double> pricer{};
+
+    EXPECT_THROW(pricer.callPrice(t, r, q, S, 100.0), uv::errors::UnifiedVolError);
+    EXPECT_THROW(
+        (uv::models::heston::mc::Pricer<double>{{.numPaths = 1001}}),
+        uv::errors::UnifiedVolError
+    );
+    EXPECT_THROW(
+        (uv::models::heston::mc::Pricer<double>{{.psiCritical = 3.0}}),
+        uv::errors::UnifiedVolError
+    );
+}
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Errors/Errors.hpp"
+#include "Models/Heston/PDE/Pricer.hpp"
+#include "Models/Heston/Params.hpp"
+#include "Models/Heston/Price/Pricer.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+
+namespace
+{
+constexpr double t{1.0};
+constexpr double r{0.03};
+constexpr double q{0.01};
+constexpr double S{100.0};
+
+const uv::models::heston::Params<double> params{1.5, 0.04, 0.3, -0.7, 0.04};
+
+double fourierPrice(double K, bool isCall)
+{
+    uv::models::heston::price::Pricer<double> pricer{};
+    pricer.setParams(params);
+
+    const double dF{std::exp(-r * t)};
+    const double F{S * std::exp((r - q) * t)};
+    const double call{pricer.callPrice(t, dF, F, K)};
+
+    return isCall ? call : call - dF * (F - K);
+}
+} // namespace
+
+TEST(UnitModelsHestonPDE, EuropeanPricesMatchFourierPricer)
+{
+    for (const auto scheme :
+         {uv::models::heston::pde::Scheme::Douglas,
+          uv::models::heston::pde::Scheme::CraigSneyd,
+          uv::models::heston::pde::Scheme::ModifiedCraigSneyd,
+          uv::models::heston::pde::Scheme::HundsdorferVerwer})
+    {
+        const uv::models::heston::pde::Config<double> config{
+            .numSpotNodes = 120,
+            .numVarianceNodes = 60,
+            .numTimeSteps = 50,
+            .scheme = scheme
+        };
+
+        uv::models::heston::pde::Pricer<double> pricer{config};
+        pricer.setParams(params);
+
+        for (const double K : {80.0, 100.0, 120.0})
+        {
+            for (const bool isCall : {true, false})
+            {
+                const double pde{pricer.price(t, r, q, S, K, isCall)};
+
+                EXPECT_NEAR(pde, fourierPrice(K, isCall), 2e-2)
+                    << "K=" << K << " isCall=" << isCall;
+            }
+        }
+    }
+}
+
+TEST(UnitModelsHestonPDE, AmericanPutCarriesEarlyExercisePremium)
+{
+    uv::models::heston::pde::Pricer<double> pricer{};
+    pricer.setParams(params);
+
+    constexpr double K{110.0};
+    constexpr double rate{0.08};
+
+    const double european{pricer.price(t, rate, 0.0, S, K, false)};
+    const auto exercise{uv::models::heston::pde::Exercise::American};
+
+    const double american{pricer.price(t, rate, 0.0, S, K, false, exercise)};
+
+    EXPECT_GT(american, european + 0.1);
+    EXPECT_GE(american, K - S);
+}
+
+TEST(UnitModelsHestonPDE, ThreadedSweepsMatchSingleThreaded)
+{
+    uv::models::heston::pde::Pricer<double> serial{{.numThreads = 1}};
+    uv::models::heston::pde::Pricer<double> threaded{{.numThreads = 4}};
+    serial.setParams(params);
+    threaded.setParams(params);
+
+    const auto exercise{uv::models::heston::pde::Exercise::American};
+
+    EXPECT_DOUBLE_EQ(
+        threaded.price(t, r, q, S, 105.0, false, exercise),
+        serial.price(t, r, q, S, 105.0, false, exercise)
+    );
+}
+
+TEST(UnitModelsHestonPDE, RejectsInvalidUsage)
+{
+    uv::models::heston::pde::Pricer<double> pricer{};
+
+    EXPECT_THROW(pricer.price(t, r, q, S, 100.0), uv::errors::UnifiedVolError);
+    EXPECT_THROW(
+        pricer.setParams({1.5, 0.04, 0.3, -1.5, 0.04}),
+        uv::errors::UnifiedVolError
+    );
+    EXPECT_THROW(
+        (uv::models::heston::pde::Pricer<double>{{.numVarianceNodes = 2}}),
+        uv::errors::UnifiedVolError
+    );
+}
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Models/SVI/Calibrate/Detail/Constraints.hpp"
+#include "Models/SVI/Calibrate/Detail/Contexts.hpp"
+#include "Models/SVI/Calibrate/Detail/Objective.hpp"
+#include "Support/Memory/Allocation.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t numStrikes{24};
+constexpr double atmTotalVariance{0.04};
+constexpr std::array<double, 4> x{0.1, -0.4, 0.02, 0.2};
+
+struct SliceFixture
+{
+    std::vector<double> logKF;
+    std::vector<double> totalVariance;
+    std::vector<double> prevWk;
+
+    SliceFixture()
+        : logKF(numStrikes),
+          totalVariance(numStrikes),
+          prevWk(numStrikes, 0.5 * atmTotalVariance)
+    {
+        for (std::size_t j{0}; j < numStrikes; ++j)
+        {
+            const double k{-0.6 + 1.2 * static_cast<double>(j) / (numStrikes - 1)};
+            logKF[j] = k;
+            totalVariance[j] = atmTotalVariance + 0.1 * (-0.4 * k + std::hypot(k, 0.2));
+        }
+    }
+};
+} // namespace
+
+TEST(UnitModelsSVIAllocation, ObjectiveThunkDoesNotAllocate)
+{
+    const SliceFixture slice;
+    uv::models::svi::detail::ObjectiveContexts ctx{
+        slice.logKF,
+        slice.totalVariance,
+        atmTotalVariance
+    };
+    std::array<double, 4> grad{};
+
+    const auto evaluate = [&]
+    {
+        return uv::models::svi::detail::objectiveThunk(4, x.data(), grad.data(), &ctx) +
+               uv::models::svi::detail::objectiveThunk(4, x.data(), nullptr, &ctx);
+    };
+
+    double value{evaluate()};
+    const auto counts = uv::tests::memory::countAllocations([&] { value = evaluate(); });
+
+    EXPECT_TRUE(std::isfinite(value));
+    EXPECT_EQ(counts.allocations, 0U);
+}
+
+TEST(UnitModelsSVIAllocation, ArbitrageConstraintsDoNotAllocate)
+{
+    const SliceFixture slice;
+    uv::models::svi::detail::CalendarMContext calendar{
+        slice.logKF,
+        slice.prevWk,
+        atmTotalVariance,
+        1e-9
+    };
+    uv::models::svi::detail::ConvexityMContext convexity{slice.logKF, atmTotalVariance};
+
+    constexpr auto m{static_cast<unsigned>(numStrikes)};
+    std::vector<double> result(m);
+    std::vector<double> grad(4 * m);
+
+    const auto evaluate = [&]
+    {
+        uv::models::svi::detail::calendarMConstraint(
+            m,
+            result.data(),
+            4,
+            x.data(),
+            grad.data(),
+            &calendar
+        );
+        uv::models::svi::detail::convexityMConstraint(
+            m,
+            result.data(),
+            4,
+            x.data(),
+            grad.data(),
+            &convexity
+        );
+        uv::models::svi::detail::convexityMConstraint(
+            m,
+            result.data(),
+            4,
+            x.data(),
+            nullptr,
+            &convexity
+        );
+    };
+
+    evaluate();
+    const auto counts = uv::tests::memory::countAllocations(evaluate);
+
+    EXPECT_TRUE(std::isfinite(result.front()));
+    EXPECT_EQ(counts.allocations, 0U);
+}
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Errors/Errors.hpp"
+#include "Models/SVI/LocalVol.hpp"
+#include "Models/SVI/Math.hpp"
+#include "Models/SVI/Params.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+uv::Vector<uv::models::svi::Params<double>> makeSlices()
+{
+    return {
+        uv::models::svi::Params<double>{0.5, 0.010, 0.10, -0.40, 0.00, 0.20},
+        uv::models::svi::Params<double>{1.0, 0.025, 0.12, -0.35, 0.02, 0.25},
+        uv::models::svi::Params<double>{2.0, 0.055, 0.14, -0.30, 0.05, 0.30}
+    };
+}
+
+double interpolatedTotalVariance(
+    const uv::Vector<uv::models::svi::Params<double>>& slices,
+    double t,
+    double k
+)
+{
+    std::size_t upper{1};
+    while (upper + 1 < slices.size() && slices[upper].t < t)
+        ++upper;
+
+    const auto& lo = slices[upper - 1];
+    const auto& hi = slices[upper];
+    const double weight{(t - lo.t) / (hi.t - lo.t)};
+
+    return (1.0 - weight) * uv::models::svi::totalVariance(lo, k) +
+           weight * uv::models::svi::totalVariance(hi, k);
+}
+} // namespace
+
+TEST(UnitModelsSVILocalVol, FlatSlicesReproduceConstantVolatility)
+{
+    constexpr double vol{0.25};
+
+    const uv::Vector<uv::models::svi::Params<double>> slices{
+        uv::models::svi::Params<double>{0.5, vol * vol * 0.5, 0.0, 0.0, 0.0, 0.1},
+        uv::models::svi::Params<double>{1.5, vol * vol * 1.5, 0.0, 0.0, 0.0, 0.1}
+    };
+
+    const std::vector<double> t{0.25, 0.5, 1.0, 2.0};
+    const std::vector<double> k{-0.5, 0.0, 0.3};
+
+    const auto localVol{uv::models::svi::localVol<double>(slices, t, k)};
+
+    ASSERT_EQ(localVol.rows(), t.size());
+    ASSERT_EQ(localVol.cols(), k.size());
+
+    for (std::size_t i{0}; i < t.size(); ++i)
+    {
+        for (std::size_t j{0}; j < k.size(); ++j)
+        {
+            EXPECT_NEAR(localVol[i][j], vol, 1e-14);
+        }
+    }
+}
+
+TEST(UnitModelsSVILocalVol, MatchesFiniteDifferenceDupireFormula)
+{
+    const auto slices{makeSlices()};
+
+    constexpr double hk{1e-4};
+    constexpr double ht{1e-5};
+
+    for (const double t : {0.75, 1.25, 1.8})
+    {
+        for (const double k : {-0.4, -0.1, 0.0, 0.2, 0.5})
+        {
+            const double w{interpolatedTotalVariance(slices, t, k)};
+            const double wUp{interpolatedTotalVariance(slices, t, k + hk)};
+            const double wDown{interpolatedTotalVariance(slices, t, k - hk)};
+            const double wD1{(wUp - wDown) / (2.0 * hk)};
+            const double wD2{(wUp - 2.0 * w + wDown) / (hk * hk)};
+            const double wDt{
+                (interpolatedTotalVariance(slices, t + ht, k) -
+                 interpolatedTotalVariance(slices, t - ht, k)) /
+                (2.0 * ht)
+            };
+
+            const double expected{std::sqrt(wDt / uv::models::svi::gk(k, w, wD1, wD2))};
+
+            EXPECT_NEAR(uv::models::svi::localVol(slices, t, k), expected, 1e-6)
+                << "t=" << t << " k=" << k;
+        }
+    }
+}
+
+TEST(UnitModelsSVILocalVol, RowOverloadMatchesScalarOverload)
+{
+    const auto slices{makeSlices()};
+    const std::array<double, 4> k{-0.3, 0.0, 0.1, 0.4};
+    std::array<double, 4> out{};
+
+    uv::models::svi::localVol<double>(out, slices, 0.3, k);
+
+    for (std::size_t j{0}; j < k.size(); ++j)
+    {
+        EXPECT_DOUBLE_EQ(out[j], uv::models::svi::localVol(slices, 0.3, k[j]));
+    }
+}
+
+TEST(UnitModelsSVILocalVol, RejectsCalendarArbitrageAndUnorderedSlices)
+{
+    const uv::Vector<uv::models::svi::Params<double>> decreasing{
+        uv::models::svi::Params<double>{0.5, 0.04, 0.1, 0.0, 0.0, 0.2},
+        uv::models::svi::Params<double>{1.0, 0.01, 0.1, 0.0, 0.0, 0.2}
+    };
+
+    EXPECT_THROW(
+        uv::models::svi::localVol(decreasing, 0.75, 0.0),
+        uv::errors::UnifiedVolError
+    );
+
+    const uv::Vector<uv::models::svi::Params<double>> unordered{
+        uv::models::svi::Params<double>{1.0, 0.04, 0.1, 0.0, 0.0, 0.2},
+        uv::models::svi::Params<double>{0.5, 0.08, 0.1, 0.0, 0.0, 0.2}
+    };
+
+    EXPECT_THROW(
+        uv::models::svi::localVol(unordered, 0.75, 0.0),
+        uv::errors::UnifiedVolError
+    );
+}
@@ -0,0 +1,248 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Models/Scenario/Engine.hpp"
+#include "Base/Errors/Errors.hpp"
+#include "Base/Utils/Metrics.hpp"
+#include "Core/Curve.hpp"
+#include "Core/MarketState.hpp"
+#include "Core/Matrix.hpp"
+#include "Core/VolSurface.hpp"
+#include "Math/Functions/Black.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace uv::models;
+
+namespace
+{
+constexpr double rate{0.03};
+constexpr double yield{0.01};
+const uv::models::heston::Params<double> hestonParams{2.0, 0.04, 0.3, -0.7, 0.04};
+
+struct Market
+{
+    std::vector<double> maturities{0.25, 0.5, 1.0};
+    std::vector<double> strikes{80.0, 90.0, 100.0, 110.0, 120.0};
+    std::vector<double> moneyness{0.8, 0.9, 1.0, 1.1, 1.2};
+};
+
+uv::core::MarketState<double> makeMarketState(const Market& market)
+{
+    std::vector<double> forwards;
+    for (const double t : market.maturities)
+        forwards.push_back(100.0 * std::exp((rate - yield) * t));
+
+    uv::core::Matrix<double> vols{market.maturities.size(), market.strikes.size()};
+    for (std::size_t i{0}; i < vols.rows(); ++i)
+    {
+        for (std::size_t j{0}; j < vols.cols(); ++j)
+            vols[i][j] = 0.25 - 0.1 * std::log(market.moneyness[j]);
+    }
+
+    return uv::core::MarketState<double>{
+        uv::core::Curve<double>{rate, market.maturities},
+        uv::core::Curve<double>{yield, market.maturities},
+        uv::core::VolSurface<double>{
+            market.maturities,
+            forwards,
+            market.strikes,
+            market.moneyness,
+            vols
+        }
+    };
+}
+
+std::vector<scenario::Shock> spotLadder(std::size_t n)
+{
+    std::vector<scenario::Shock> shocks;
+    for (std::size_t s{0}; s < n; ++s)
+        shocks.push_back({.spot = 0.02 * (static_cast<double>(s) - n / 2.0)});
+
+    return shocks;
+}
+} // namespace
+
+TEST(UnitModelsScenarioEngine, UnshockedScenarioReproducesBasePrices)
+{
+    const Market market;
+    const auto state{makeMarketState(market)};
+    const scenario::Engine<double> engine{state, hestonParams};
+
+    const std::vector<scenario::Shock> shocks(1);
+
+    const auto black{engine.revalue(shocks, scenario::Model::Black)};
+    const auto expectedBlack{
+        uv::math::black::priceB76(state.volSurface, state.interestCurve)
+    };
+
+    heston::price::Pricer<double> pricer{};
+    pricer.setParams(hestonParams);
+
+    const auto heston{engine.revalue(shocks, scenario::Model::Heston)};
+    const auto expectedHeston{pricer.callPrice(state.volSurface, state.interestCurve)};
+
+    ASSERT_EQ(black.numScenarios(), 1u);
+    ASSERT_EQ(black.numMaturities(), market.maturities.size());
+    ASSERT_EQ(black.numStrikes(), market.strikes.size());
+
+    for (std::size_t i{0}; i < market.maturities.size(); ++i)
+    {
+        for (std::size_t j{0}; j < market.strikes.size(); ++j)
+        {
+            EXPECT_NEAR(black(0, i, j), expectedBlack[i][j], 1e-12);
+            EXPECT_NEAR(heston(0, i, j), expectedHeston[i][j], 1e-12);
+        }
+    }
+}
+
+TEST(UnitModelsScenarioEngine, SpotAndRateShocksMatchRepricedForwards)
+{
+    const Market market;
+    const auto state{makeMarketState(market)};
+    const scenario::Engine<double> engine{state, hestonParams};
+
+    std::vector<scenario::Shock> shocks{spotLadder(9)};
+    shocks.push_back({.spot = 0.05, .rate = 0.01});
+    shocks.push_back({.rate = -0.02});
+
+    const auto grid{engine.revalue(shocks, scenario::Model::Heston)};
+
+    heston::price::Pricer<double> pricer{};
+    pricer.setParams(hestonParams);
+
+    for (std::size_t s{0}; s < shocks.size(); ++s)
+    {
+        for (std::size_t i{0}; i < market.maturities.size(); ++i)
+        {
+            const double t{market.maturities[i]};
+            const double r{rate + shocks[s].rate};
+            const double dF{std::exp(-r * t)};
+            const double F{100.0 * (1.0 + shocks[s].spot) * std::exp((r - yield) * t)};
+
+            for (std::size_t j{0}; j < market.strikes.size(); ++j)
+            {
+                const double expected{pricer.callPrice(t, dF, F, market.strikes[j])};
+                EXPECT_NEAR(grid(s, i, j), expected, 1e-10)
+                    << "s=" << s << " i=" << i << " j=" << j;
+            }
+        }
+    }
+}
+
+TEST(UnitModelsScenarioEngine, SpotLadderSharesCharacteristicFunction)
+{
+    const Market market;
+    const scenario::Engine<double> engine{makeMarketState(market), hestonParams};
+
+    const std::vector<scenario::Shock> single(1);
+    const std::vector<scenario::Shock> ladder{spotLadder(16)};
+
+    using uv::utils::Counter;
+    using uv::utils::Metrics;
+
+    auto before{Metrics::snapshot()};
+    engine.revalue(single, scenario::Model::Heston);
+    const auto singleCount{(Metrics::snapshot() - before)[Counter::CharFunction]};
+
+    before = Metrics::snapshot();
+    engine.revalue(ladder, scenario::Model::Heston);
+    const auto ladderCount{(Metrics::snapshot() - before)[Counter::CharFunction]};
+
+    // Pricing each scenario on its own would need about 16 times as many.
+    EXPECT_GT(singleCount, 0u);
+    EXPECT_LT(ladderCount, 8 * singleCount);
+}
+
+TEST(UnitModelsScenarioEngine, VolAndSkewShocksShiftModelInputs)
+{
+    const Market market;
+    const auto state{makeMarketState(market)};
+    const scenario::Engine<double> engine{state, hestonParams};
+
+    const std::vector<scenario::Shock> shocks{
+        {.vol = 0.02},
+        {.spot = -0.1, .vol = 0.02},
+        {.skew = 0.1}
+    };
+
+    const auto black{engine.revalue(shocks, scenario::Model::Black)};
+    const auto heston{engine.revalue(shocks, scenario::Model::Heston)};
+
+    heston::price::Pricer<double> volShifted{};
+    volShifted.setParams({2.0, 0.22 * 0.22, 0.3, -0.7, 0.22 * 0.22});
+
+    heston::price::Pricer<double> rhoShifted{};
+    rhoShifted.setParams({2.0, 0.04, 0.3, -0.6, 0.04});
+
+    for (std::size_t i{0}; i < market.maturities.size(); ++i)
+    {
+        const double t{market.maturities[i]};
+        const double dF{std::exp(-rate * t)};
+        const double F{state.volSurface.forwards()[i]};
+
+        for (std::size_t j{0}; j < market.strikes.size(); ++j)
+        {
+            const double K{market.strikes[j]};
+            const double vol{state.volSurface.vol()[i][j]};
+            const double k{std::log(K / F)};
+
+            EXPECT_NEAR(
+                black(0, i, j),
+                uv::math::black::priceB76(t, dF, F, vol + 0.02, K),
+                1e-12
+            );
+            EXPECT_NEAR(
+                black(1, i, j),
+                uv::math::black::priceB76(t, dF, 0.9 * F, vol + 0.02, K),
+                1e-12
+            );
+            EXPECT_NEAR(
+                black(2, i, j),
+                uv::math::black::priceB76(t, dF, F, vol + 0.1 * k, K),
+                1e-12
+            );
+
+            EXPECT_NEAR(heston(0, i, j), volShifted.callPrice(t, dF, F, K), 1e-10);
+            EXPECT_NEAR(heston(1, i, j), volShifted.callPrice(t, dF, 0.9 * F, K), 1e-10);
+            EXPECT_NEAR(heston(2, i, j), rhoShifted.callPrice(t, dF, F, K), 1e-10);
+        }
+    }
+}
+
+TEST(UnitModelsScenarioEngine, RejectsInvalidShocks)
+{
+    const Market market;
+    const auto state{makeMarketState(market)};
+
+    const scenario::Engine<double> blackOnly{state};
+    const scenario::Engine<double> engine{state, hestonParams};
+
+    const std::vector<scenario::Shock> base(1);
+    const std::vector<scenario::Shock> wipeout{{.spot = -1.0}};
+    const std::vector<scenario::Shock> negativeVol{{.vol = -0.5}};
+    const std::vector<scenario::Shock> rhoOutOfRange{{.skew = -0.5}};
+
+    EXPECT_THROW(
+        blackOnly.revalue(base, scenario::Model::Heston),
+        uv::errors::UnifiedVolError
+    );
+    EXPECT_THROW(
+        engine.revalue(wipeout, scenario::Model::Black),
+        uv::errors::UnifiedVolError
+    );
+    EXPECT_THROW(
+        engine.revalue(negativeVol, scenario::Model::Black),
+        uv::errors::UnifiedVolError
+    );
+    EXPECT_THROW(
+        engine.revalue(negativeVol, scenario::Model::Heston),
+        uv::errors::UnifiedVolError
+    );
+    EXPECT_THROW(
+        engine.revalue(rhoOutOfRange, scenario::Model::Heston),
+        uv::errors::UnifiedVolError
+    );
+}
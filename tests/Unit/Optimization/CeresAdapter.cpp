@@ -5,6 +5,8 @@
 
 #include <ceres/ceres.h>
 #include <gtest/gtest.h>
+#include <optional>
+#include <stop_token>
 
 namespace ceres_detail = uv::opt::ceres::detail;
 namespace ceres_opt = uv::opt::ceres;
@@ -61,3 +63,41 @@ TEST(UnitOptimizationCeresAdapter, RejectsUnknownEnumValues)
         uv::errors::UnifiedVolError
     );
 }
+
+TEST(UnitOptimizationCeresAdapter, StopCallbackTerminatesOnceConditionFires)
+{
+    std::stop_source source;
+    const uv::opt::StopCondition stop{.token = source.get_token()};
+    ceres_detail::StopCallback callback{stop};
+    const ::ceres::IterationSummary summary{};
+
+    EXPECT_EQ(callback(summary), ::ceres::SOLVER_CONTINUE);
+    EXPECT_FALSE(callback.reason().has_value());
+
+    source.request_stop();
+
+    EXPECT_EQ(callback(summary), ::ceres::SOLVER_TERMINATE_SUCCESSFULLY);
+    EXPECT_EQ(callback.reason(), uv::opt::Termination::Cancelled);
+}
+
+TEST(UnitOptimizationCeresAdapter, MapsTerminationTypes)
+{
+    using uv::opt::Termination;
+
+    EXPECT_EQ(
+        ceres_detail::toTermination(::ceres::CONVERGENCE, std::nullopt),
+        Termination::Converged
+    );
+    EXPECT_EQ(
+        ceres_detail::toTermination(::ceres::NO_CONVERGENCE, std::nullopt),
+        Termination::MaxEval
+    );
+    EXPECT_EQ(
+        ceres_detail::toTermination(::ceres::USER_SUCCESS, Termination::DeadlineExceeded),
+        Termination::DeadlineExceeded
+    );
+    EXPECT_EQ(
+        ceres_detail::toTermination(::ceres::FAILURE, std::nullopt),
+        Termination::Failed
+    );
+}
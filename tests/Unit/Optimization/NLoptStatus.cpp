@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 #include <nlopt.hpp>
+#include <optional>
 
 namespace nlopt_detail = uv::opt::nlopt::detail;
 
@@ -102,3 +103,31 @@ TEST(UnitOptimizationNLoptStatus, ConvertsRawResultsToStrings)
     EXPECT_EQ(nlopt_detail::toString(::nlopt::SUCCESS), "SUCCESS");
     EXPECT_EQ(nlopt_detail::toString(::nlopt::ROUNDOFF_LIMITED), "ROUNDOFF_LIMITED");
 }
+
+TEST(UnitOptimizationNLoptStatus, MapsStatusesToTerminations)
+{
+    using uv::opt::Termination;
+
+    EXPECT_EQ(
+        nlopt_detail::toTermination(nlopt_detail::NLoptStatus::FtolReached, std::nullopt),
+        Termination::Converged
+    );
+    EXPECT_EQ(
+        nlopt_detail::toTermination(
+            nlopt_detail::NLoptStatus::MaxevalReached,
+            std::nullopt
+        ),
+        Termination::MaxEval
+    );
+    EXPECT_EQ(
+        nlopt_detail::toTermination(nlopt_detail::NLoptStatus::Failure, std::nullopt),
+        Termination::Failed
+    );
+    EXPECT_EQ(
+        nlopt_detail::toTermination(
+            nlopt_detail::NLoptStatus::ForcedStop,
+            Termination::DeadlineExceeded
+        ),
+        Termination::DeadlineExceeded
+    );
+}
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Optimization/Stop.hpp"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <stop_token>
+
+using uv::opt::StopCondition;
+using uv::opt::Termination;
+
+TEST(UnitOptimizationStop, DefaultConditionNeverFires)
+{
+    const StopCondition stop{};
+
+    EXPECT_FALSE(stop.active());
+    EXPECT_FALSE(stop.check().has_value());
+}
+
+TEST(UnitOptimizationStop, ReportsCancellationRequests)
+{
+    std::stop_source source;
+    const StopCondition stop{.token = source.get_token()};
+
+    EXPECT_TRUE(stop.active());
+    EXPECT_FALSE(stop.check().has_value());
+
+    source.request_stop();
+
+    EXPECT_EQ(stop.check(), Termination::Cancelled);
+}
+
+TEST(UnitOptimizationStop, ReportsExpiredDeadlines)
+{
+    const StopCondition expired{StopCondition::within(std::chrono::seconds{-1})};
+    const StopCondition pending{StopCondition::within(std::chrono::hours{1})};
+
+    EXPECT_EQ(expired.check(), Termination::DeadlineExceeded);
+    EXPECT_FALSE(pending.check().has_value());
+}
+
+TEST(UnitOptimizationStop, CancellationTakesPrecedenceOverDeadline)
+{
+    std::stop_source source;
+    source.request_stop();
+
+    const StopCondition stop{
+        StopCondition::within(std::chrono::seconds{-1}, source.get_token())
+    };
+
+    EXPECT_EQ(stop.check(), Termination::Cancelled);
+}
+
+TEST(UnitOptimizationStop, WorstTerminationFavoursTruncation)
+{
+    EXPECT_EQ(
+        uv::opt::worst(Termination::Converged, Termination::MaxEval),
+        Termination::MaxEval
+    );
+    EXPECT_EQ(
+        uv::opt::worst(Termination::Failed, Termination::DeadlineExceeded),
+        Termination::DeadlineExceeded
+    );
+    EXPECT_TRUE(uv::opt::isTruncated(Termination::Cancelled));
+    EXPECT_TRUE(uv::opt::isTruncated(Termination::DeadlineExceeded));
+    EXPECT_FALSE(uv::opt::isTruncated(Termination::MaxEval));
+
+    const uv::opt::Result<double> result{
+        .params = 1.0,
+        .termination = Termination::Cancelled
+    };
+
+    EXPECT_TRUE(result.truncated());
+    EXPECT_EQ(uv::opt::toString(Termination::DeadlineExceeded), "DEADLINE_EXCEEDED");
+}
@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Service/BatchPricer.hpp"
+#include "Base/Errors/Errors.hpp"
+#include "Math/Functions/Black.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace uv::service;
+
+namespace
+{
+constexpr double spot{100.0};
+constexpr double flatVol{0.2};
+const std::vector<double> maturities{0.25, 0.5, 1.0};
+
+CalibratedSurface makeSurface()
+{
+    uv::Vector<uv::models::svi::Params<double>> svi;
+    for (const double t : maturities)
+        svi.emplace_back(t, flatVol * flatVol * t, 0.0, 0.0, 0.0, 0.1);
+
+    return CalibratedSurface{
+        .name = "TEST",
+        .marketData = {.interestRate = 0.03, .dividendYield = 0.01, .spot = spot},
+        .sviParams = svi,
+        .hestonParams = {2.0, 0.04, 0.3, -0.7, 0.04}
+    };
+}
+
+Request makeRequest(std::uint64_t id, RequestKind kind, Model model, double t, double K)
+{
+    return Request{
+        .id = id,
+        .kind = kind,
+        .model = model,
+        .surface = "TEST",
+        .maturity = t,
+        .strike = K
+    };
+}
+
+double normalCdf(double x)
+{
+    return 0.5 * std::erfc(-x / std::sqrt(2.0));
+}
+} // namespace
+
+TEST(UnitServiceBatchPricer, CoalescesSameMaturityRequestsIntoOneCall)
+{
+    const BatchPricer pricer{{makeSurface()}};
+
+    std::vector<Request> requests;
+    for (std::size_t i{0}; i < 10; ++i)
+    {
+        requests.push_back(makeRequest(
+            i,
+            RequestKind::Price,
+            Model::Heston,
+            0.5,
+            80.0 + 5.0 * static_cast<double>(i)
+        ));
+    }
+
+    std::vector<Response> responses(requests.size());
+    EXPECT_EQ(pricer.price(requests, responses), 1u);
+
+    for (std::size_t i{0}; i < responses.size(); ++i)
+    {
+        EXPECT_EQ(responses[i].status, Status::Ok);
+        EXPECT_EQ(responses[i].id, i);
+        EXPECT_GT(responses[i].values[0], 0.0);
+
+        if (i > 0)
+        {
+            EXPECT_LT(responses[i].values[0], responses[i - 1].values[0]);
+        }
+    }
+}
+
+TEST(UnitServiceBatchPricer, GroupsByMaturityAndBumpsOnlyForGreeks)
+{
+    const BatchPricer pricer{{makeSurface()}};
+
+    const std::vector<Request> requests{
+        makeRequest(0, RequestKind::Price, Model::Heston, 0.5, 100.0),
+        makeRequest(1, RequestKind::Vol, Model::Heston, 1.0, 100.0),
+        makeRequest(2, RequestKind::Greeks, Model::Heston, 0.5, 105.0),
+        makeRequest(3, RequestKind::Price, Model::SVI, 0.5, 100.0)
+    };
+
+    std::vector<Response> responses(requests.size());
+
+    // Heston 0.5y with greeks: 3 calls; Heston 1y: 1 call; SVI 0.5y: 1 call.
+    EXPECT_EQ(pricer.price(requests, responses), 5u);
+
+    for (const Response& response : responses)
+        EXPECT_EQ(response.status, Status::Ok);
+}
+
+TEST(UnitServiceBatchPricer, FlatSviMatchesBlack)
+{
+    const BatchPricer pricer{{makeSurface()}};
+
+    const double t{0.75};
+    const double K{110.0};
+    const double dF{std::exp(-0.03 * t)};
+    const double F{spot * std::exp((0.03 - 0.01) * t)};
+
+    const std::vector<Request> requests{
+        makeRequest(0, RequestKind::Vol, Model::SVI, t, K),
+        makeRequest(1, RequestKind::Greeks, Model::SVI, t, K)
+    };
+
+    std::vector<Response> responses(requests.size());
+    pricer.price(requests, responses);
+
+    EXPECT_NEAR(responses[0].values[0], flatVol, 1e-12);
+
+    const double d1{
+        (std::log(F / K) + 0.5 * flatVol * flatVol * t) / (flatVol * std::sqrt(t))
+    };
+
+    const auto& greeks{responses[1].values};
+    EXPECT_NEAR(greeks[0], uv::math::black::priceB76(t, dF, F, flatVol, K), 1e-10);
+    EXPECT_NEAR(greeks[1], dF * F / spot * normalCdf(d1), 1e-5);
+    EXPECT_GT(greeks[2], 0.0);
+    EXPECT_NEAR(greeks[3], uv::math::black::vegaB76(t, dF, F, flatVol, K), 1e-10);
+}
+
+TEST(UnitServiceBatchPricer, PutsSatisfyParity)
+{
+    const BatchPricer pricer{{makeSurface()}};
+
+    const double t{0.5};
+    const double K{95.0};
+    const double dF{std::exp(-0.03 * t)};
+    const double F{spot * std::exp((0.03 - 0.01) * t)};
+
+    std::vector<Request> requests{
+        makeRequest(0, RequestKind::Greeks, Model::Heston, t, K),
+        makeRequest(1, RequestKind::Greeks, Model::Heston, t, K)
+    };
+    requests[1].optionType = OptionType::Put;
+
+    std::vector<Response> responses(requests.size());
+    EXPECT_EQ(pricer.price(requests, responses), 3u);
+
+    const auto& call{responses[0].values};
+    const auto& put{responses[1].values};
+
+    EXPECT_NEAR(call[0] - put[0], dF * (F - K), 1e-10);
+    EXPECT_NEAR(call[1] - put[1], dF * F / spot, 1e-10);
+    EXPECT_DOUBLE_EQ(call[2], put[2]);
+}
+
+TEST(UnitServiceBatchPricer, FlagsBadRequestsWithoutPricing)
+{
+    const BatchPricer pricer{{makeSurface()}};
+
+    std::vector<Request> requests{
+        makeRequest(0, RequestKind::Price, Model::Heston, 0.5, 100.0),
+        makeRequest(1, RequestKind::Price, Model::Heston, -1.0, 100.0),
+        makeRequest(2, RequestKind::Price, Model::Heston, 0.5, 100.0),
+        makeRequest(3, RequestKind::Stats, Model::Heston, 0.5, 100.0)
+    };
+    requests[0].surface = "MISSING";
+
+    std::vector<Response> responses(requests.size());
+    EXPECT_EQ(pricer.price(requests, responses), 1u);
+
+    EXPECT_EQ(responses[0].status, Status::UnknownSurface);
+    EXPECT_EQ(responses[1].status, Status::InvalidRequest);
+    EXPECT_EQ(responses[2].status, Status::Ok);
+    EXPECT_EQ(responses[3].status, Status::InvalidRequest);
+}
+
+TEST(UnitServiceBatchPricer, RejectsDuplicateSurfaces)
+{
+    EXPECT_THROW(
+        (BatchPricer{{makeSurface(), makeSurface()}}),
+        uv::errors::UnifiedVolError
+    );
+}
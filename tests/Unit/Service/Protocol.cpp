@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Service/Protocol.hpp"
+#include "Base/Errors/Errors.hpp"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace uv::service;
+
+TEST(UnitServiceProtocol, HeaderRoundTripsRequest)
+{
+    const Request request{
+        .id = 42,
+        .kind = RequestKind::Greeks,
+        .model = Model::SVI,
+        .optionType = OptionType::Put,
+        .surface = "SPY",
+        .maturity = 0.5,
+        .strike = 95.0
+    };
+
+    const RequestHeader header{makeHeader(request)};
+    EXPECT_NO_THROW(validate(header));
+    EXPECT_EQ(header.surfaceLength, 3u);
+
+    const Request decoded{makeRequest(header, request.surface)};
+
+    EXPECT_EQ(decoded.id, request.id);
+    EXPECT_EQ(decoded.kind, request.kind);
+    EXPECT_EQ(decoded.model, request.model);
+    EXPECT_EQ(decoded.optionType, request.optionType);
+    EXPECT_EQ(decoded.surface, request.surface);
+    EXPECT_DOUBLE_EQ(decoded.maturity, request.maturity);
+    EXPECT_DOUBLE_EQ(decoded.strike, request.strike);
+}
+
+TEST(UnitServiceProtocol, RejectsOverlongSurfaceName)
+{
+    Request request{};
+    request.surface = std::string(MaxSurfaceNameLength + 1, 'x');
+
+    EXPECT_THROW(makeHeader(request), uv::errors::UnifiedVolError);
+}
+
+TEST(UnitServiceProtocol, RejectsMalformedFrames)
+{
+    RequestHeader badMagic{makeHeader(Request{})};
+    badMagic.magic[0] = 'X';
+    EXPECT_THROW(validate(badMagic), uv::errors::UnifiedVolError);
+
+    RequestHeader badVersion{makeHeader(Request{})};
+    badVersion.version = ProtocolVersion + 1;
+    EXPECT_THROW(validate(badVersion), uv::errors::UnifiedVolError);
+
+    RequestHeader badKind{makeHeader(Request{})};
+    badKind.kind = static_cast<RequestKind>(std::uint8_t{200});
+    EXPECT_THROW(validate(badKind), uv::errors::UnifiedVolError);
+
+    Response badResponse{};
+    badResponse.status = static_cast<Status>(std::uint8_t{200});
+    EXPECT_THROW(validate(badResponse), uv::errors::UnifiedVolError);
+}
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Support/Memory/Allocation.hpp"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+TEST(SupportAllocation, CountsScalarArrayAndAlignedAllocations)
+{
+    struct alignas(64) Wide
+    {
+        double values[8]{};
+    };
+
+    std::unique_ptr<int> scalar;
+    std::unique_ptr<double[]> array;
+    std::unique_ptr<Wide> wide;
+    void* raw{};
+
+    const auto allocated = uv::tests::memory::countAllocations(
+        [&]
+        {
+            scalar = std::make_unique<int>(1);
+            array = std::make_unique<double[]>(16);
+            wide = std::make_unique<Wide>();
+            raw = ::operator new(8, std::nothrow);
+        }
+    );
+
+    EXPECT_EQ(allocated.allocations, 4U);
+    EXPECT_EQ(allocated.deallocations, 0U);
+    EXPECT_GE(allocated.bytes, sizeof(int) + 16 * sizeof(double) + sizeof(Wide) + 8);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(wide.get()) % alignof(Wide), 0U);
+
+    const auto released = uv::tests::memory::countAllocations(
+        [&]
+        {
+            scalar.reset();
+            array.reset();
+            wide.reset();
+            ::operator delete(raw, std::nothrow);
+        }
+    );
+
+    EXPECT_EQ(released.allocations, 0U);
+    EXPECT_EQ(released.deallocations, 4U);
+}
+
+TEST(SupportAllocation, ReportsZeroForAllocationFreeCode)
+{
+    std::vector<double> values(64, 1.0);
+    double sum{};
+
+    const auto counts = uv::tests::memory::countAllocations(
+        [&]
+        {
+            for (const double v : values)
+                sum += v;
+        }
+    );
+
+    EXPECT_DOUBLE_EQ(sum, 64.0);
+    EXPECT_EQ(counts.allocations, 0U);
+    EXPECT_EQ(counts.deallocations, 0U);
+}
+
+TEST(SupportAllocation, IgnoresAllocationsOnOtherThreads)
+{
+    constexpr std::size_t size{4096};
+    std::size_t workerBytes{};
+
+    const uv::tests::memory::AllocationScope scope;
+
+    std::thread worker{[&]
+                       {
+                           const auto counts = uv::tests::memory::countAllocations(
+                               [] { std::vector<double> buffer(size); }
+                           );
+                           workerBytes = counts.bytes;
+                       }};
+    worker.join();
+
+    EXPECT_GE(workerBytes, size * sizeof(double));
+    EXPECT_LT(scope.counts().bytes, size * sizeof(double));
+}
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "IO/JSON/Read.hpp"
+#include "Support/Performance/Baselines.hpp"
+#include "Support/TempFile.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+uv::tests::performance::SampleSummary summaryOf(double medianMs, double halfWidth)
+{
+    uv::tests::performance::SampleSummary summary{};
+    summary.samplesMs = {medianMs};
+    summary.medianMs = medianMs;
+    summary.lowerMs = medianMs - halfWidth;
+    summary.upperMs = medianMs + halfWidth;
+    return summary;
+}
+} // namespace
+
+TEST(PerformanceBaselines, CommittedBaselinesHaveValidSchema)
+{
+    const auto root = uv::io::json::read(uv::tests::performance::BaselinesPath);
+
+    for (const auto& [machine, entries] : root.at("machines").object)
+    {
+        for (const auto& [key, entry] : entries.object)
+        {
+            EXPECT_NO_THROW(static_cast<void>(uv::tests::performance::readBaseline(
+                uv::tests::performance::BaselinesPath,
+                machine,
+                key
+            ))) << machine << " " << key;
+        }
+    }
+}
+
+TEST(PerformanceBaselines, ReadsBaselineForMachineAndKey)
+{
+    const auto path = uv::tests::writeTempFile(
+        "unifiedvol_performance_baselines.json",
+        R"({"machines": {"cpu": {
+              "work": {"medianMs": 10, "lowerMs": 9, "upperMs": 11}
+            }}})"
+    );
+
+    const auto baseline = uv::tests::performance::readBaseline(path, "cpu", "work");
+    ASSERT_TRUE(baseline.has_value());
+    EXPECT_DOUBLE_EQ(baseline->medianMs, 10.0);
+    EXPECT_DOUBLE_EQ(baseline->lowerMs, 9.0);
+    EXPECT_DOUBLE_EQ(baseline->upperMs, 11.0);
+
+    EXPECT_FALSE(uv::tests::performance::readBaseline(path, "other", "work"));
+    EXPECT_FALSE(uv::tests::performance::readBaseline(path, "cpu", "other"));
+}
+
+TEST(PerformanceBaselines, RejectsNonPositiveBaseline)
+{
+    const auto path = uv::tests::writeTempFile(
+        "unifiedvol_bad_performance_baseline.json",
+        R"({"machines": {"cpu": {
+              "work": {"medianMs": 0, "lowerMs": 0, "upperMs": 0}
+            }}})"
+    );
+
+    EXPECT_THROW(
+        static_cast<void>(uv::tests::performance::readBaseline(path, "cpu", "work")),
+        std::runtime_error
+    );
+}
+
+TEST(PerformanceBaselines, FlagsOnlySignificantRegressionsBeyondTolerance)
+{
+    const uv::tests::performance::Baseline baseline{10.0, 9.8, 10.2};
+
+    const auto noBaseline =
+        uv::tests::performance::compareToBaseline(summaryOf(50.0, 0.1), std::nullopt);
+    EXPECT_FALSE(noBaseline.regressed);
+
+    // 4% slower: within tolerance.
+    EXPECT_FALSE(
+        uv::tests::performance::compareToBaseline(summaryOf(10.4, 0.1), baseline)
+            .regressed
+    );
+
+    // 10% slower but the interval reaches back inside the tolerance band.
+    EXPECT_FALSE(
+        uv::tests::performance::compareToBaseline(summaryOf(11.0, 1.0), baseline)
+            .regressed
+    );
+
+    // 10% slower with a tight interval.
+    const auto slower =
+        uv::tests::performance::compareToBaseline(summaryOf(11.0, 0.1), baseline);
+    EXPECT_TRUE(slower.regressed);
+    EXPECT_NEAR(slower.ratio, 1.1, 1e-12);
+}
+
+TEST(PerformanceBaselines, AppendsParseableHistoryRecords)
+{
+    const auto path =
+        std::filesystem::temp_directory_path() / "unifiedvol_performance_history.jsonl";
+    std::filesystem::remove(path);
+
+    const auto summary = summaryOf(12.5, 0.5);
+    const auto comparison = uv::tests::performance::compareToBaseline(
+        summary,
+        uv::tests::performance::Baseline{10.0, 9.9, 10.1}
+    );
+
+    uv::tests::performance::appendHistory(path, "cpu \"x\"", "work", summary, comparison);
+    uv::tests::performance::appendHistory(path, "cpu \"x\"", "work", summary, {});
+
+    std::ifstream in{path};
+    std::string line;
+    int records{};
+
+    while (std::getline(in, line))
+    {
+        const auto record = uv::io::json::parse(line);
+        EXPECT_EQ(record.at("machine").asString(), "cpu \"x\"");
+        EXPECT_EQ(record.at("key").asString(), "work");
+        EXPECT_DOUBLE_EQ(record.at("medianMs").asNumber(), 12.5);
+        EXPECT_DOUBLE_EQ(record.at("lowerMs").asNumber(), 12.0);
+        ++records;
+    }
+
+    EXPECT_EQ(records, 2);
+}
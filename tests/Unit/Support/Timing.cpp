@@ -4,11 +4,22 @@
 
 #include <gtest/gtest.h>
 #include <stdexcept>
+#include <vector>
 
-TEST(PerformanceTiming, RejectsZeroSamples)
+TEST(PerformanceTiming, RejectsInvalidSampleCounts)
 {
     EXPECT_THROW(
-        static_cast<void>(uv::tests::performance::bestElapsedMs([] {}, 0, 0)),
+        static_cast<void>(uv::tests::performance::sampleElapsedMs(
+            [] {},
+            {.warmups = 0, .minSamples = 0}
+        )),
+        std::invalid_argument
+    );
+    EXPECT_THROW(
+        static_cast<void>(uv::tests::performance::sampleElapsedMs(
+            [] {},
+            {.minSamples = 4, .maxSamples = 3}
+        )),
         std::invalid_argument
     );
 }
@@ -17,15 +28,70 @@ TEST(PerformanceTiming, InvokesWarmupsBeforeMeasuredSamples)
 {
     int calls{};
 
-    const double elapsedMs = uv::tests::performance::bestElapsedMs(
+    const auto stats = uv::tests::performance::sampleElapsedMs(
         [&]
         {
             ++calls;
         },
-        3,
-        2
+        {.warmups = 2, .minSamples = 3, .maxSamples = 3}
     );
 
     EXPECT_EQ(calls, 5);
-    EXPECT_GE(elapsedMs, 0.0);
+    EXPECT_EQ(stats.samplesMs.size(), 3U);
+    EXPECT_GE(stats.medianMs, 0.0);
+}
+
+TEST(PerformanceTiming, StopsAtTimeLimitAfterMinimumSamples)
+{
+    int calls{};
+
+    const auto stats = uv::tests::performance::sampleElapsedMs(
+        [&]
+        {
+            ++calls;
+        },
+        {.warmups = 0,
+         .minSamples = 4,
+         .maxSamples = 100,
+         .maxTotalMs = 0.0,
+         .targetRelativeWidth = 0.0}
+    );
+
+    EXPECT_EQ(calls, 4);
+    EXPECT_EQ(stats.samplesMs.size(), 4U);
+}
+
+TEST(PerformanceTiming, MedianHandlesOddAndEvenCounts)
+{
+    EXPECT_DOUBLE_EQ(uv::tests::performance::median({3.0, 1.0, 2.0}), 2.0);
+    EXPECT_DOUBLE_EQ(uv::tests::performance::median({4.0, 1.0, 3.0, 2.0}), 2.5);
+    EXPECT_THROW(
+        static_cast<void>(uv::tests::performance::median({})),
+        std::invalid_argument
+    );
+}
+
+TEST(PerformanceTiming, BootstrapIntervalBracketsMedian)
+{
+    const std::vector<double> samples{9.8, 10.1, 10.0, 10.4, 9.9, 10.2, 12.5, 10.0};
+
+    const auto stats = uv::tests::performance::summarize(samples);
+    const auto again = uv::tests::performance::summarize(samples);
+
+    EXPECT_LE(stats.lowerMs, stats.medianMs);
+    EXPECT_GE(stats.upperMs, stats.medianMs);
+    EXPECT_GE(stats.lowerMs, 9.8);
+    EXPECT_LE(stats.upperMs, 12.5);
+    EXPECT_DOUBLE_EQ(stats.lowerMs, again.lowerMs);
+    EXPECT_DOUBLE_EQ(stats.upperMs, again.upperMs);
+}
+
+TEST(PerformanceTiming, BootstrapIntervalCollapsesForConstantSamples)
+{
+    const auto stats = uv::tests::performance::summarize({5.0, 5.0, 5.0, 5.0, 5.0});
+
+    EXPECT_DOUBLE_EQ(stats.medianMs, 5.0);
+    EXPECT_DOUBLE_EQ(stats.lowerMs, 5.0);
+    EXPECT_DOUBLE_EQ(stats.upperMs, 5.0);
+    EXPECT_DOUBLE_EQ(stats.relativeWidth(), 0.0);
 }
@@ -2,6 +2,9 @@
 
 #pragma once
 
+#include "Base/Utils/Detail/Log.hpp"
+
+#include <chrono>
 #include <string>
 
 namespace uv
@@ -11,6 +14,11 @@ struct Config
     bool logToConsole{true};
     bool logToFile{true};
     std::string logFile{"calibration.log"};
+    std::chrono::milliseconds logFlushInterval{100};
+    utils::Overflow logOverflow{utils::Overflow::Block};
+    int numThreads{-1};
+    bool pinThreads{false};
+    std::string cpuList{};
 };
 
 void initialize(const Config& cfg = {});
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Types.hpp"
+
+#include <span>
+#include <string_view>
+
+namespace uv::execution
+{
+struct CpuSlot
+{
+    int cpu;
+    int node;
+};
+
+// Parses a Linux cpulist such as "0-7,16,18-19" (the taskset and sysfs syntax).
+Vector<int> parseCpuList(std::string_view list);
+
+// CPUs the process may run on. On Linux this is the scheduler affinity mask,
+// which already reflects cgroup cpusets and taskset; elsewhere all hardware threads.
+Vector<int> allowedCpus();
+
+// NUMA node of a CPU as reported by sysfs, or 0 when the topology is not exposed.
+int numaNode(int cpu);
+
+// Orders CPUs node by node so that consecutive workers share a memory node.
+Vector<CpuSlot> compactPlacement(std::span<const int> cpus);
+
+bool pinCurrentThread(int cpu) noexcept;
+} // namespace uv::execution
@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+namespace uv::execution
+{
+// Blocking queue with a fixed capacity for many producers and many consumers.
+// push() waits while the queue is full, which is what gives pipeline stages
+// backpressure; pop() waits while it is empty. Once closed, pushes fail and pops
+// drain what is left.
+template <typename T> class BoundedQueue
+{
+  public:
+    explicit BoundedQueue(std::size_t capacity);
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    // Returns false, leaving value untouched, if the queue is closed.
+    bool push(T& value);
+
+    // Returns false once the queue is closed and empty.
+    bool pop(T& value);
+
+    void close();
+
+    std::size_t capacity() const noexcept;
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable notFull_;
+    std::condition_variable notEmpty_;
+    std::deque<T> items_;
+    std::size_t capacity_;
+    bool closed_{false};
+};
+} // namespace uv::execution
+
+#include "Base/Execution/Detail/BoundedQueue.inl"
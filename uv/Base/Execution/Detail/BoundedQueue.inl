@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <utility>
+
+namespace uv::execution
+{
+template <typename T> BoundedQueue<T>::BoundedQueue(std::size_t capacity)
+    : capacity_(std::max<std::size_t>(capacity, 1))
+{
+}
+
+template <typename T> bool BoundedQueue<T>::push(T& value)
+{
+    {
+        std::unique_lock lock{mutex_};
+        notFull_.wait(lock, [&] { return closed_ || items_.size() < capacity_; });
+
+        if (closed_)
+            return false;
+
+        items_.push_back(std::move(value));
+    }
+
+    notEmpty_.notify_one();
+    return true;
+}
+
+template <typename T> bool BoundedQueue<T>::pop(T& value)
+{
+    {
+        std::unique_lock lock{mutex_};
+        notEmpty_.wait(lock, [&] { return closed_ || !items_.empty(); });
+
+        if (items_.empty())
+            return false;
+
+        value = std::move(items_.front());
+        items_.pop_front();
+    }
+
+    notFull_.notify_one();
+    return true;
+}
+
+template <typename T> void BoundedQueue<T>::close()
+{
+    {
+        const std::lock_guard lock{mutex_};
+        closed_ = true;
+    }
+
+    notFull_.notify_all();
+    notEmpty_.notify_all();
+}
+
+template <typename T> std::size_t BoundedQueue<T>::capacity() const noexcept
+{
+    return capacity_;
+}
+} // namespace uv::execution
@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <type_traits>
+#include <utility>
+
+namespace uv::execution
+{
+template <typename F> void TaskGroup::run(F&& f)
+{
+    pending_.fetch_add(1, std::memory_order_relaxed);
+
+    executor_.submit(
+        [this, func = std::decay_t<F>(std::forward<F>(f))]() mutable
+        {
+            std::exception_ptr failure;
+
+            try
+            {
+                func();
+            }
+            catch (...)
+            {
+                failure = std::current_exception();
+            }
+
+            finish(failure);
+        }
+    );
+}
+} // namespace uv::execution
@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Execution/Executor.hpp"
+#include "Base/Execution/ThreadPolicy.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <utility>
+
+namespace uv::execution::detail
+{
+inline constexpr std::size_t chunksPerThread{8};
+} // namespace uv::execution::detail
+
+namespace uv::execution
+{
+template <typename F> void parallelFor(
+    std::size_t begin,
+    std::size_t end,
+    F&& f,
+    int numThreads,
+    std::size_t grain
+)
+{
+    if (end <= begin)
+        return;
+
+    const std::size_t count{end - begin};
+    const std::size_t numWorkers{std::min(
+        static_cast<std::size_t>(requestThreads(numThreads)),
+        count
+    )};
+
+    auto&& func = std::forward<F>(f);
+
+    if (numWorkers == 1)
+    {
+        for (std::size_t i{begin}; i < end; ++i)
+            std::invoke(func, i);
+
+        return;
+    }
+
+    const std::size_t autoChunk{count / (numWorkers * detail::chunksPerThread)};
+    const std::size_t chunk{(grain > 0) ? grain : std::max<std::size_t>(autoChunk, 1)};
+
+    std::atomic<std::size_t> next{begin};
+    std::atomic<bool> failed{false};
+
+    const auto runChunks = [&]
+    {
+        const TaskScope scope;
+
+        try
+        {
+            while (!failed.load(std::memory_order_relaxed))
+            {
+                const std::size_t first{next.fetch_add(chunk, std::memory_order_relaxed)};
+
+                if (first >= end)
+                    return;
+
+                const std::size_t last{std::min(first + chunk, end)};
+
+                for (std::size_t i{first}; i < last; ++i)
+                    std::invoke(func, i);
+            }
+        }
+        catch (...)
+        {
+            failed.store(true, std::memory_order_relaxed);
+            throw;
+        }
+    };
+
+    TaskGroup group;
+
+    for (std::size_t worker{1}; worker < numWorkers; ++worker)
+        group.run(runChunks);
+
+    runChunks();
+    group.wait();
+}
+} // namespace uv::execution
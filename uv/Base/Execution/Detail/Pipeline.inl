@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Errors/Errors.hpp"
+#include "Base/Execution/BoundedQueue.hpp"
+#include "Base/Execution/Executor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace uv::execution
+{
+namespace detail
+{
+inline double elapsedMs(
+    std::chrono::steady_clock::time_point from,
+    std::chrono::steady_clock::time_point to
+) noexcept
+{
+    return std::chrono::duration<double, std::milli>(to - from).count();
+}
+} // namespace detail
+
+template <typename Item> Pipeline<Item>& Pipeline<Item>::addStage(
+    std::string name,
+    Stage fn,
+    std::size_t workers,
+    std::size_t capacity
+)
+{
+    stages_.push_back(
+        {std::move(name), std::move(fn), std::max<std::size_t>(workers, 1), capacity}
+    );
+    return *this;
+}
+
+template <typename Item>
+Vector<PipelineResult<Item>> Pipeline<Item>::run(Vector<Item> items)
+{
+    using Clock = std::chrono::steady_clock;
+
+    if (stages_.empty())
+        errors::raise(errors::ErrorCode::InvalidState, "Pipeline has no stages");
+
+    const std::size_t numStages{stages_.size()};
+
+    Vector<PipelineResult<Item>> slots;
+    slots.reserve(items.size());
+    for (Item& item : items)
+        slots.push_back({std::move(item), nullptr, 0});
+
+    Vector<std::unique_ptr<BoundedQueue<std::size_t>>> queues;
+    Vector<StageStats> workerStats;
+    Vector<std::size_t> firstWorker;
+
+    for (const StageSpec& spec : stages_)
+    {
+        queues.push_back(std::make_unique<BoundedQueue<std::size_t>>(spec.capacity));
+        firstWorker.push_back(workerStats.size());
+        workerStats.resize(workerStats.size() + spec.workers);
+    }
+
+    const auto remaining{std::make_unique<std::atomic<std::size_t>[]>(numStages)};
+    for (std::size_t s{0}; s < numStages; ++s)
+        remaining[s].store(stages_[s].workers, std::memory_order_relaxed);
+
+    const auto work = [&](std::size_t s, StageStats& local)
+    {
+        const TaskScope scope;
+        const Stage& fn{stages_[s].fn};
+        std::size_t index{};
+
+        while (true)
+        {
+            const auto waitStart{Clock::now()};
+            if (!queues[s]->pop(index))
+                break;
+            const auto busyStart{Clock::now()};
+            local.starvedMs += detail::elapsedMs(waitStart, busyStart);
+
+            PipelineResult<Item>& slot{slots[index]};
+
+            if (!slot.error)
+            {
+                ++local.items;
+
+                try
+                {
+                    fn(slot.item);
+                }
+                catch (...)
+                {
+                    slot.error = std::current_exception();
+                    slot.failedStage = s;
+                    ++local.failures;
+                }
+            }
+
+            const auto busyEnd{Clock::now()};
+            local.busyMs += detail::elapsedMs(busyStart, busyEnd);
+
+            if (s + 1 < numStages)
+            {
+                queues[s + 1]->push(index);
+                local.blockedMs += detail::elapsedMs(busyEnd, Clock::now());
+            }
+        }
+
+        const bool lastWorker{remaining[s].fetch_sub(1, std::memory_order_acq_rel) == 1};
+        if (lastWorker && s + 1 < numStages)
+            queues[s + 1]->close();
+    };
+
+    const auto start{Clock::now()};
+
+    {
+        Vector<std::jthread> threads;
+
+        try
+        {
+            for (std::size_t s{0}; s < numStages; ++s)
+            {
+                for (std::size_t w{0}; w < stages_[s].workers; ++w)
+                {
+                    StageStats& local{workerStats[firstWorker[s] + w]};
+                    threads.emplace_back(work, s, std::ref(local));
+                }
+            }
+
+            for (std::size_t i{0}; i < slots.size(); ++i)
+                queues.front()->push(i);
+        }
+        catch (...)
+        {
+            for (auto& queue : queues)
+                queue->close();
+            throw;
+        }
+
+        queues.front()->close();
+    }
+
+    stats_.wallMs = detail::elapsedMs(start, Clock::now());
+    stats_.stages.clear();
+
+    for (std::size_t s{0}; s < numStages; ++s)
+    {
+        StageStats total{.name = stages_[s].name, .workers = stages_[s].workers};
+
+        for (std::size_t w{0}; w < stages_[s].workers; ++w)
+        {
+            const StageStats& local{workerStats[firstWorker[s] + w]};
+            total.items += local.items;
+            total.failures += local.failures;
+            total.busyMs += local.busyMs;
+            total.starvedMs += local.starvedMs;
+            total.blockedMs += local.blockedMs;
+        }
+
+        stats_.stages.push_back(std::move(total));
+    }
+
+    return slots;
+}
+
+template <typename Item> const PipelineStats& Pipeline<Item>::stats() const noexcept
+{
+    return stats_;
+}
+} // namespace uv::execution
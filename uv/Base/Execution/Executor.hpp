@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Execution/Affinity.hpp"
+#include "Base/Types.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+
+namespace uv::execution
+{
+// Process-wide pool of worker threads with one deque per worker. Owners pop the
+// newest task from their own deque and idle workers steal the oldest task from
+// the others, trying workers on their own NUMA node first. The calling thread
+// counts towards the concurrency and helps run queued tasks while it waits.
+class Executor
+{
+  public:
+    using Task = std::function<void()>;
+
+    static Executor& instance();
+
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    ~Executor();
+
+    // Resizes the pool. With a CPU list, workers are pinned in compact order with
+    // the first slot left to the calling thread. Must not be called while tasks
+    // are in flight.
+    void configure(int numThreads, std::span<const int> cpus = {});
+
+    int concurrency() const noexcept;
+
+    std::span<const CpuSlot> placement() const noexcept;
+
+    // Queues a task. Tasks must not throw; use TaskGroup to propagate failures.
+    void submit(Task task);
+
+    // Runs one queued task on the calling thread, if any is available.
+    bool runPending();
+
+    static bool insideTask() noexcept;
+
+    // NUMA node of the pinned worker running the caller, or -1 when unpinned.
+    static int currentNode() noexcept;
+
+  private:
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    Executor();
+
+    void start(std::size_t numWorkers);
+    void stop();
+    void work(std::size_t index);
+    bool tryPop(std::size_t index, Task& task);
+    bool steal(Queue& victim, Task& task);
+    void run(Task& task);
+
+    Vector<std::unique_ptr<Queue>> queues_;
+    Vector<Vector<std::size_t>> stealOrder_;
+    Vector<CpuSlot> placement_;
+    Vector<std::jthread> workers_;
+    std::mutex configMutex_;
+    std::mutex sleepMutex_;
+    std::condition_variable wake_;
+    std::atomic<std::ptrdiff_t> queued_{0};
+    std::atomic<std::size_t> nextQueue_{0};
+    std::atomic<int> concurrency_{1};
+    bool stopping_{false};
+};
+
+// Marks the current thread as running executor work for its lifetime, so that
+// nested parallel regions and thread requests run serially.
+class TaskScope
+{
+  public:
+    TaskScope() noexcept;
+    ~TaskScope();
+
+    TaskScope(const TaskScope&) = delete;
+    TaskScope& operator=(const TaskScope&) = delete;
+};
+
+// Set of tasks submitted to the executor that can be waited on together. The
+// first failure is rethrown by wait(); the destructor waits without throwing.
+class TaskGroup
+{
+  public:
+    TaskGroup();
+    explicit TaskGroup(Executor& executor);
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    ~TaskGroup();
+
+    template <typename F> void run(F&& f);
+
+    void wait();
+
+  private:
+    void finish(std::exception_ptr failure) noexcept;
+    void drain() noexcept;
+
+    Executor& executor_;
+    std::atomic<std::size_t> pending_{0};
+    std::mutex mutex_;
+    std::condition_variable done_;
+    std::exception_ptr failure_;
+};
+} // namespace uv::execution
+
+#include "Base/Execution/Detail/Executor.inl"
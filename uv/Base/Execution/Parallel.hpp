@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+
+namespace uv::execution
+{
+// Runs f(i) for every i in [begin, end) on at most requestThreads(numThreads)
+// threads of the shared executor. Indices are handed out in chunks of `grain`
+// (0 picks a chunk size from the range and thread count).
+template <typename F> void parallelFor(
+    std::size_t begin,
+    std::size_t end,
+    F&& f,
+    int numThreads = -1,
+    std::size_t grain = 0
+);
+} // namespace uv::execution
+
+#include "Base/Execution/Detail/Parallel.inl"
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Types.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <string>
+
+namespace uv::execution
+{
+struct StageStats
+{
+    std::string name;
+    std::size_t workers{};
+    std::size_t items{};
+    std::size_t failures{};
+    // Summed over the stage's workers.
+    double busyMs{};
+    double starvedMs{};
+    double blockedMs{};
+};
+
+struct PipelineStats
+{
+    Vector<StageStats> stages;
+    double wallMs{};
+};
+
+template <typename Item> struct PipelineResult
+{
+    Item item;
+    std::exception_ptr error;
+    // Index of the stage that threw; only meaningful when error is set.
+    std::size_t failedStage{};
+};
+
+// Runs items through an ordered list of stages. Every stage owns its worker
+// threads and reads from a bounded queue filled by the previous stage, so a slow
+// stage makes the stages before it block instead of piling up work, and I/O-bound
+// stages overlap with CPU-bound ones on other items. Items are handed between
+// stages by index and updated in place; an item whose stage throws skips the
+// remaining stages. Stage workers are dedicated threads rather than executor
+// tasks; each one holds a TaskScope, so parallel regions inside a stage run
+// serially on that worker instead of competing with the other stages.
+template <typename Item> class Pipeline
+{
+  public:
+    using Stage = std::function<void(Item&)>;
+
+    // capacity bounds the queue feeding this stage.
+    Pipeline& addStage(
+        std::string name,
+        Stage fn,
+        std::size_t workers = 1,
+        std::size_t capacity = 4
+    );
+
+    // Blocks until every item has left the last stage; results keep input order.
+    Vector<PipelineResult<Item>> run(Vector<Item> items);
+
+    // Statistics of the last run.
+    const PipelineStats& stats() const noexcept;
+
+  private:
+    struct StageSpec
+    {
+        std::string name;
+        Stage fn;
+        std::size_t workers;
+        std::size_t capacity;
+    };
+
+    Vector<StageSpec> stages_;
+    PipelineStats stats_;
+};
+} // namespace uv::execution
+
+#include "Base/Execution/Detail/Pipeline.inl"
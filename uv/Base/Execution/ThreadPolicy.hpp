@@ -4,5 +4,16 @@
 
 namespace uv::execution
 {
+// Resolves a thread request against the executor's concurrency: positive values
+// are clamped, negative values count back from it (-1 means all of them). Inside
+// an executor task the answer is always one, so nested parallel regions and
+// solvers with their own pools (Ceres) never oversubscribe the machine.
 int requestThreads(int);
+
+namespace detail
+{
+int hardwareThreads() noexcept;
+
+int resolveThreads(int numRequested, int numAvailable);
+} // namespace detail
 } // namespace uv::execution
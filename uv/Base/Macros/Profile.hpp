@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Utils/Profiler.hpp"
+
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+
+// Profiles the rest of the enclosing scope. Expands to nothing unless the build
+// defines UV_ENABLE_PROFILING.
+#if defined(UV_ENABLE_PROFILING)
+#define PROFILE_ZONE(name)                                                               \
+    const ::uv::utils::Zone PROFILE_CONCAT(uvProfileZone, __LINE__)                      \
+    {                                                                                    \
+        (name)                                                                           \
+    }
+#else
+#define PROFILE_ZONE(name) static_cast<void>(0)
+#endif
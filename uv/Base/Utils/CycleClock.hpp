@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Utils/Metrics.hpp"
+
+#include <cstdint>
+
+namespace uv::utils
+{
+// Time-stamp counter reads for timing short kernels. On x86-64 start() is a bare
+// rdtsc and stop() an rdtscp, which waits for the timed code to retire; elsewhere
+// both fall back to steady_clock nanoseconds. Assumes an invariant TSC, as on
+// every x86-64 CPU of the last decade.
+class CycleClock
+{
+  public:
+    static constexpr bool hasTsc() noexcept;
+
+    static std::uint64_t start() noexcept;
+
+    static std::uint64_t stop() noexcept;
+
+    // Measured once against steady_clock on first use; 1 without a TSC.
+    static double nsPerCycle();
+
+    static double toNs(std::uint64_t cycles);
+};
+
+// Records the cycles spent in its scope into a metrics histogram, which keeps
+// per-thread buckets, so sampling costs two counter reads and two stores.
+class CycleSampler
+{
+  public:
+    explicit CycleSampler(Histogram histogram) noexcept;
+    ~CycleSampler();
+
+    CycleSampler(const CycleSampler&) = delete;
+    CycleSampler& operator=(const CycleSampler&) = delete;
+
+  private:
+    Histogram histogram_;
+    std::uint64_t start_;
+};
+} // namespace uv::utils
+
+#include "Base/Utils/Detail/CycleClock.inl"
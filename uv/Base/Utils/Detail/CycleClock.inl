@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define UV_CYCLE_CLOCK_TSC 1
+#endif
+
+namespace uv::utils
+{
+constexpr bool CycleClock::hasTsc() noexcept
+{
+#if defined(UV_CYCLE_CLOCK_TSC)
+    return true;
+#else
+    return false;
+#endif
+}
+
+inline std::uint64_t CycleClock::start() noexcept
+{
+#if defined(UV_CYCLE_CLOCK_TSC)
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        )
+            .count()
+    );
+#endif
+}
+
+inline std::uint64_t CycleClock::stop() noexcept
+{
+#if defined(UV_CYCLE_CLOCK_TSC)
+    unsigned int aux{0};
+    return __rdtscp(&aux);
+#else
+    return start();
+#endif
+}
+
+inline CycleSampler::CycleSampler(Histogram histogram) noexcept
+    : histogram_(histogram),
+      start_(CycleClock::start())
+{
+}
+
+inline CycleSampler::~CycleSampler()
+{
+    const std::uint64_t end{CycleClock::stop()};
+
+    Metrics::observe(histogram_, (end > start_) ? end - start_ : 0);
+}
+} // namespace uv::utils
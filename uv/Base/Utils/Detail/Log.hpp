@@ -2,8 +2,18 @@
 
 #pragma once
 
+#include "Base/Utils/RingBuffer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
+#include <mutex>
+#include <string>
 #include <string_view>
+#include <thread>
 
 namespace uv::utils
 {
@@ -14,22 +24,73 @@ enum class Level
     Warn
 };
 
+// What log() does when the queue is full.
+enum class Overflow
+{
+    Block,
+    Drop
+};
+
+// Asynchronous logger. Producers stamp each message and push it to a lock-free
+// queue; a background writer formats the lines, writes them in batches and
+// flushes the log file at most once per flush interval.
 class Log
 {
   public:
+    static constexpr std::size_t queueCapacity{8192};
+
     static Log& instance();
 
+    Log(const Log&) = delete;
+    Log& operator=(const Log&) = delete;
+
+    ~Log();
+
     void setFile(std::string_view filename);
 
     void enableConsole(bool enabled) noexcept;
 
+    void setFlushInterval(std::chrono::milliseconds interval) noexcept;
+
+    void setOverflow(Overflow policy) noexcept;
+
     void log(Level lvl, std::string_view msg);
 
+    // Blocks until every message queued before the call is written and flushed.
+    void flush();
+
+    // Messages discarded under Overflow::Drop since start-up.
+    std::uint64_t dropped() const noexcept;
+
   private:
+    struct Record
+    {
+        std::chrono::system_clock::time_point time{};
+        Level level{Level::Info};
+        std::uint32_t thread{0};
+        bool console{false};
+        std::string msg{};
+    };
+
     Log();
 
+    void run(std::stop_token stop);
+    void write(std::string& console, std::string& file);
+    void sync(std::size_t written);
+    bool idle(std::size_t written, const std::stop_token& stop) const noexcept;
+
+    RingBuffer<Record> queue_{queueCapacity};
     std::ofstream file_;
-    bool fileEnabled_{false};
-    bool consoleEnabled_{true};
+    std::mutex fileMutex_;
+    std::mutex wakeMutex_;
+    std::condition_variable wake_;
+    std::condition_variable flushed_;
+    std::atomic<std::size_t> durable_{0};
+    std::atomic<std::size_t> flushTarget_{0};
+    std::atomic<std::int64_t> flushIntervalMs_{100};
+    std::atomic<Overflow> overflow_{Overflow::Block};
+    std::atomic<std::uint64_t> dropped_{0};
+    std::atomic<bool> consoleEnabled_{true};
+    std::jthread writer_;
 };
 } // namespace uv::utils
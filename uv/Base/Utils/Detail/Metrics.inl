@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <bit>
+
+namespace uv::utils
+{
+namespace detail
+{
+inline MetricsShard& localMetricsShard()
+{
+    MetricsShard* shard{metricsShard};
+
+    if (shard == nullptr) [[unlikely]]
+    {
+        shard = &registerMetricsShard();
+        metricsShard = shard;
+    }
+
+    return *shard;
+}
+
+// Only the owning thread writes a shard, so a plain load and store suffice.
+inline void bump(std::atomic<std::uint64_t>& value, std::uint64_t n) noexcept
+{
+    value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+constexpr std::size_t histogramBucket(std::uint64_t value) noexcept
+{
+    const auto bucket{
+        static_cast<std::size_t>((value <= 1) ? 0 : std::bit_width(value - 1))
+    };
+    return std::min(bucket, histogramBuckets - 1);
+}
+} // namespace detail
+
+inline void Metrics::add(Counter c, std::uint64_t n) noexcept
+{
+    detail::bump(detail::localMetricsShard().counters[static_cast<std::size_t>(c)], n);
+}
+
+inline void Metrics::observe(Histogram h, std::uint64_t value) noexcept
+{
+    detail::MetricsShard& shard{detail::localMetricsShard()};
+    const auto i{static_cast<std::size_t>(h)};
+
+    detail::bump(shard.buckets[i][detail::histogramBucket(value)], 1);
+    detail::bump(shard.sums[i], value);
+}
+} // namespace uv::utils
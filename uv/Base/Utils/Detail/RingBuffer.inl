@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <bit>
+#include <utility>
+
+namespace uv::utils
+{
+template <typename T>
+RingBuffer<T>::RingBuffer(std::size_t capacity)
+    : slots_(std::make_unique<Slot[]>(std::bit_ceil(capacity < 2 ? 2 : capacity))),
+      mask_(std::bit_ceil(capacity < 2 ? 2 : capacity) - 1)
+{
+    for (std::size_t i{0}; i <= mask_; ++i)
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+template <typename T> bool RingBuffer<T>::tryPush(T& value)
+{
+    std::size_t pos{tail_.load(std::memory_order_relaxed)};
+    Slot* slot{nullptr};
+
+    while (true)
+    {
+        slot = &slots_[pos & mask_];
+
+        const std::size_t seq{slot->sequence.load(std::memory_order_acquire)};
+        const auto lag{static_cast<std::ptrdiff_t>(seq - pos)};
+
+        if (lag == 0)
+        {
+            if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (lag < 0)
+        {
+            return false;
+        }
+        else
+        {
+            pos = tail_.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->value = std::move(value);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <typename T> bool RingBuffer<T>::tryPop(T& value)
+{
+    Slot& slot{slots_[head_ & mask_]};
+
+    if (slot.sequence.load(std::memory_order_acquire) != head_ + 1)
+        return false;
+
+    value = std::move(slot.value);
+    slot.sequence.store(head_ + mask_ + 1, std::memory_order_release);
+    ++head_;
+
+    return true;
+}
+
+template <typename T> std::size_t RingBuffer<T>::capacity() const noexcept
+{
+    return mask_ + 1;
+}
+
+template <typename T> std::size_t RingBuffer<T>::pushed() const noexcept
+{
+    return tail_.load(std::memory_order_acquire);
+}
+} // namespace uv::utils
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace uv::utils
+{
+// Work counters incremented by the numerical kernels.
+enum class Counter : std::size_t
+{
+    CharFunction,
+    CharFunctionCached,
+    Integrals,
+    QuadratureNodes,
+    ImpliedVolSolves,
+    NLoptObjective,
+    NLoptConstraint,
+    CeresResidual,
+    CeresJacobian
+};
+
+enum class Histogram : std::size_t
+{
+    QuadratureNodes,
+    CallPriceCycles,
+    ImpliedVolCycles
+};
+
+inline constexpr std::size_t numCounters{9};
+inline constexpr std::size_t numHistograms{3};
+
+// Bucket i counts values up to 2^i; the last bucket is unbounded.
+inline constexpr std::size_t histogramBuckets{33};
+
+struct HistogramSnapshot
+{
+    std::array<std::uint64_t, histogramBuckets> buckets{};
+    std::uint64_t count{0};
+    std::uint64_t sum{0};
+
+    double mean() const noexcept;
+
+    // Upper bound of the bucket holding the q-quantile.
+    std::uint64_t quantile(double q) const noexcept;
+};
+
+struct MetricsSnapshot
+{
+    std::array<std::uint64_t, numCounters> counters{};
+    std::array<HistogramSnapshot, numHistograms> histograms{};
+    double nsPerCycle{0.0};
+
+    std::uint64_t operator[](Counter c) const noexcept;
+
+    const HistogramSnapshot& operator[](Histogram h) const noexcept;
+
+    // Work done between an earlier snapshot and this one.
+    MetricsSnapshot operator-(const MetricsSnapshot& earlier) const noexcept;
+};
+
+// Process-wide counters. Each thread increments its own shard with relaxed
+// stores, so the hot path never contends; snapshots sum over the shards.
+class Metrics
+{
+  public:
+    static void add(Counter c, std::uint64_t n = 1) noexcept;
+
+    static void observe(Histogram h, std::uint64_t value) noexcept;
+
+    static MetricsSnapshot snapshot();
+
+    // Increments racing with a reset may be lost.
+    static void reset();
+
+    // Prometheus text exposition format.
+    static std::string prometheus(const MetricsSnapshot& snapshot);
+
+    static void writePrometheus(const std::filesystem::path& path);
+};
+
+std::string_view toString(Counter c) noexcept;
+
+std::string_view toString(Histogram h) noexcept;
+
+namespace detail
+{
+struct MetricsShard
+{
+    std::array<std::atomic<std::uint64_t>, numCounters> counters{};
+    std::array<std::array<std::atomic<std::uint64_t>, histogramBuckets>, numHistograms>
+        buckets{};
+    std::array<std::atomic<std::uint64_t>, numHistograms> sums{};
+};
+
+MetricsShard& registerMetricsShard();
+
+inline thread_local MetricsShard* metricsShard{nullptr};
+} // namespace detail
+} // namespace uv::utils
+
+#include "Base/Utils/Detail/Metrics.inl"
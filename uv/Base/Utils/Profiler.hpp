@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Types.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace uv::utils
+{
+// One closed zone. Paths identify the chain of enclosing zones on the thread.
+struct ZoneEvent
+{
+    const char* name{nullptr};
+    std::uint64_t path{0};
+    std::uint64_t parent{0};
+    std::uint32_t depth{0};
+    std::uint32_t thread{0};
+    std::int64_t startNs{0};
+    std::int64_t durationNs{0};
+};
+
+// Aggregate over every event sharing a zone path, in milliseconds.
+struct ZoneStats
+{
+    std::string path;
+    std::string name;
+    std::uint32_t depth{0};
+    std::size_t count{0};
+    double totalMs{0.0};
+    double minMs{0.0};
+    double meanMs{0.0};
+    double p99Ms{0.0};
+    double maxMs{0.0};
+};
+
+// Collects zone events in per-thread buffers. Recording only touches the calling
+// thread's buffer; aggregation and export take a consistent copy.
+class Profiler
+{
+  public:
+    static Profiler& instance();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    // True when PROFILE_ZONE records zones in this build.
+    static constexpr bool enabled() noexcept
+    {
+#if defined(UV_ENABLE_PROFILING)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void record(const ZoneEvent& event);
+
+    void reset();
+
+    std::int64_t nowNs() const noexcept;
+
+    Vector<ZoneEvent> events() const;
+
+    // One row per zone path, parents before their children.
+    Vector<ZoneStats> summary() const;
+
+    std::string summaryTable() const;
+
+    // Trace-event JSON loadable in chrome://tracing or Perfetto.
+    std::string chromeTrace() const;
+
+    void writeChromeTrace(const std::filesystem::path& path) const;
+
+  private:
+    struct ThreadBuffer
+    {
+        std::mutex mutex;
+        Vector<ZoneEvent> events;
+        std::uint32_t thread{0};
+    };
+
+    Profiler();
+
+    std::shared_ptr<ThreadBuffer> registerThread();
+    ThreadBuffer& localBuffer();
+
+    mutable std::mutex mutex_;
+    Vector<std::shared_ptr<ThreadBuffer>> buffers_;
+    std::chrono::steady_clock::time_point epoch_;
+};
+
+// Times its own lifetime as a zone nested in the enclosing zone of the thread.
+// The name must outlive the profiler, e.g. a string literal.
+class Zone
+{
+  public:
+    explicit Zone(const char* name) noexcept;
+    ~Zone();
+
+    Zone(const Zone&) = delete;
+    Zone& operator=(const Zone&) = delete;
+
+  private:
+    const char* name_;
+    std::uint64_t parent_;
+    std::uint64_t path_;
+    std::uint32_t depth_;
+    std::int64_t startNs_;
+};
+} // namespace uv::utils
@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace uv::utils
+{
+// Bounded lock-free queue for many producers and a single consumer. Each slot
+// carries a sequence number telling producers when it is free and the consumer
+// when it is published, so pushes only contend on the tail counter.
+template <typename T> class RingBuffer
+{
+  public:
+    // Capacity is rounded up to a power of two.
+    explicit RingBuffer(std::size_t capacity);
+
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    // Moves from value only on success; returns false when the buffer is full.
+    bool tryPush(T& value);
+
+    // Single consumer only.
+    bool tryPop(T& value);
+
+    std::size_t capacity() const noexcept;
+
+    // Number of successful pushes so far.
+    std::size_t pushed() const noexcept;
+
+  private:
+    struct Slot
+    {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    std::size_t mask_;
+    alignas(64) std::atomic<std::size_t> tail_{0};
+    alignas(64) std::size_t head_{0};
+};
+} // namespace uv::utils
+
+#include "Base/Utils/Detail/RingBuffer.inl"
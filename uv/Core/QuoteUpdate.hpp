@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+
+namespace uv::core
+{
+// A new implied vol for one node of a maturity x moneyness surface. Updates that
+// share a sequence number arrived together and are applied as one batch.
+template <std::floating_point T> struct QuoteUpdate
+{
+    std::uint64_t seq;
+    T maturity;
+    T moneyness;
+    T vol;
+};
+} // namespace uv::core
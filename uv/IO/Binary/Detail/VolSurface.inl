@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Errors/Errors.hpp"
+#include "Base/Macros/Profile.hpp"
+#include "Base/Macros/Require.hpp"
+#include "Core/Matrix.hpp"
+
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <span>
+
+namespace uv::io::binary
+{
+namespace detail
+{
+template <typename T> void writeSpan(std::ofstream& file, std::span<const T> values)
+{
+    file.write(
+        reinterpret_cast<const char*>(values.data()),
+        static_cast<std::streamsize>(values.size_bytes())
+    );
+}
+
+template <typename T> void readSpan(std::ifstream& file, std::span<T> values)
+{
+    file.read(
+        reinterpret_cast<char*>(values.data()),
+        static_cast<std::streamsize>(values.size_bytes())
+    );
+}
+} // namespace detail
+
+template <std::floating_point T>
+void write(const std::filesystem::path& path, const core::VolSurface<T>& surface)
+{
+    PROFILE_ZONE("binary::write");
+
+    const VolSurfaceHeader header{
+        .scalarSize = sizeof(T),
+        .numMaturities = surface.numMaturities(),
+        .numStrikes = surface.numStrikes()
+    };
+
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    REQUIRE_FILE_OPENED(file.is_open(), path.string());
+
+    detail::writeSpan(file, std::span<const VolSurfaceHeader>{&header, 1});
+    detail::writeSpan(file, surface.maturities());
+    detail::writeSpan(file, surface.forwards());
+    detail::writeSpan(file, surface.strikes());
+    detail::writeSpan(file, surface.moneyness());
+
+    for (std::size_t i{0}; i < surface.numMaturities(); ++i)
+        detail::writeSpan(file, surface.vol()[i]);
+
+    if (!file)
+    {
+        errors::raise(
+            errors::ErrorCode::FileIO,
+            std::format("Failed to write {}", path.string())
+        );
+    }
+}
+
+template <std::floating_point T>
+core::VolSurface<T> readVolSurface(const std::filesystem::path& path)
+{
+    PROFILE_ZONE("binary::read");
+
+    std::ifstream file{path, std::ios::binary};
+    REQUIRE_FILE_OPENED(file.is_open(), path.string());
+
+    VolSurfaceHeader header{};
+    const VolSurfaceHeader expected{};
+    detail::readSpan(file, std::span<VolSurfaceHeader>{&header, 1});
+
+    if (!file || header.magic != expected.magic || header.version != expected.version)
+    {
+        errors::raise(
+            errors::ErrorCode::DataFormat,
+            std::format("{} is not a UnifiedVol surface file", path.string())
+        );
+    }
+
+    if (header.scalarSize != sizeof(T))
+    {
+        errors::raise(
+            errors::ErrorCode::DataFormat,
+            std::format(
+                "{} stores {}-byte scalars, expected {}",
+                path.string(),
+                header.scalarSize,
+                sizeof(T)
+            )
+        );
+    }
+
+    const auto numMaturities{static_cast<std::size_t>(header.numMaturities)};
+    const auto numStrikes{static_cast<std::size_t>(header.numStrikes)};
+
+    // Check the payload size before allocating so a corrupt header cannot request
+    // an arbitrarily large surface.
+    const std::uintmax_t payload{
+        std::filesystem::file_size(path) - sizeof(VolSurfaceHeader)
+    };
+    const std::uintmax_t count{payload / sizeof(T)};
+
+    if (numMaturities > count || numStrikes > count ||
+        payload != (2 * (numMaturities + numStrikes) + numMaturities * numStrikes) *
+                       sizeof(T))
+    {
+        errors::raise(
+            errors::ErrorCode::DataFormat,
+            std::format(
+                "{} does not match its {} x {} header",
+                path.string(),
+                numMaturities,
+                numStrikes
+            )
+        );
+    }
+
+    Vector<T> maturities(numMaturities);
+    Vector<T> forwards(numMaturities);
+    Vector<T> strikes(numStrikes);
+    Vector<T> moneyness(numStrikes);
+    core::Matrix<T> vol(numMaturities, numStrikes);
+
+    detail::readSpan(file, std::span<T>{maturities});
+    detail::readSpan(file, std::span<T>{forwards});
+    detail::readSpan(file, std::span<T>{strikes});
+    detail::readSpan(file, std::span<T>{moneyness});
+
+    for (std::size_t i{0}; i < numMaturities; ++i)
+        detail::readSpan(file, vol[i]);
+
+    if (!file)
+    {
+        errors::raise(
+            errors::ErrorCode::FileIO,
+            std::format("Failed to read {}", path.string())
+        );
+    }
+
+    return core::VolSurface<T>{maturities, forwards, strikes, moneyness, vol};
+}
+
+} // namespace uv::io::binary
@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/VolSurface.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <filesystem>
+
+namespace uv::io::binary
+{
+// File layout, native byte order: a fixed header followed by the maturities,
+// forwards, strikes and moneyness axes and the row-major vol matrix, all stored
+// as T.
+struct VolSurfaceHeader
+{
+    std::array<char, 4> magic{'U', 'V', 'S', 'F'};
+    std::uint32_t version{1};
+    std::uint32_t scalarSize{};
+    std::uint32_t reserved{};
+    std::uint64_t numMaturities{};
+    std::uint64_t numStrikes{};
+};
+
+template <std::floating_point T>
+void write(const std::filesystem::path& path, const core::VolSurface<T>& surface);
+
+template <std::floating_point T>
+core::VolSurface<T> readVolSurface(const std::filesystem::path& path);
+} // namespace uv::io::binary
+
+#include "IO/Binary/Detail/VolSurface.inl"
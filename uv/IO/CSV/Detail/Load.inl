@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
+#include "Base/Macros/Profile.hpp"
 #include "Core/Generate.hpp"
+#include "Math/PDE/DeAmericanize.hpp"
 
 namespace uv::io::csv::load
 {
@@ -11,10 +13,41 @@ template <std::floating_point T> core::MarketState<T> marketState(
     const detail::Options& opt
 )
 {
+    PROFILE_ZONE("csv::load");
+
     auto [maturities, moneyness, vol] =
         detail::readLabeledMatrixCsv<T>(path.string(), opt);
 
     return ::uv::core::generateMarketState<T>(marketData, maturities, moneyness, vol);
 }
 
+template <std::floating_point T> core::MarketState<T> marketStateFromAmericanPrices(
+    const std::filesystem::path& path,
+    const core::MarketData<T>& marketData,
+    const math::pde::DeAmericanizeConfig<T>& config,
+    const detail::Options& opt
+)
+{
+    PROFILE_ZONE("csv::loadAmerican");
+
+    auto [maturities, moneyness, prices] =
+        detail::readLabeledMatrixCsv<T>(path.string(), opt);
+
+    const Vector<T> strikes{
+        ::uv::core::detail::generateStrikes<T>(marketData.spot, moneyness)
+    };
+
+    const core::Matrix<T> vol{math::pde::deAmericanize<T>(
+        prices,
+        maturities,
+        strikes,
+        marketData.interestRate,
+        marketData.dividendYield,
+        marketData.spot,
+        config
+    )};
+
+    return ::uv::core::generateMarketState<T>(marketData, maturities, moneyness, vol);
+}
+
 } // namespace uv::io::csv::load
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Errors/Errors.hpp"
+#include "Base/Macros/Profile.hpp"
+#include "Base/Macros/Require.hpp"
+
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace uv::io::csv::write
+{
+
+template <std::floating_point T>
+void volSurface(const std::filesystem::path& path, const core::VolSurface<T>& surface)
+{
+    PROFILE_ZONE("csv::write");
+
+    std::string text;
+    auto out{std::back_inserter(text)};
+
+    for (const T m : surface.moneyness())
+        std::format_to(out, ",{}", m);
+    text += '\n';
+
+    const std::span<const T> maturities{surface.maturities()};
+
+    for (std::size_t i{0}; i < maturities.size(); ++i)
+    {
+        std::format_to(out, "{}", maturities[i]);
+
+        for (const T v : surface.vol()[i])
+            std::format_to(out, ",{}", v);
+        text += '\n';
+    }
+
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    REQUIRE_FILE_OPENED(file.is_open(), path.string());
+
+    file.write(text.data(), static_cast<std::streamsize>(text.size()));
+
+    if (!file)
+    {
+        errors::raise(
+            errors::ErrorCode::FileIO,
+            std::format("Failed to write {}", path.string())
+        );
+    }
+}
+
+} // namespace uv::io::csv::write
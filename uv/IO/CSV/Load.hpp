@@ -5,6 +5,7 @@
 #include "Core/MarketData.hpp"
 #include "Core/MarketState.hpp"
 #include "IO/CSV/Detail/Read.hpp"
+#include "Math/PDE/Config.hpp"
 
 #include <concepts>
 #include <filesystem>
@@ -18,6 +19,15 @@ template <std::floating_point T> core::MarketState<T> marketState(
     const core::MarketData<T>& marketData,
     const Options& opt = {}
 );
+
+// Reads out-of-the-money American premiums on the same maturity x moneyness layout
+// and de-Americanizes them into a European vol surface.
+template <std::floating_point T> core::MarketState<T> marketStateFromAmericanPrices(
+    const std::filesystem::path& path,
+    const core::MarketData<T>& marketData,
+    const math::pde::DeAmericanizeConfig<T>& config = {},
+    const Options& opt = {}
+);
 } // namespace uv::io::csv::load
 
 #include "IO/CSV/Detail/Load.inl"
@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Types.hpp"
+#include "Core/MarketData.hpp"
+
+#include <filesystem>
+#include <string>
+
+namespace uv::io::csv
+{
+// One underlying in a batch manifest: the surface file and its market data.
+struct ManifestEntry
+{
+    std::string name;
+    std::filesystem::path file;
+    core::MarketData<double> marketData;
+};
+
+// Reads a manifest with the header "name,file,spot,rate,dividendYield". Blank
+// lines and lines starting with '#' are skipped, and relative file paths are
+// resolved against the manifest's directory.
+Vector<ManifestEntry> readManifest(const std::filesystem::path& path);
+} // namespace uv::io::csv
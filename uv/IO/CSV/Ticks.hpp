@@ -0,0 +1,16 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Types.hpp"
+#include "Core/QuoteUpdate.hpp"
+
+#include <filesystem>
+
+namespace uv::io::csv
+{
+// Reads a recorded tick file with the header "seq,maturity,moneyness,vol". Blank
+// lines and lines starting with '#' are skipped, and sequence numbers must not
+// decrease so that consecutive rows with the same number form one update.
+Vector<core::QuoteUpdate<double>> readTicks(const std::filesystem::path& path);
+} // namespace uv::io::csv
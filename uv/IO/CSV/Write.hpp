@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/VolSurface.hpp"
+
+#include <concepts>
+#include <filesystem>
+
+namespace uv::io::csv::write
+{
+// Writes the surface in the maturity x moneyness layout read by load::marketState,
+// with values printed at full round-trip precision.
+template <std::floating_point T>
+void volSurface(const std::filesystem::path& path, const core::VolSurface<T>& surface);
+} // namespace uv::io::csv::write
+
+#include "IO/CSV/Detail/Write.inl"
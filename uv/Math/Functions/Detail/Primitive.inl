@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <complex>
+#include <limits>
 #include <numbers>
 
 namespace uv::math
@@ -69,4 +70,77 @@ template <std::floating_point T> T normalPDF(T x) noexcept
     constexpr T invSqrt2Pi = std::numbers::inv_sqrtpi_v<T> / std::numbers::sqrt2_v<T>;
     return invSqrt2Pi * std::exp(-T{0.5} * x * x);
 }
-} // namespace uv::math
\ No newline at end of file
+
+// Acklam's rational approximation polished by one Halley step against erfc.
+template <std::floating_point T> T normalInvCDF(T p) noexcept
+{
+    constexpr T a[]{
+        T{-3.969683028665376e+01},
+        T{2.209460984245205e+02},
+        T{-2.759285104469687e+02},
+        T{1.383577518672690e+02},
+        T{-3.066479806614716e+01},
+        T{2.506628277459239e+00}
+    };
+    constexpr T b[]{
+        T{-5.447609879822406e+01},
+        T{1.615858368580409e+02},
+        T{-1.556989798598866e+02},
+        T{6.680131188771972e+01},
+        T{-1.328068155288572e+01}
+    };
+    constexpr T c[]{
+        T{-7.784894002430293e-03},
+        T{-3.223964580411365e-01},
+        T{-2.400758277161838e+00},
+        T{-2.549732539343734e+00},
+        T{4.374664141464968e+00},
+        T{2.938163982698783e+00}
+    };
+    constexpr T d[]{
+        T{7.784695709041462e-03},
+        T{3.224671290700398e-01},
+        T{2.445134137142996e+00},
+        T{3.754408661907416e+00}
+    };
+    constexpr T pLow{0.02425};
+    constexpr T sqrt2Pi{std::numbers::sqrt2_v<T> / std::numbers::inv_sqrtpi_v<T>};
+
+    if (!(p > T{0}))
+        return -std::numeric_limits<T>::infinity();
+    if (!(p < T{1}))
+        return std::numeric_limits<T>::infinity();
+
+    const auto tail = [&](T u)
+    {
+        const T q{std::sqrt(T{-2} * std::log(u))};
+
+        return (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+               ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + T{1});
+    };
+
+    T x;
+
+    if (p < pLow)
+    {
+        x = tail(p);
+    }
+    else if (p > T{1} - pLow)
+    {
+        x = -tail(T{1} - p);
+    }
+    else
+    {
+        const T q{p - T{0.5}};
+        const T r{q * q};
+
+        x = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+            (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + T{1});
+    }
+
+    const T error{normalCDF(x) - p};
+    const T u{error * sqrt2Pi * std::exp(T{0.5} * x * x)};
+
+    return x - u / (T{1} + T{0.5} * x * u);
+}
+} // namespace uv::math
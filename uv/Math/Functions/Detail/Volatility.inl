@@ -2,6 +2,7 @@
 
 #include "Base/Macros/Require.hpp"
 #include "Base/Types.hpp"
+#include "Base/Utils/CycleClock.hpp"
 #include "Core/Curve.hpp"
 #include "Core/Matrix.hpp"
 #include "Core/VolSurface.hpp"
@@ -11,6 +12,7 @@
 #include <cmath>
 #include <cstddef>
 #include <span>
+#include <utility>
 
 namespace uv::math::vol::detail
 {
@@ -142,17 +144,14 @@ template <std::floating_point T> void volFromTotalVariance(
         REQUIRE_NON_NEGATIVE(totalVariance);
     }
 
-    const T invT{1.0 / t};
-    const Vector<T> variancePerUnitTime{
-        math::linear_algebra::multiply<T>(totalVariance, invT)
-    };
-
-    math::linear_algebra::squareRootInplace<T>(out, variancePerUnitTime);
+    math::linear_algebra::scaledSquareRoot<T>(out, totalVariance, T{1} / t);
 }
 
+// Takes the matrix by value and converts it row by row in place, so passing a
+// temporary allocates nothing.
 template <std::floating_point T> core::Matrix<T> volFromTotalVariance(
     const std::span<const T> t,
-    const core::Matrix<T>& totalVariance,
+    core::Matrix<T> totalVariance,
     bool doValidate
 )
 {
@@ -160,14 +159,13 @@ template <std::floating_point T> core::Matrix<T> volFromTotalVariance(
 
     const std::size_t n{t.size()};
 
-    core::Matrix<T> out(n, totalVariance.cols());
-
     for (std::size_t i{0}; i < n; ++i)
     {
-        volFromTotalVariance(out[i], t[i], totalVariance[i], doValidate);
+        const std::span<T> row{totalVariance[i]};
+        volFromTotalVariance<T>(row, t[i], row, doValidate);
     }
 
-    return out;
+    return totalVariance;
 }
 
 template <std::floating_point T> T variance(T vol, bool doValidate)
@@ -234,6 +232,8 @@ T atmParameter(std::span<const T> parameters, std::span<const T> logKF, bool doV
 template <std::floating_point T>
 T impliedVol(T callPrice, T t, T dF, T F, T K, bool doValidate)
 {
+    const utils::CycleSampler sampler{utils::Histogram::ImpliedVolCycles};
+
     if (doValidate)
     {
         REQUIRE_FINITE(callPrice);
@@ -285,7 +285,7 @@ template <std::floating_point T> void impliedVol(
 }
 
 template <std::floating_point T> core::Matrix<T> impliedVol(
-    const core::Matrix<T>& callPrices,
+    core::Matrix<T> callPrices,
     std::span<const T> maturities,
     std::span<const T> discountFactors,
     std::span<const T> forwards,
@@ -306,13 +306,14 @@ template <std::floating_point T> core::Matrix<T> impliedVol(
 
     std::size_t numMaturities{maturities.size()};
 
-    core::Matrix<T> out{numMaturities, strikes.size()};
-
+    // Each row of prices is overwritten by its vols.
     for (std::size_t i{0}; i < numMaturities; ++i)
     {
-        impliedVol(
-            out[i],
-            callPrices[i],
+        const std::span<T> row{callPrices[i]};
+
+        impliedVol<T>(
+            row,
+            row,
             maturities[i],
             discountFactors[i],
             forwards[i],
@@ -321,11 +322,11 @@ template <std::floating_point T> core::Matrix<T> impliedVol(
         );
     }
 
-    return out;
+    return callPrices;
 }
 
 template <std::floating_point T> core::Matrix<T> impliedVol(
-    const core::Matrix<T>& callPrices,
+    core::Matrix<T> callPrices,
     const core::VolSurface<T>& volSurface,
     const core::Curve<T>& curve,
     bool doValidate
@@ -336,7 +337,7 @@ template <std::floating_point T> core::Matrix<T> impliedVol(
     const Vector<T> discountFactors{curve.interpolateDF(maturities)};
 
     return impliedVol<T>(
-        callPrices,
+        std::move(callPrices),
         maturities,
         discountFactors,
         volSurface.forwards(),
@@ -22,6 +22,8 @@ template <std::floating_point T>
 template <std::floating_point T> T normalCDF(T) noexcept;
 
 template <std::floating_point T> T normalPDF(T) noexcept;
+
+template <std::floating_point T> T normalInvCDF(T) noexcept;
 } // namespace uv::math
 
 #include "Math/Functions/Detail/Primitive.inl"
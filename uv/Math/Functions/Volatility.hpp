@@ -37,7 +37,7 @@ template <std::floating_point T> void volFromTotalVariance(
 
 template <std::floating_point T> core::Matrix<T> volFromTotalVariance(
     const std::span<const T> t,
-    const core::Matrix<T>& totalVariance,
+    core::Matrix<T> totalVariance,
     bool doValidate = true
 );
 
@@ -69,7 +69,7 @@ template <std::floating_point T> void impliedVol(
 );
 
 template <std::floating_point T> core::Matrix<T> impliedVol(
-    const core::Matrix<T>& callPrices,
+    core::Matrix<T> callPrices,
     std::span<const T> maturities,
     std::span<const T> discountFactors,
     std::span<const T> forwards,
@@ -78,7 +78,7 @@ template <std::floating_point T> core::Matrix<T> impliedVol(
 );
 
 template <std::floating_point T> core::Matrix<T> impliedVol(
-    const core::Matrix<T>& callPrices,
+    core::Matrix<T> callPrices,
     const core::VolSurface<T>& volSurface,
     const core::Curve<T>& curve,
     bool doValidate = true
@@ -1,15 +1,28 @@
 ﻿// SPDX-License-Identifier: Apache-2.0
 
+#include "Base/Utils/Metrics.hpp"
+
 #include <boost/math/special_functions/lambert_w.hpp>
 
 #include <bitset>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <numbers>
 #include <utility>
 
 namespace uv::math::integration
 {
+namespace detail
+{
+inline void recordIntegral(std::uint64_t nodes) noexcept
+{
+    utils::Metrics::add(utils::Counter::Integrals);
+    utils::Metrics::add(utils::Counter::QuadratureNodes, nodes);
+    utils::Metrics::observe(utils::Histogram::QuadratureNodes, nodes);
+}
+} // namespace detail
+
 template <std::floating_point T, std::size_t N> TanHSinH<T, N>::TanHSinH()
     : h_(
 
@@ -52,6 +65,7 @@ std::array<T, M> TanHSinH<T, N>::integrateZeroToInfMulti( // NOSONAR
     actL1.set();
 
     auto&& func = std::forward<F>(f);
+    std::uint64_t nodes{0};
 
     for (std::size_t i = 0; i + 1 < N; i += 2)
     {
@@ -70,12 +84,14 @@ std::array<T, M> TanHSinH<T, N>::integrateZeroToInfMulti( // NOSONAR
             const Node& a{nodes_[i]};
             ta = func(a.inputRight);
             fa = a.factorRight;
+            ++nodes;
         };
         if (anyB)
         {
             const Node& b{nodes_[i + 1]};
             tb = func(b.inputRight);
             fb = b.factorRight;
+            ++nodes;
         };
 
         for (std::size_t m = 0; m < M; ++m)
@@ -118,12 +134,14 @@ std::array<T, M> TanHSinH<T, N>::integrateZeroToInfMulti( // NOSONAR
             const Node& a{nodes_[i]};
             ta = func(a.inputLeft);
             fa = a.factorLeft;
+            ++nodes;
         };
         if (anyB)
         {
             const Node& b{nodes_[i + 1]};
             tb = func(b.inputLeft);
             fb = b.factorLeft;
+            ++nodes;
         };
 
         for (std::size_t m = 0; m < M; ++m)
@@ -149,6 +167,8 @@ std::array<T, M> TanHSinH<T, N>::integrateZeroToInfMulti( // NOSONAR
         }
     }
 
+    detail::recordIntegral(nodes);
+
     std::array<T, M> out{};
     for (std::size_t m = 0; m < M; ++m)
         out[m] = sR0[m] + sR1[m] + sL0[m] + sL1[m];
@@ -167,6 +187,7 @@ T TanHSinH<T, N>::integrateZeroToInf(F&& f) const noexcept
     T sL1{T(0.0)};
 
     auto&& func = std::forward<F>(f);
+    std::uint64_t nodes{0};
 
     // NOSONAR -- Paired early exits are the quadrature convergence policy.
     for (std::size_t i = 0; i + 1 < N; i += 2) // NOSONAR
@@ -176,6 +197,7 @@ T TanHSinH<T, N>::integrateZeroToInf(F&& f) const noexcept
         const Node& b{nodes_[i + 1]};
 
         const T ta{a.factorRight * func(a.inputRight)};
+        ++nodes;
 
         if (std::fabs(ta) <= std::fabs(sR0 * eps))
             break;
@@ -183,6 +205,7 @@ T TanHSinH<T, N>::integrateZeroToInf(F&& f) const noexcept
         sR0 += ta;
 
         const T tb{b.factorRight * func(b.inputRight)};
+        ++nodes;
 
         if (std::fabs(tb) <= std::fabs(sR1 * eps))
             break;
@@ -196,6 +219,7 @@ T TanHSinH<T, N>::integrateZeroToInf(F&& f) const noexcept
         const Node& b{nodes_[i + 1]};
 
         const T ta{a.factorLeft * func(a.inputLeft)};
+        ++nodes;
 
         if (std::fabs(ta) <= std::fabs(sL0 * eps))
             break;
@@ -203,6 +227,7 @@ T TanHSinH<T, N>::integrateZeroToInf(F&& f) const noexcept
         sL0 += ta;
 
         const T tb{b.factorLeft * func(b.inputLeft)};
+        ++nodes;
 
         if (std::fabs(tb) <= std::fabs(sL1 * eps))
             break;
@@ -210,6 +235,8 @@ T TanHSinH<T, N>::integrateZeroToInf(F&& f) const noexcept
         sL1 += tb;
     }
 
+    detail::recordIntegral(nodes);
+
     return sR0 + sR1 + sL0 + sL1;
 }
 
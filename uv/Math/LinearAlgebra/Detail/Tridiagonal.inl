@@ -1,8 +1,105 @@
 // SPDX-License-Identifier: Apache-2.0
 
+#include "Base/Execution/Parallel.hpp"
+#include "Base/Macros/Require.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace uv::math::linear_algebra::detail
+{
+inline constexpr std::size_t minPartitionBlockSize{4096};
+
+template <std::floating_point T> void thomasSweep(
+    std::span<T> x,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower,
+    std::span<T> scratch
+) noexcept;
+
+template <std::floating_point T> void spikeSweep(
+    std::span<T> x,
+    std::span<T> left,
+    std::span<T> right,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower,
+    std::span<T> scratch,
+    T leftCoupling,
+    T rightCoupling
+) noexcept;
+
+template <std::floating_point T> void validateSystem(
+    std::span<const T> x,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower
+);
+
+inline std::size_t
+partitionBlockBegin(std::size_t block, std::size_t n, std::size_t numBlocks);
+template <std::floating_point T> std::size_t validateInterleaved(
+    std::span<const T> x,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower,
+    std::size_t batch
+);
+} // namespace uv::math::linear_algebra::detail
+
 namespace uv::math::linear_algebra
 {
-template <std::floating_point T, std::size_t N> void thomasSolve(
+template <std::floating_point T>
+TridiagonalWorkspace<T>::TridiagonalWorkspace(std::size_t n, std::size_t numBlocks)
+{
+    reserve(n, numBlocks);
+}
+
+template <std::floating_point T>
+void TridiagonalWorkspace<T>::reserve(std::size_t n, std::size_t numBlocks)
+{
+    scratch_.resize(std::max(scratch_.size(), n));
+
+    if (numBlocks > 1)
+    {
+        leftSpike_.resize(std::max(leftSpike_.size(), n));
+        rightSpike_.resize(std::max(rightSpike_.size(), n));
+        reduced_.resize(std::max(reduced_.size(), 5 * numBlocks));
+    }
+}
+
+template <std::floating_point T>
+std::span<T> TridiagonalWorkspace<T>::scratch(std::size_t n)
+{
+    scratch_.resize(std::max(scratch_.size(), n));
+    return std::span<T>{scratch_}.first(n);
+}
+
+template <std::floating_point T>
+std::span<T> TridiagonalWorkspace<T>::leftSpike(std::size_t n)
+{
+    leftSpike_.resize(std::max(leftSpike_.size(), n));
+    return std::span<T>{leftSpike_}.first(n);
+}
+
+template <std::floating_point T>
+std::span<T> TridiagonalWorkspace<T>::rightSpike(std::size_t n)
+{
+    rightSpike_.resize(std::max(rightSpike_.size(), n));
+    return std::span<T>{rightSpike_}.first(n);
+}
+
+template <std::floating_point T>
+std::span<T> TridiagonalWorkspace<T>::reduced(std::size_t n)
+{
+    reduced_.resize(std::max(reduced_.size(), n));
+    return std::span<T>{reduced_}.first(n);
+}
+
+template <std::floating_point T, std::size_t N>
+requires(N != std::dynamic_extent)
+void thomasSolve(
     std::span<T, N> x,
     std::span<const T, N> upper,
     std::span<const T, N> middle,
@@ -38,4 +135,670 @@ template <std::floating_point T, std::size_t N> void thomasSolve(
     }
 }
 
+template <std::floating_point T> void thomasSolve(
+    std::span<T> x,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower,
+    std::span<T> scratch,
+    bool doValidate
+)
+{
+    if (doValidate)
+    {
+        detail::validateSystem<T>(x, upper, middle, lower);
+        REQUIRE_SAME_SIZE(scratch, x);
+    }
+
+    detail::thomasSweep<T>(x, upper, middle, lower, scratch);
+}
+
+template <std::floating_point T> void thomasSolve(
+    std::span<T> x,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower,
+    TridiagonalWorkspace<T>& workspace,
+    bool doValidate
+)
+{
+    thomasSolve<T>(x, upper, middle, lower, workspace.scratch(x.size()), doValidate);
+}
+
+template <std::floating_point T> void brennanSchwartzSolve(
+    std::span<T> x,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower,
+    std::span<const T> obstacle,
+    std::span<T> scratch,
+    bool doValidate
+)
+{
+    if (doValidate)
+    {
+        detail::validateSystem<T>(x, upper, middle, lower);
+        REQUIRE_SAME_SIZE(obstacle, x);
+        REQUIRE_SAME_SIZE(scratch, x);
+    }
+
+    const std::size_t n{x.size()};
+    const std::size_t last{n - 1};
+
+    const T middleInv{T{1} / middle[0]};
+
+    scratch[0] = upper[0] * middleInv;
+    x[0] *= middleInv;
+
+    for (std::size_t i{1}; i < n; ++i)
+    {
+        const std::size_t previous{i - 1};
+        const T lowerI{lower[i]};
+        const T invDenom{T{1} / (middle[i] - lowerI * scratch[previous])};
+
+        scratch[i] = (i < last) ? upper[i] * invDenom : T{0};
+        x[i] = (x[i] - lowerI * x[previous]) * invDenom;
+    }
+
+    x[last] = std::max(x[last], obstacle[last]);
+
+    for (std::size_t i{last}; i-- > 0;)
+    {
+        x[i] = std::max(x[i] - scratch[i] * x[i + 1], obstacle[i]);
+    }
+}
+
+template <std::floating_point T> void partitionSolve(
+    std::span<T> x,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower,
+    TridiagonalWorkspace<T>& workspace,
+    std::size_t numBlocks,
+    int numThreads,
+    bool doValidate
+)
+{
+    if (doValidate)
+    {
+        detail::validateSystem<T>(x, upper, middle, lower);
+    }
+
+    const std::size_t n{x.size()};
+
+    if (numBlocks == 0)
+    {
+        numBlocks = std::min(
+            static_cast<std::size_t>(execution::requestThreads(numThreads)),
+            n / detail::minPartitionBlockSize
+        );
+    }
+    numBlocks = std::min(numBlocks, (n + 1) / 3);
+
+    if (numBlocks < 2)
+    {
+        thomasSolve<T>(x, upper, middle, lower, workspace, false);
+        return;
+    }
+
+    const std::size_t numSeparators{numBlocks - 1};
+
+    const std::span<T> scratch{workspace.scratch(n)};
+    const std::span<T> left{workspace.leftSpike(n)};
+    const std::span<T> right{workspace.rightSpike(n)};
+    const std::span<T> reduced{workspace.reduced(5 * numSeparators)};
+
+    const auto blockRange = [&](std::size_t block)
+    {
+        const std::size_t first{detail::partitionBlockBegin(block, n, numBlocks)};
+        const std::size_t last{
+            (block + 1 < numBlocks)
+                ? detail::partitionBlockBegin(block + 1, n, numBlocks) - 1
+                : n
+        };
+        return std::pair{first, last - first};
+    };
+
+    execution::parallelFor(
+        0,
+        numBlocks,
+        [&](std::size_t block)
+        {
+            const auto [first, size] = blockRange(block);
+
+            detail::spikeSweep<T>(
+                x.subspan(first, size),
+                left.subspan(first, size),
+                right.subspan(first, size),
+                upper.subspan(first, size),
+                middle.subspan(first, size),
+                lower.subspan(first, size),
+                scratch.subspan(first, size),
+                block > 0 ? lower[first] : T{0},
+                block < numSeparators ? upper[first + size - 1] : T{0}
+            );
+        },
+        numThreads
+    );
+
+    const std::span<T> reducedUpper{reduced.subspan(0, numSeparators)};
+    const std::span<T> reducedMiddle{reduced.subspan(numSeparators, numSeparators)};
+    const std::span<T> reducedLower{reduced.subspan(2 * numSeparators, numSeparators)};
+    const std::span<T> reducedX{reduced.subspan(3 * numSeparators, numSeparators)};
+    const std::span<T> reducedScratch{reduced.subspan(4 * numSeparators, numSeparators)};
+
+    for (std::size_t k{0}; k < numSeparators; ++k)
+    {
+        const std::size_t s{detail::partitionBlockBegin(k + 1, n, numBlocks) - 1};
+        const std::size_t before{s - 1};
+        const std::size_t after{s + 1};
+
+        reducedLower[k] = -lower[s] * left[before];
+        reducedMiddle[k] = middle[s] - lower[s] * right[before] - upper[s] * left[after];
+        reducedUpper[k] = -upper[s] * right[after];
+        reducedX[k] = x[s] - lower[s] * x[before] - upper[s] * x[after];
+    }
+
+    if (numSeparators == 1)
+    {
+        reducedX[0] /= reducedMiddle[0];
+    }
+    else
+    {
+        detail::thomasSweep<T>(
+            reducedX,
+            reducedUpper,
+            reducedMiddle,
+            reducedLower,
+            reducedScratch
+        );
+    }
+
+    execution::parallelFor(
+        0,
+        numBlocks,
+        [&](std::size_t block)
+        {
+            const auto [first, size] = blockRange(block);
+            const T xLeft{block > 0 ? reducedX[block - 1] : T{0}};
+            const T xRight{block < numSeparators ? reducedX[block] : T{0}};
+
+            for (std::size_t i{first}; i < first + size; ++i)
+            {
+                x[i] -= left[i] * xLeft + right[i] * xRight;
+            }
+        },
+        numThreads
+    );
+
+    for (std::size_t k{0}; k < numSeparators; ++k)
+    {
+        x[detail::partitionBlockBegin(k + 1, n, numBlocks) - 1] = reducedX[k];
+    }
+}
+
+template <std::floating_point T> void thomasSolveBatch(
+    std::span<T> x,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower,
+    std::span<T> scratch,
+    std::size_t batch,
+    bool doValidate
+)
+{
+    if (doValidate)
+    {
+        detail::validateInterleaved<T>(x, upper, middle, lower, batch);
+        REQUIRE_SAME_SIZE(scratch, x);
+    }
+
+    const std::size_t n{x.size() / batch};
+    const std::size_t last{n - 1};
+
+    for (std::size_t b{0}; b < batch; ++b)
+    {
+        const T middleInv{T{1} / middle[b]};
+
+        scratch[b] = upper[b] * middleInv;
+        x[b] *= middleInv;
+    }
+
+    for (std::size_t i{1}; i < n; ++i)
+    {
+        const std::size_t row{i * batch};
+        const std::size_t previous{row - batch};
+
+        if (i < last)
+        {
+            for (std::size_t b{0}; b < batch; ++b)
+            {
+                const T lowerI{lower[row + b]};
+                const T invDenom{
+                    T{1} / (middle[row + b] - lowerI * scratch[previous + b])
+                };
+
+                scratch[row + b] = upper[row + b] * invDenom;
+                x[row + b] = (x[row + b] - lowerI * x[previous + b]) * invDenom;
+            }
+        }
+        else
+        {
+            for (std::size_t b{0}; b < batch; ++b)
+            {
+                const T lowerI{lower[row + b]};
+                const T invDenom{
+                    T{1} / (middle[row + b] - lowerI * scratch[previous + b])
+                };
+
+                x[row + b] = (x[row + b] - lowerI * x[previous + b]) * invDenom;
+            }
+        }
+    }
+
+    for (std::size_t i{last}; i-- > 0;)
+    {
+        const std::size_t row{i * batch};
+        const std::size_t next{row + batch};
+
+        for (std::size_t b{0}; b < batch; ++b)
+        {
+            x[row + b] -= scratch[row + b] * x[next + b];
+        }
+    }
+}
+
+template <std::floating_point T> ThomasFactorization<T>::ThomasFactorization(
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower,
+    std::size_t batch
+)
+    : size_(batch > 0 ? middle.size() / batch : 0),
+      batch_(batch),
+      upperScaled_(middle.size()),
+      invDenom_(middle.size()),
+      lower_(lower.begin(), lower.end())
+{
+    detail::validateInterleaved<T>(middle, upper, middle, lower, batch);
+    factorize(upper, middle);
+    validate(upper, middle);
+}
+
+template <std::floating_point T>
+void ThomasFactorization<T>::factorize(
+    std::span<const T> upper,
+    std::span<const T> middle
+) noexcept
+{
+    const std::size_t last{size_ - 1};
+
+    for (std::size_t b{0}; b < batch_; ++b)
+    {
+        invDenom_[b] = T{1} / middle[b];
+        upperScaled_[b] = upper[b] * invDenom_[b];
+    }
+
+    for (std::size_t i{1}; i < size_; ++i)
+    {
+        const std::size_t row{i * batch_};
+        const std::size_t previous{row - batch_};
+
+        for (std::size_t b{0}; b < batch_; ++b)
+        {
+            invDenom_[row + b] =
+                T{1} / (middle[row + b] - lower_[row + b] * upperScaled_[previous + b]);
+            upperScaled_[row + b] =
+                (i < last) ? upper[row + b] * invDenom_[row + b] : T{0};
+        }
+    }
+}
+
+template <std::floating_point T>
+void ThomasFactorization<T>::validate(
+    std::span<const T> upper,
+    std::span<const T> middle
+) const
+{
+    REQUIRE_FINITE(upper);
+    REQUIRE_FINITE(middle);
+    REQUIRE_FINITE(std::span<const T>{lower_});
+
+    if (!std::ranges::all_of(invDenom_, [](T v) { return std::isfinite(v); }))
+    {
+        errors::raise(
+            errors::ErrorCode::LinearAlgebra,
+            "ThomasFactorization: zero pivot encountered"
+        );
+    }
+}
+
+template <std::floating_point T>
+std::size_t ThomasFactorization<T>::size() const noexcept
+{
+    return size_;
+}
+
+template <std::floating_point T>
+std::size_t ThomasFactorization<T>::batch() const noexcept
+{
+    return batch_;
+}
+
+template <std::floating_point T> void ThomasFactorization<T>::solve(std::span<T> x) const
+{
+    solve(x, 0, x.size() / size_);
+}
+
+template <std::floating_point T> void ThomasFactorization<T>::solve(
+    std::span<T> x,
+    std::size_t laneBegin,
+    std::size_t laneEnd
+) const
+{
+    const std::size_t stride{x.size() / size_};
+
+    if (stride == 0 || stride * size_ != x.size())
+    {
+        errors::raise(
+            errors::ErrorCode::InvalidArgument,
+            "ThomasFactorization: right-hand side size must be a multiple of the "
+            "system size"
+        );
+    }
+    if (batch_ != 1 && stride != batch_)
+    {
+        errors::raise(
+            errors::ErrorCode::InvalidArgument,
+            "ThomasFactorization: right-hand side lanes must match the factorized batch"
+        );
+    }
+    REQUIRE_EQUAL_OR_LESS(laneEnd, stride);
+    REQUIRE_EQUAL_OR_LESS(laneBegin, laneEnd);
+
+    const std::size_t last{size_ - 1};
+
+    if (batch_ == 1)
+    {
+        for (std::size_t b{laneBegin}; b < laneEnd; ++b)
+        {
+            x[b] *= invDenom_[0];
+        }
+
+        for (std::size_t i{1}; i < size_; ++i)
+        {
+            const std::size_t row{i * stride};
+            const std::size_t previous{row - stride};
+            const T lowerI{lower_[i]};
+            const T invDenom{invDenom_[i]};
+
+            for (std::size_t b{laneBegin}; b < laneEnd; ++b)
+            {
+                x[row + b] = (x[row + b] - lowerI * x[previous + b]) * invDenom;
+            }
+        }
+
+        for (std::size_t i{last}; i-- > 0;)
+        {
+            const std::size_t row{i * stride};
+            const std::size_t next{row + stride};
+            const T upperI{upperScaled_[i]};
+
+            for (std::size_t b{laneBegin}; b < laneEnd; ++b)
+            {
+                x[row + b] -= upperI * x[next + b];
+            }
+        }
+
+        return;
+    }
+
+    for (std::size_t b{laneBegin}; b < laneEnd; ++b)
+    {
+        x[b] *= invDenom_[b];
+    }
+
+    for (std::size_t i{1}; i < size_; ++i)
+    {
+        const std::size_t row{i * stride};
+        const std::size_t previous{row - stride};
+
+        for (std::size_t b{laneBegin}; b < laneEnd; ++b)
+        {
+            x[row + b] =
+                (x[row + b] - lower_[row + b] * x[previous + b]) * invDenom_[row + b];
+        }
+    }
+
+    for (std::size_t i{last}; i-- > 0;)
+    {
+        const std::size_t row{i * stride};
+        const std::size_t next{row + stride};
+
+        for (std::size_t b{laneBegin}; b < laneEnd; ++b)
+        {
+            x[row + b] -= upperScaled_[row + b] * x[next + b];
+        }
+    }
+}
+
+// Solves consecutive systems stored back to back, sweeping all lines together so
+// the recurrence latency of one line is hidden behind the others.
+template <std::floating_point T> void ThomasFactorization<T>::solveLines(
+    std::span<T> x,
+    std::size_t lineBegin,
+    std::size_t lineEnd
+) const
+{
+    if (batch_ != 1)
+    {
+        errors::raise(
+            errors::ErrorCode::InvalidArgument,
+            "ThomasFactorization: line solves require a single factorized system"
+        );
+    }
+    REQUIRE_EQUAL_OR_LESS(lineBegin, lineEnd);
+    REQUIRE_EQUAL_OR_LESS(lineEnd * size_, x.size());
+
+    const std::size_t last{size_ - 1};
+    T* const data{x.data()};
+
+    for (std::size_t b{lineBegin}; b < lineEnd; ++b)
+    {
+        data[b * size_] *= invDenom_[0];
+    }
+
+    for (std::size_t i{1}; i < size_; ++i)
+    {
+        const T lowerI{lower_[i]};
+        const T invDenom{invDenom_[i]};
+
+        for (std::size_t b{lineBegin}; b < lineEnd; ++b)
+        {
+            T* const line{data + b * size_};
+            line[i] = (line[i] - lowerI * line[i - 1]) * invDenom;
+        }
+    }
+
+    for (std::size_t i{last}; i-- > 0;)
+    {
+        const T upperI{upperScaled_[i]};
+
+        for (std::size_t b{lineBegin}; b < lineEnd; ++b)
+        {
+            T* const line{data + b * size_};
+            line[i] -= upperI * line[i + 1];
+        }
+    }
+}
+
+template <std::floating_point T> void ThomasFactorization<T>::solveProjected(
+    std::span<T> x,
+    std::span<const T> obstacle
+) const
+{
+    if (batch_ != 1)
+    {
+        errors::raise(
+            errors::ErrorCode::InvalidArgument,
+            "ThomasFactorization: projected solves require a single factorized system"
+        );
+    }
+    REQUIRE_EQUAL(x.size(), size_);
+    REQUIRE_SAME_SIZE(obstacle, x);
+
+    const std::size_t last{size_ - 1};
+
+    x[0] *= invDenom_[0];
+
+    for (std::size_t i{1}; i < size_; ++i)
+    {
+        x[i] = (x[i] - lower_[i] * x[i - 1]) * invDenom_[i];
+    }
+
+    x[last] = std::max(x[last], obstacle[last]);
+
+    for (std::size_t i{last}; i-- > 0;)
+    {
+        x[i] = std::max(x[i] - upperScaled_[i] * x[i + 1], obstacle[i]);
+    }
+}
 } // namespace uv::math::linear_algebra
+
+namespace uv::math::linear_algebra::detail
+{
+template <std::floating_point T> void thomasSweep(
+    std::span<T> x,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower,
+    std::span<T> scratch
+) noexcept
+{
+    const std::size_t n{x.size()};
+    const std::size_t last{n - 1};
+
+    const T middleInv{T{1} / middle[0]};
+
+    scratch[0] = upper[0] * middleInv;
+    x[0] *= middleInv;
+
+    for (std::size_t i{1}; i < n; ++i)
+    {
+        const std::size_t previous{i - 1};
+        const T lowerI{lower[i]};
+        const T invDenom{T{1} / (middle[i] - lowerI * scratch[previous])};
+
+        scratch[i] = (i < last) ? upper[i] * invDenom : T{0};
+        x[i] = (x[i] - lowerI * x[previous]) * invDenom;
+    }
+
+    for (std::size_t i{last}; i-- > 0;)
+    {
+        x[i] -= scratch[i] * x[i + 1];
+    }
+}
+
+template <std::floating_point T> void spikeSweep(
+    std::span<T> x,
+    std::span<T> left,
+    std::span<T> right,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower,
+    std::span<T> scratch,
+    T leftCoupling,
+    T rightCoupling
+) noexcept
+{
+    const std::size_t n{x.size()};
+    const std::size_t last{n - 1};
+
+    std::fill(left.begin(), left.end(), T{0});
+    std::fill(right.begin(), right.end(), T{0});
+
+    left[0] = leftCoupling;
+    right[last] = rightCoupling;
+
+    const T middleInv{T{1} / middle[0]};
+
+    scratch[0] = (n > 1) ? upper[0] * middleInv : T{0};
+    x[0] *= middleInv;
+    left[0] *= middleInv;
+    right[0] *= middleInv;
+
+    for (std::size_t i{1}; i < n; ++i)
+    {
+        const std::size_t previous{i - 1};
+        const T lowerI{lower[i]};
+        const T invDenom{T{1} / (middle[i] - lowerI * scratch[previous])};
+
+        scratch[i] = (i < last) ? upper[i] * invDenom : T{0};
+        x[i] = (x[i] - lowerI * x[previous]) * invDenom;
+        left[i] = (left[i] - lowerI * left[previous]) * invDenom;
+        right[i] = (right[i] - lowerI * right[previous]) * invDenom;
+    }
+
+    for (std::size_t i{last}; i-- > 0;)
+    {
+        const T scratchI{scratch[i]};
+
+        x[i] -= scratchI * x[i + 1];
+        left[i] -= scratchI * left[i + 1];
+        right[i] -= scratchI * right[i + 1];
+    }
+}
+
+template <std::floating_point T> void validateSystem(
+    std::span<const T> x,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower
+)
+{
+    REQUIRE_MIN_SIZE(x, 2);
+    REQUIRE_SAME_SIZE(upper, x);
+    REQUIRE_SAME_SIZE(middle, x);
+    REQUIRE_SAME_SIZE(lower, x);
+}
+
+inline std::size_t
+partitionBlockBegin(std::size_t block, std::size_t n, std::size_t numBlocks)
+{
+    const std::size_t numUnknowns{n - (numBlocks - 1)};
+    return block * numUnknowns / numBlocks + block;
+}
+
+template <std::floating_point T> std::size_t validateInterleaved(
+    std::span<const T> x,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower,
+    std::size_t batch
+)
+{
+    REQUIRE_GREATER(batch, std::size_t{0});
+    REQUIRE_SAME_SIZE(upper, x);
+    REQUIRE_SAME_SIZE(middle, x);
+    REQUIRE_SAME_SIZE(lower, x);
+
+    const std::size_t n{x.size() / batch};
+
+    if (n * batch != x.size())
+    {
+        errors::raise(
+            errors::ErrorCode::InvalidArgument,
+            "Interleaved tridiagonal storage must be a multiple of the batch size"
+        );
+    }
+    if (n < 2)
+    {
+        errors::raise(
+            errors::ErrorCode::InvalidArgument,
+            "Tridiagonal systems must have at least two rows"
+        );
+    }
+
+    return n;
+}
+} // namespace uv::math::linear_algebra::detail
@@ -37,85 +37,168 @@ template <std::floating_point T> T sum(std::span<const T> x) noexcept
     return std::accumulate(x.begin(), x.end(), T{});
 }
 
-template <std::floating_point T> Vector<T> multiply(std::span<const T> v, const T x)
+// Element-wise kernels index raw pointers so that the loops auto-vectorize. The
+// out-parameter overloads allow out to alias their inputs.
+template <std::floating_point T, typename F>
+void transform(std::span<T> out, std::span<const T> x, F&& f)
+{
+    REQUIRE_SAME_SIZE(out, x);
+
+    auto&& func = std::forward<F>(f);
+
+    T* o{out.data()};
+    const T* in{x.data()};
+    const std::size_t n{x.size()};
+
+    for (std::size_t i{0}; i < n; ++i)
+        o[i] = std::invoke(func, in[i]);
+}
+
+template <std::floating_point T, typename F>
+void transform(std::span<T> out, std::span<const T> a, std::span<const T> b, F&& f)
 {
-    std::size_t vSize{v.size()};
+    REQUIRE_SAME_SIZE(out, a);
+    REQUIRE_SAME_SIZE(a, b);
 
-    Vector<T> result(vSize);
+    auto&& func = std::forward<F>(f);
 
-    for (std::size_t i = 0; i < vSize; ++i)
-    {
-        result[i] = v[i] * x;
-    }
+    T* o{out.data()};
+    const T* lhs{a.data()};
+    const T* rhs{b.data()};
+    const std::size_t n{a.size()};
+
+    for (std::size_t i{0}; i < n; ++i)
+        o[i] = std::invoke(func, lhs[i], rhs[i]);
+}
+
+template <std::floating_point T> Vector<T> multiply(std::span<const T> v, const T x)
+{
+    Vector<T> result(v.size());
+    multiply<T>(result, v, x);
 
     return result;
 }
 
-template <std::floating_point T> Vector<T> reciprocal(std::span<const T> v)
+template <std::floating_point T>
+void multiply(std::span<T> out, std::span<const T> v, const T x)
 {
-    std::size_t vSize{v.size()};
+    transform<T>(out, v, [x](T value) { return value * x; });
+}
 
-    Vector<T> result(vSize);
+template <std::floating_point T> void multiplyInplace(std::span<T> v, const T x) noexcept
+{
+    T* data{v.data()};
+    const std::size_t n{v.size()};
 
-    for (std::size_t i = 0; i < vSize; ++i)
-    {
-        result[i] = T(1.0) / v[i];
-    }
+    for (std::size_t i{0}; i < n; ++i)
+        data[i] *= x;
+}
+
+template <std::floating_point T> Vector<T> reciprocal(std::span<const T> v)
+{
+    Vector<T> result(v.size());
+    reciprocal<T>(result, v);
 
     return result;
 }
 
-template <std::floating_point T> Vector<T> exponential(std::span<const T> x)
+template <std::floating_point T> void reciprocal(std::span<T> out, std::span<const T> v)
 {
-    const std::size_t n{x.size()};
+    transform<T>(out, v, [](T value) { return T{1} / value; });
+}
 
-    Vector<T> out(n);
+template <std::floating_point T> void reciprocalInplace(std::span<T> v) noexcept
+{
+    T* data{v.data()};
+    const std::size_t n{v.size()};
 
     for (std::size_t i{0}; i < n; ++i)
-    {
-        out[i] = std::exp(x[i]);
-    }
+        data[i] = T{1} / data[i];
+}
+
+template <std::floating_point T> Vector<T> exponential(std::span<const T> x)
+{
+    Vector<T> out(x.size());
+    exponential<T>(out, x);
 
     return out;
 }
 
+template <std::floating_point T> void exponential(std::span<T> out, std::span<const T> x)
+{
+    transform<T>(out, x, [](T value) { return std::exp(value); });
+}
+
+template <std::floating_point T> void exponentialInplace(std::span<T> x) noexcept
+{
+    T* data{x.data()};
+    const std::size_t n{x.size()};
+
+    for (std::size_t i{0}; i < n; ++i)
+        data[i] = std::exp(data[i]);
+}
+
 template <std::floating_point T> Vector<T> squareRoot(std::span<const T> x)
 {
     Vector<T> out(x.size());
-    squareRootInplace<T>(out, x);
+    squareRoot<T>(out, x);
 
     return out;
 }
 
+template <std::floating_point T> void squareRoot(std::span<T> out, std::span<const T> x)
+{
+    transform<T>(out, x, [](T value) { return std::sqrt(value); });
+}
+
 template <std::floating_point T>
 void squareRootInplace(std::span<T> out, std::span<const T> x)
 {
-    REQUIRE_SAME_SIZE(out, x);
+    squareRoot<T>(out, x);
+}
 
+template <std::floating_point T> void squareRootInplace(std::span<T> x) noexcept
+{
+    T* data{x.data()};
     const std::size_t n{x.size()};
 
     for (std::size_t i{0}; i < n; ++i)
-    {
-        out[i] = std::sqrt(x[i]);
-    }
+        data[i] = std::sqrt(data[i]);
 }
 
 template <std::floating_point T>
 Vector<T> hadamard(std::span<const T> a, std::span<const T> b)
 {
-
     REQUIRE_SAME_SIZE(a, b);
 
-    std::size_t aSize{a.size()};
+    Vector<T> c(a.size());
+    hadamard<T>(c, a, b);
 
-    Vector<T> c(aSize);
+    return c;
+}
 
-    for (std::size_t i = 0; i < aSize; ++i)
-    {
-        c[i] = a[i] * b[i];
-    }
+template <std::floating_point T>
+void hadamard(std::span<T> out, std::span<const T> a, std::span<const T> b)
+{
+    transform<T>(out, a, b, [](T lhs, T rhs) { return lhs * rhs; });
+}
 
-    return c;
+template <std::floating_point T>
+void hadamardInplace(std::span<T> a, std::span<const T> b)
+{
+    hadamard<T>(a, a, b);
+}
+
+template <std::floating_point T>
+void scaledSquareRoot(std::span<T> out, std::span<const T> x, const T scale)
+{
+    transform<T>(out, x, [scale](T value) { return std::sqrt(scale * value); });
+}
+
+template <std::floating_point T>
+void scaledExponential(std::span<T> out, std::span<const T> x, const T scale)
+{
+    transform<T>(out, x, [scale](T value) { return std::exp(scale * value); });
 }
 
 template <typename T> Vector<T> makeSequence(std::size_t n, T start)
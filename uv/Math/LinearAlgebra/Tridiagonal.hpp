@@ -2,19 +2,122 @@
 
 #pragma once
 
+#include "Base/Types.hpp"
+
 #include <concepts>
 #include <cstddef>
 #include <span>
 
 namespace uv::math::linear_algebra
 {
-template <std::floating_point T, std::size_t N> void thomasSolve(
+template <std::floating_point T> class TridiagonalWorkspace
+{
+  private:
+    Vector<T> scratch_;
+    Vector<T> leftSpike_;
+    Vector<T> rightSpike_;
+    Vector<T> reduced_;
+
+  public:
+    TridiagonalWorkspace() = default;
+    explicit TridiagonalWorkspace(std::size_t n, std::size_t numBlocks = 1);
+
+    void reserve(std::size_t n, std::size_t numBlocks = 1);
+
+    std::span<T> scratch(std::size_t n);
+    std::span<T> leftSpike(std::size_t n);
+    std::span<T> rightSpike(std::size_t n);
+    std::span<T> reduced(std::size_t n);
+};
+
+template <std::floating_point T, std::size_t N>
+requires(N != std::dynamic_extent)
+void thomasSolve(
     std::span<T, N> x,
     std::span<const T, N> upper,
     std::span<const T, N> middle,
     std::span<const T, N> lower,
     std::span<T, N> scratch
 ) noexcept;
+
+template <std::floating_point T> void thomasSolve(
+    std::span<T> x,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower,
+    std::span<T> scratch,
+    bool doValidate = true
+);
+
+template <std::floating_point T> void thomasSolve(
+    std::span<T> x,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower,
+    TridiagonalWorkspace<T>& workspace,
+    bool doValidate = true
+);
+
+template <std::floating_point T> void brennanSchwartzSolve(
+    std::span<T> x,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower,
+    std::span<const T> obstacle,
+    std::span<T> scratch,
+    bool doValidate = true
+);
+
+template <std::floating_point T> void partitionSolve(
+    std::span<T> x,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower,
+    TridiagonalWorkspace<T>& workspace,
+    std::size_t numBlocks = 0,
+    int numThreads = -1,
+    bool doValidate = true
+);
+
+template <std::floating_point T> void thomasSolveBatch(
+    std::span<T> x,
+    std::span<const T> upper,
+    std::span<const T> middle,
+    std::span<const T> lower,
+    std::span<T> scratch,
+    std::size_t batch,
+    bool doValidate = true
+);
+
+template <std::floating_point T> class ThomasFactorization
+{
+  private:
+    std::size_t size_;
+    std::size_t batch_;
+    Vector<T> upperScaled_;
+    Vector<T> invDenom_;
+    Vector<T> lower_;
+
+    void factorize(std::span<const T> upper, std::span<const T> middle) noexcept;
+    void validate(std::span<const T> upper, std::span<const T> middle) const;
+
+  public:
+    ThomasFactorization() = delete;
+    explicit ThomasFactorization(
+        std::span<const T> upper,
+        std::span<const T> middle,
+        std::span<const T> lower,
+        std::size_t batch = 1
+    );
+
+    std::size_t size() const noexcept;
+    std::size_t batch() const noexcept;
+
+    void solve(std::span<T> x) const;
+    void solve(std::span<T> x, std::size_t laneBegin, std::size_t laneEnd) const;
+    void solveLines(std::span<T> x, std::size_t lineBegin, std::size_t lineEnd) const;
+    void solveProjected(std::span<T> x, std::span<const T> obstacle) const;
+};
 } // namespace uv::math::linear_algebra
 
 #include "Math/LinearAlgebra/Detail/Tridiagonal.inl"
@@ -20,19 +20,55 @@ void evalInplace(std::array<T, N>& grid, F&& f);
 
 template <std::floating_point T> T sum(std::span<const T>) noexcept;
 
+template <std::floating_point T, typename F>
+void transform(std::span<T> out, std::span<const T> x, F&& f);
+
+template <std::floating_point T, typename F>
+void transform(std::span<T> out, std::span<const T> a, std::span<const T> b, F&& f);
+
 template <std::floating_point T> Vector<T> multiply(std::span<const T> v, T x);
 
+template <std::floating_point T>
+void multiply(std::span<T> out, std::span<const T> v, T x);
+
+template <std::floating_point T> void multiplyInplace(std::span<T> v, T x) noexcept;
+
 template <std::floating_point T> Vector<T> reciprocal(std::span<const T>);
 
+template <std::floating_point T> void reciprocal(std::span<T> out, std::span<const T> v);
+
+template <std::floating_point T> void reciprocalInplace(std::span<T> v) noexcept;
+
 template <std::floating_point T> Vector<T> exponential(std::span<const T>);
 
+template <std::floating_point T> void exponential(std::span<T> out, std::span<const T> x);
+
+template <std::floating_point T> void exponentialInplace(std::span<T> x) noexcept;
+
 template <std::floating_point T> Vector<T> squareRoot(std::span<const T>);
 
+template <std::floating_point T> void squareRoot(std::span<T> out, std::span<const T> x);
+
 template <std::floating_point T> void squareRootInplace(std::span<T>, std::span<const T>);
 
+template <std::floating_point T> void squareRootInplace(std::span<T> x) noexcept;
+
 template <std::floating_point T>
 Vector<T> hadamard(std::span<const T> a, std::span<const T> b);
 
+template <std::floating_point T>
+void hadamard(std::span<T> out, std::span<const T> a, std::span<const T> b);
+
+template <std::floating_point T>
+void hadamardInplace(std::span<T> a, std::span<const T> b);
+
+// Fused kernels: out[i] = sqrt(scale * x[i]) and out[i] = exp(scale * x[i]).
+template <std::floating_point T>
+void scaledSquareRoot(std::span<T> out, std::span<const T> x, T scale);
+
+template <std::floating_point T>
+void scaledExponential(std::span<T> out, std::span<const T> x, T scale);
+
 template <typename T> Vector<T> makeSequence(std::size_t n, T start);
 
 template <typename T> T minValue(std::span<const T>);
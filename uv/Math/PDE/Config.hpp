@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+
+namespace uv::math::pde
+{
+enum class Exercise
+{
+    European,
+    Bermudan,
+    American
+};
+
+template <std::floating_point T> struct Config
+{
+    std::size_t numNodes{401};
+    std::size_t numTimeSteps{200};
+    std::size_t rannacherSteps{2};
+    T numStdDevs{T{5}};
+    T beta{T{3}};
+};
+
+template <std::floating_point T> struct DeAmericanizeConfig
+{
+    Config<T> grid{.numNodes = 201, .numTimeSteps = 100};
+    T tolerance{T{1e-8}};
+    std::size_t maxIterations{50};
+    T minVol{T{1e-3}};
+    T maxVol{T{5}};
+    int numThreads{-1};
+};
+
+} // namespace uv::math::pde
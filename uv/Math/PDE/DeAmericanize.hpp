@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/Matrix.hpp"
+#include "Math/PDE/Config.hpp"
+#include "Math/PDE/Pricer.hpp"
+
+#include <concepts>
+#include <span>
+
+namespace uv::math::pde
+{
+// Flat volatility at which the American PDE price reproduces americanPrice; the
+// European-equivalent vol of the de-Americanization method.
+template <std::floating_point T> T europeanEquivalentVol(
+    Pricer<T>& pricer,
+    T americanPrice,
+    T t,
+    T r,
+    T q,
+    T S,
+    T K,
+    bool isCall,
+    const DeAmericanizeConfig<T>& config = {}
+);
+
+// americanPrices holds out-of-the-money premiums: puts below the forward, calls at
+// or above it. Returns the European-equivalent vol of every quote.
+template <std::floating_point T> core::Matrix<T> deAmericanize(
+    const core::Matrix<T>& americanPrices,
+    std::span<const T> maturities,
+    std::span<const T> strikes,
+    T r,
+    T q,
+    T S,
+    const DeAmericanizeConfig<T>& config = {}
+);
+} // namespace uv::math::pde
+
+#include "Math/PDE/Detail/DeAmericanize.inl"
@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Errors/Errors.hpp"
+#include "Base/Execution/Parallel.hpp"
+#include "Base/Execution/ThreadPolicy.hpp"
+#include "Base/Macros/Require.hpp"
+#include "Math/Functions/Black.hpp"
+#include "Math/Functions/Volatility.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace uv::math::pde::detail
+{
+template <std::floating_point T>
+void validateConfig(const DeAmericanizeConfig<T>& config);
+} // namespace uv::math::pde::detail
+
+namespace uv::math::pde
+{
+template <std::floating_point T> T europeanEquivalentVol(
+    Pricer<T>& pricer,
+    T americanPrice,
+    T t,
+    T r,
+    T q,
+    T S,
+    T K,
+    bool isCall,
+    const DeAmericanizeConfig<T>& config
+)
+{
+    REQUIRE_POSITIVE(americanPrice);
+    REQUIRE_POSITIVE(t);
+    REQUIRE_POSITIVE(S);
+    REQUIRE_POSITIVE(K);
+    detail::validateConfig(config);
+
+    const T dF{std::exp(-r * t)};
+    const T F{S * std::exp((r - q) * t)};
+    const T callPrice{isCall ? americanPrice : americanPrice + dF * (F - K)};
+
+    // The European implied vol of the American premium is an upper-biased but close
+    // start; Newton steps use the Black vega and fall back to bisection.
+    T lo{config.minVol};
+    T hi{config.maxVol};
+    T vol{vol::impliedVol(std::max(callPrice, T{0}), t, dF, F, K, false)};
+
+    if (!std::isfinite(vol) || vol <= lo || vol >= hi)
+        vol = std::clamp(T{0.2}, lo, hi);
+
+    for (std::size_t iter{0}; iter < config.maxIterations; ++iter)
+    {
+        const T residual{
+            pricer.price(t, r, q, vol, S, K, isCall, Exercise::American) - americanPrice
+        };
+
+        if (residual > T{0})
+            hi = vol;
+        else
+            lo = vol;
+
+        T next{vol - residual / black::vegaB76(t, dF, F, vol, K)};
+
+        if (!(next > lo && next < hi))
+            next = T{0.5} * (lo + hi);
+
+        if (std::abs(next - vol) <= config.tolerance || hi - lo <= config.tolerance)
+        {
+            if (next - config.minVol <= config.tolerance ||
+                config.maxVol - next <= config.tolerance) [[unlikely]]
+            {
+                errors::raise(
+                    errors::ErrorCode::OutOfRange,
+                    "americanPrice is outside the range spanned by [minVol, maxVol]"
+                );
+            }
+
+            return next;
+        }
+
+        vol = next;
+    }
+
+    errors::raise(
+        errors::ErrorCode::CalibrationError,
+        "European-equivalent vol did not converge within maxIterations"
+    );
+}
+
+template <std::floating_point T> core::Matrix<T> deAmericanize(
+    const core::Matrix<T>& americanPrices,
+    std::span<const T> maturities,
+    std::span<const T> strikes,
+    T r,
+    T q,
+    T S,
+    const DeAmericanizeConfig<T>& config
+)
+{
+    REQUIRE_NON_EMPTY(maturities);
+    REQUIRE_NON_EMPTY(strikes);
+    REQUIRE_POSITIVE(maturities);
+    REQUIRE_POSITIVE(strikes);
+    REQUIRE_FINITE(r);
+    REQUIRE_FINITE(q);
+    REQUIRE_POSITIVE(S);
+    REQUIRE_SAME_SIZE(maturities, americanPrices.rows());
+    REQUIRE_SAME_SIZE(strikes, americanPrices.cols());
+    detail::validateConfig(config);
+
+    const std::size_t numStrikes{strikes.size()};
+    const std::size_t numCells{maturities.size() * numStrikes};
+    const std::size_t numWorkers{std::min(
+        static_cast<std::size_t>(execution::requestThreads(config.numThreads)),
+        numCells
+    )};
+
+    core::Matrix<T> vols{maturities.size(), numStrikes};
+
+    // Quotes are dealt round-robin so short and long maturities mix on every worker.
+    execution::parallelFor(
+        0,
+        numWorkers,
+        [&](std::size_t worker)
+        {
+            Pricer<T> pricer{config.grid};
+
+            for (std::size_t cell{worker}; cell < numCells; cell += numWorkers)
+            {
+                const std::size_t i{cell / numStrikes};
+                const std::size_t j{cell % numStrikes};
+                const T t{maturities[i]};
+                const T K{strikes[j]};
+
+                vols[i][j] = europeanEquivalentVol(
+                    pricer,
+                    americanPrices[i][j],
+                    t,
+                    r,
+                    q,
+                    S,
+                    K,
+                    K >= S * std::exp((r - q) * t),
+                    config
+                );
+            }
+        },
+        static_cast<int>(numWorkers)
+    );
+
+    return vols;
+}
+} // namespace uv::math::pde
+
+namespace uv::math::pde::detail
+{
+template <std::floating_point T>
+void validateConfig(const DeAmericanizeConfig<T>& config)
+{
+    REQUIRE_POSITIVE(config.tolerance);
+    REQUIRE_GREATER(config.maxIterations, std::size_t{0});
+    REQUIRE_POSITIVE(config.minVol);
+    REQUIRE_GREATER(config.maxVol, config.minVol);
+}
+} // namespace uv::math::pde::detail
@@ -0,0 +1,263 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Macros/Require.hpp"
+#include "Math/Interpolation/Hermite/Interpolator.hpp"
+#include "Math/LinearAlgebra/Tridiagonal.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace uv::math::pde::detail
+{
+template <std::floating_point T> T forwardAt(
+    std::span<const T> maturities,
+    std::span<const T> forwards,
+    T t
+) noexcept;
+} // namespace uv::math::pde::detail
+
+namespace uv::math::pde
+{
+template <std::floating_point T>
+DupireSolver<T>::DupireSolver(const Config<T>& config)
+    : config_(config)
+{
+    validateConfig();
+}
+
+template <std::floating_point T>
+template <typename LocalVol>
+requires std::invocable<LocalVol&, T, T>
+core::Matrix<T> DupireSolver<T>::callPrice(
+    const core::VolSurface<T>& volSurface,
+    const core::Curve<T>& curve,
+    LocalVol&& localVol
+)
+{
+    const std::span<const T> maturities{volSurface.maturities()};
+    const std::span<const T> forwards{volSurface.forwards()};
+    const std::span<const T> strikes{volSurface.strikes()};
+    const std::size_t numMaturities{volSurface.numMaturities()};
+
+    REQUIRE_POSITIVE(maturities.front());
+
+    const Vector<T> discountFactors{curve.interpolateDF(maturities)};
+    const Grid<T> grid{makeGrid(volSurface)};
+    const std::span<const T> x{grid.x()};
+
+    const std::size_t n{x.size()};
+    const std::size_t rannacherSteps{config_.rannacherSteps};
+    const T horizon{maturities.back()};
+
+    for (Vector<T>* buffer :
+         {&values_, &rhs_, &upper_, &middle_, &lower_, &scratch_, &strikes_, &variance_})
+    {
+        buffer->resize(n);
+    }
+
+    // Forward-normalised call c(t, x) = C(t, K) / (D(t) F(t)) with x = ln(K / F(t)):
+    // c_t = 1/2 sigma^2 (c_xx - c_x), c(0, x) = (1 - e^x)^+.
+    for (std::size_t i{0}; i < n; ++i)
+    {
+        values_[i] = std::max(T{1} - std::exp(x[i]), T{0});
+    }
+
+    core::Matrix<T> out{numMaturities, volSurface.numStrikes()};
+
+    std::size_t step{0};
+    T t{0};
+
+    for (std::size_t m{0}; m < numMaturities; ++m)
+    {
+        const T tEnd{maturities[m]};
+        const T interval{tEnd - t};
+        const std::size_t numSteps{std::max<std::size_t>(
+            1,
+            static_cast<std::size_t>(
+                std::ceil(static_cast<T>(config_.numTimeSteps) * interval / horizon)
+            )
+        )};
+        const T dt{interval / static_cast<T>(numSteps)};
+        const T halfDt{T{0.5} * dt};
+
+        for (std::size_t k{0}; k < numSteps; ++k, ++step)
+        {
+            const T tNext{(k + 1 == numSteps) ? tEnd : t + dt};
+
+            if (step < rannacherSteps)
+            {
+                const T tMid{T{0.5} * (t + tNext)};
+
+                for (const T tStep : {tMid, tNext})
+                {
+                    assemble(grid, localVol, maturities, forwards, tStep);
+                    operator_.implicitSystem(upper_, middle_, lower_, halfDt);
+                    linear_algebra::thomasSolve<T>(
+                        values_,
+                        upper_,
+                        middle_,
+                        lower_,
+                        scratch_,
+                        false
+                    );
+                }
+            }
+            else
+            {
+                assemble(grid, localVol, maturities, forwards, t);
+                operator_.apply(rhs_, values_, halfDt);
+
+                assemble(grid, localVol, maturities, forwards, tNext);
+                operator_.implicitSystem(upper_, middle_, lower_, halfDt);
+                linear_algebra::thomasSolve<T>(
+                    rhs_,
+                    upper_,
+                    middle_,
+                    lower_,
+                    scratch_,
+                    false
+                );
+
+                values_.swap(rhs_);
+            }
+
+            t = tNext;
+        }
+
+        interpolate(out[m], x, discountFactors[m], forwards[m], strikes);
+    }
+
+    return out;
+}
+
+template <std::floating_point T>
+const Config<T>& DupireSolver<T>::config() const noexcept
+{
+    return config_;
+}
+
+template <std::floating_point T> void DupireSolver<T>::validateConfig() const
+{
+    REQUIRE_GREATER(config_.numNodes, std::size_t{4});
+    REQUIRE_GREATER(config_.numTimeSteps, std::size_t{0});
+    REQUIRE_EQUAL_OR_LESS(config_.rannacherSteps, config_.numTimeSteps);
+    REQUIRE_POSITIVE(config_.numStdDevs);
+    REQUIRE_NON_NEGATIVE(config_.beta);
+}
+
+template <std::floating_point T>
+Grid<T> DupireSolver<T>::makeGrid(const core::VolSurface<T>& volSurface) const
+{
+    const std::span<const T> forwards{volSurface.forwards()};
+    const std::span<const T> strikes{volSurface.strikes()};
+    const core::Matrix<T>& vol{volSurface.vol()};
+
+    T moneynessRange{0};
+    T volScale{0};
+
+    for (std::size_t m{0}; m < volSurface.numMaturities(); ++m)
+    {
+        for (std::size_t j{0}; j < volSurface.numStrikes(); ++j)
+        {
+            moneynessRange =
+                std::max(moneynessRange, std::abs(std::log(strikes[j] / forwards[m])));
+            volScale = std::max(volScale, vol[m][j]);
+        }
+    }
+
+    REQUIRE_POSITIVE(volScale);
+
+    const T horizon{volSurface.maturities().back()};
+    const T xMax{moneynessRange + config_.numStdDevs * volScale * std::sqrt(horizon)};
+
+    return generateCenteredSinHGrid<T>(config_.numNodes | 1U, -xMax, xMax, config_.beta);
+}
+
+template <std::floating_point T>
+template <typename LocalVol>
+void DupireSolver<T>::assemble(
+    const Grid<T>& grid,
+    LocalVol& localVol,
+    std::span<const T> maturities,
+    std::span<const T> forwards,
+    T t
+)
+{
+    const T F{detail::forwardAt(maturities, forwards, t)};
+    const std::span<const T> x{grid.x()};
+
+    for (std::size_t i{0}; i < x.size(); ++i)
+    {
+        strikes_[i] = F * std::exp(x[i]);
+
+        const T sigma{static_cast<T>(std::invoke(localVol, t, strikes_[i]))};
+        variance_[i] = T{0.5} * sigma * sigma;
+    }
+
+    operator_.assemble(
+        grid,
+        [&](std::size_t i) { return variance_[i]; },
+        [&](std::size_t i) { return -variance_[i]; },
+        [](std::size_t) { return T{0}; }
+    );
+}
+
+template <std::floating_point T> void DupireSolver<T>::interpolate(
+    std::span<T> out,
+    std::span<const T> x,
+    T dF,
+    T F,
+    std::span<const T> strikes
+)
+{
+    const std::size_t m{strikes.size()};
+
+    points_.resize(m);
+    interpolated_.resize(m);
+
+    for (std::size_t j{0}; j < m; ++j)
+    {
+        points_[j] = std::log(strikes[j] / F);
+    }
+
+    interp::hermite::PchipInterpolator<T>{}(
+        std::span<const T>{points_},
+        x,
+        std::span<const T>{values_},
+        std::span<T>{interpolated_},
+        false
+    );
+
+    for (std::size_t j{0}; j < m; ++j)
+    {
+        out[j] = dF * F * interpolated_[j];
+    }
+}
+} // namespace uv::math::pde
+
+namespace uv::math::pde::detail
+{
+template <std::floating_point T> T forwardAt(
+    std::span<const T> maturities,
+    std::span<const T> forwards,
+    T t
+) noexcept
+{
+    if (t <= maturities.front())
+        return forwards.front();
+
+    const std::size_t last{maturities.size() - 1};
+
+    if (t >= maturities[last])
+        return forwards[last];
+
+    const auto upper{std::upper_bound(maturities.begin(), maturities.end(), t)};
+    const std::size_t hi{static_cast<std::size_t>(upper - maturities.begin())};
+    const std::size_t lo{hi - 1};
+
+    const T weight{(t - maturities[lo]) / (maturities[hi] - maturities[lo])};
+
+    return forwards[lo] * std::pow(forwards[hi] / forwards[lo], weight);
+}
+} // namespace uv::math::pde::detail
@@ -4,36 +4,111 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace uv::math::pde::detail
 {
 template <std::floating_point T, std::size_t N>
 std::array<T, N> generateUniformGrid(T xMin, T xMax);
+
+template <std::floating_point T> void fillUniform(std::span<T> x, T xMin, T xMax);
+
+template <std::floating_point T>
+bool fillCenteredSinH(std::span<T> x, T xMin, T xMax, T beta);
+
+template <std::floating_point T>
+bool fillConcentrated(std::span<T> x, T xMin, T xMax, std::span<const T> centers, T beta);
 } // namespace uv::math::pde::detail
 
 namespace uv::math::pde
 {
 template <std::floating_point T, std::size_t N> Grid<T, N>::Grid(std::span<const T, N> x)
 {
-    std::copy(x.begin(), x.end(), x_.begin());
+    if constexpr (N == std::dynamic_extent)
+    {
+        x_.assign(x.begin(), x.end());
+        dx_.resize(x_.empty() ? 0 : x_.size() - 1);
+
+        for (Vector<T>* weights :
+             {&firstLower_,
+              &firstMiddle_,
+              &firstUpper_,
+              &secondLower_,
+              &secondMiddle_,
+              &secondUpper_})
+        {
+            weights->resize(x_.size());
+        }
+    }
+    else
+    {
+        std::copy(x.begin(), x.end(), x_.begin());
+    }
+
     validate();
     setGridSteps();
+    setStencils();
 }
 
 template <std::floating_point T, std::size_t N> void Grid<T, N>::validate() const
 {
-    static_assert(N > 2, "Size of grid must be larger than 2");
+    if constexpr (N == std::dynamic_extent)
+    {
+        REQUIRE_MIN_SIZE(x_, 3);
+    }
+    else
+    {
+        static_assert(N > 2, "Size of grid must be larger than 2");
+    }
+
     REQUIRE_STRICTLY_MONOTONIC(x_);
 }
 
 template <std::floating_point T, std::size_t N> void Grid<T, N>::setGridSteps() noexcept
 {
-    for (std::size_t i{0}; i < N - 1; ++i)
+    for (std::size_t i{0}; i < dx_.size(); ++i)
     {
         dx_[i] = x_[i + 1] - x_[i];
     }
 }
 
+template <std::floating_point T, std::size_t N> void Grid<T, N>::setStencils() noexcept
+{
+    const std::size_t n{x_.size()};
+
+    for (auto* weights :
+         {&firstLower_,
+          &firstMiddle_,
+          &firstUpper_,
+          &secondLower_,
+          &secondMiddle_,
+          &secondUpper_})
+    {
+        weights->front() = weights->back() = T{0};
+    }
+
+    for (std::size_t i{1}; i + 1 < n; ++i)
+    {
+        const T hm{dx_[i - 1]};
+        const T hp{dx_[i]};
+        const T invSum{T{1} / (hm + hp)};
+
+        firstLower_[i] = -hp / hm * invSum;
+        firstMiddle_[i] = (hp - hm) / (hm * hp);
+        firstUpper_[i] = hm / hp * invSum;
+
+        secondLower_[i] = T{2} / hm * invSum;
+        secondMiddle_[i] = T{-2} / (hm * hp);
+        secondUpper_[i] = T{2} / hp * invSum;
+    }
+}
+
+template <std::floating_point T, std::size_t N>
+std::size_t Grid<T, N>::size() const noexcept
+{
+    return x_.size();
+}
+
 template <std::floating_point T, std::size_t N>
 std::span<const T> Grid<T, N>::x() const noexcept
 {
@@ -47,24 +122,24 @@ std::span<const T> Grid<T, N>::dx() const noexcept
 }
 
 template <std::floating_point T, std::size_t N>
-Grid<T, N> generateCenteredSinHGrid(T xMin, T xMax, T beta)
+Stencil<T> Grid<T, N>::firstDerivative() const noexcept
 {
-    constexpr T uniformThreshold{1e-10};
-
-    REQUIRE_NON_NEGATIVE(beta);
-    REQUIRE_CLOSE(xMin, -xMax, T{1e-12});
-
-    if (beta < std::abs(uniformThreshold))
-        return generateUniformGrid<T, N>(xMin, xMax);
+    return {firstLower_, firstMiddle_, firstUpper_};
+}
 
-    std::array<T, N> x{detail::generateUniformGrid<T, N>(T{-1.0}, T{1.0})};
+template <std::floating_point T, std::size_t N>
+Stencil<T> Grid<T, N>::secondDerivative() const noexcept
+{
+    return {secondLower_, secondMiddle_, secondUpper_};
+}
 
-    const T scale{xMax / std::sinh(beta)};
+template <std::floating_point T, std::size_t N>
+Grid<T, N> generateCenteredSinHGrid(T xMin, T xMax, T beta)
+{
+    std::array<T, N> x{};
 
-    for (std::size_t i{0}; i < N; ++i)
-    {
-        x[i] = scale * std::sinh(x[i] * beta);
-    }
+    if (!detail::fillCenteredSinH<T>(x, xMin, xMax, beta))
+        return generateUniformGrid<T, N>(xMin, xMax);
 
     return Grid<T, N>{x};
 }
@@ -73,8 +148,60 @@ template <std::floating_point T, std::size_t N>
 Grid<T, N> generateUniformGrid(T xMin, T xMax)
 {
     return Grid<T, N>{detail::generateUniformGrid<T, N>(xMin, xMax)};
-} // namespace uv::math::pde::detail
+}
+
+template <std::floating_point T>
+Grid<T> generateCenteredSinHGrid(std::size_t n, T xMin, T xMax, T beta)
+{
+    REQUIRE_GREATER(n, std::size_t{2});
+
+    Vector<T> x(n);
+
+    if (!detail::fillCenteredSinH<T>(x, xMin, xMax, beta))
+        return generateUniformGrid<T>(n, xMin, xMax);
+
+    return Grid<T>{x};
+}
+
+template <std::floating_point T>
+Grid<T> generateUniformGrid(std::size_t n, T xMin, T xMax)
+{
+    REQUIRE_GREATER(n, std::size_t{2});
+
+    Vector<T> x(n);
+    detail::fillUniform<T>(x, xMin, xMax);
+
+    return Grid<T>{x};
+}
+
+template <std::floating_point T, std::size_t N>
+Grid<T, N> generateConcentratedGrid(T xMin, T xMax, std::span<const T> centers, T beta)
+{
+    std::array<T, N> x{};
+
+    if (!detail::fillConcentrated<T>(x, xMin, xMax, centers, beta))
+        return generateUniformGrid<T, N>(xMin, xMax);
 
+    return Grid<T, N>{x};
+}
+
+template <std::floating_point T> Grid<T> generateConcentratedGrid(
+    std::size_t n,
+    T xMin,
+    T xMax,
+    std::span<const T> centers,
+    T beta
+)
+{
+    REQUIRE_GREATER(n, std::size_t{2});
+
+    Vector<T> x(n);
+
+    if (!detail::fillConcentrated<T>(x, xMin, xMax, centers, beta))
+        return generateUniformGrid<T>(n, xMin, xMax);
+
+    return Grid<T>{x};
+}
 } // namespace uv::math::pde
 
 namespace uv::math::pde::detail
@@ -82,19 +209,138 @@ namespace uv::math::pde::detail
 template <std::floating_point T, std::size_t N>
 std::array<T, N> generateUniformGrid(T xMin, T xMax)
 {
-    REQUIRE_GREATER(xMax, xMin);
     static_assert(N > 2, "Size of grid must be larger than 2");
 
-    const T range{xMax - xMin};
-    const T stepSize{range / static_cast<T>(N - 1)};
-
     std::array<T, N> x{};
+    fillUniform<T>(x, xMin, xMax);
+
+    return x;
+}
+
+template <std::floating_point T> void fillUniform(std::span<T> x, T xMin, T xMax)
+{
+    REQUIRE_GREATER(xMax, xMin);
+
+    const std::size_t n{x.size()};
+    const T range{xMax - xMin};
+    const T stepSize{range / static_cast<T>(n - 1)};
 
-    for (std::size_t i{0}; i < N; ++i)
+    for (std::size_t i{0}; i < n; ++i)
     {
         x[i] = xMin + stepSize * static_cast<T>(i);
     }
+}
 
-    return x;
+template <std::floating_point T>
+bool fillCenteredSinH(std::span<T> x, T xMin, T xMax, T beta)
+{
+    constexpr T uniformThreshold{1e-10};
+
+    REQUIRE_NON_NEGATIVE(beta);
+    REQUIRE_CLOSE(xMin, -xMax, T{1e-12});
+
+    if (beta < std::abs(uniformThreshold))
+        return false;
+
+    fillUniform<T>(x, T{-1.0}, T{1.0});
+
+    const T scale{xMax / std::sinh(beta)};
+
+    for (T& xi : x)
+    {
+        xi = scale * std::sinh(xi * beta);
+    }
+
+    return true;
+}
+
+// Inverts the closed-form cumulative density
+// F(x) = sum_k asinh((x - c_k) / alpha) - asinh((xMin - c_k) / alpha)
+// at equally spaced levels with safeguarded Newton steps.
+template <std::floating_point T>
+bool fillConcentrated(std::span<T> x, T xMin, T xMax, std::span<const T> centers, T beta)
+{
+    constexpr T uniformThreshold{1e-10};
+    constexpr std::size_t maxIterations{100};
+
+    REQUIRE_GREATER(xMax, xMin);
+    REQUIRE_NON_EMPTY(centers);
+    REQUIRE_FINITE(centers);
+    REQUIRE_EQUAL_OR_GREATER(centers, xMin);
+    REQUIRE_EQUAL_OR_LESS(centers, xMax);
+    REQUIRE_NON_NEGATIVE(beta);
+
+    if (beta < uniformThreshold)
+        return false;
+
+    const T alpha{(xMax - xMin) / (T{2} * std::sinh(beta))};
+    const T invAlpha{T{1} / alpha};
+    const T tolerance{T{64} * std::numeric_limits<T>::epsilon() * (xMax - xMin)};
+
+    const auto cumulative = [&](T value)
+    {
+        T total{0};
+
+        for (const T c : centers)
+            total += std::asinh((value - c) * invAlpha);
+
+        return total;
+    };
+
+    const auto density = [&](T value)
+    {
+        T total{0};
+
+        for (const T c : centers)
+        {
+            const T u{(value - c) * invAlpha};
+            total += invAlpha / std::sqrt(T{1} + u * u);
+        }
+
+        return total;
+    };
+
+    const std::size_t n{x.size()};
+    const T low{cumulative(xMin)};
+    const T range{cumulative(xMax) - low};
+
+    x.front() = xMin;
+    x.back() = xMax;
+
+    T lo{xMin};
+
+    for (std::size_t i{1}; i + 1 < n; ++i)
+    {
+        const T level{low + range * static_cast<T>(i) / static_cast<T>(n - 1)};
+
+        T hi{xMax};
+        T value{std::clamp(x[i - 1] + x[i - 1] - (i > 1 ? x[i - 2] : xMin), lo, hi)};
+
+        for (std::size_t iter{0}; iter < maxIterations; ++iter)
+        {
+            const T residual{cumulative(value) - level};
+
+            if (residual > T{0})
+                hi = value;
+            else
+                lo = value;
+
+            T next{value - residual / density(value)};
+
+            if (!(next > lo && next < hi))
+                next = T{0.5} * (lo + hi);
+
+            const bool converged{std::abs(next - value) <= tolerance};
+            value = next;
+
+            if (converged || hi - lo <= tolerance)
+                break;
+        }
+
+        x[i] = value;
+        lo = value;
+    }
+
+    return true;
 }
 } // namespace uv::math::pde::detail
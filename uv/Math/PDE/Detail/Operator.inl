@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Macros/Require.hpp"
+
+#include <functional>
+#include <utility>
+
+namespace uv::math::pde
+{
+template <std::floating_point T>
+TridiagonalOperator<T>::TridiagonalOperator(std::size_t n)
+    : lower_(n),
+      middle_(n),
+      upper_(n)
+{
+}
+
+template <std::floating_point T>
+template <typename Diffusion, typename Convection, typename Reaction>
+void TridiagonalOperator<T>::assemble(
+    std::span<const T> x,
+    Diffusion&& diffusion,
+    Convection&& convection,
+    Reaction&& reaction
+)
+{
+    REQUIRE_MIN_SIZE(x, 3);
+
+    const std::size_t n{x.size()};
+
+    lower_.resize(n);
+    middle_.resize(n);
+    upper_.resize(n);
+
+    lower_.front() = middle_.front() = upper_.front() = T{0};
+    lower_.back() = middle_.back() = upper_.back() = T{0};
+
+    auto&& a = std::forward<Diffusion>(diffusion);
+    auto&& b = std::forward<Convection>(convection);
+    auto&& c = std::forward<Reaction>(reaction);
+
+    for (std::size_t i{1}; i + 1 < n; ++i)
+    {
+        const T hm{x[i] - x[i - 1]};
+        const T hp{x[i + 1] - x[i]};
+        const T invSum{T{1} / (hm + hp)};
+
+        const T d1m{-hp / hm * invSum};
+        const T d10{(hp - hm) / (hm * hp)};
+        const T d1p{hm / hp * invSum};
+
+        const T d2m{T{2} / hm * invSum};
+        const T d20{T{-2} / (hm * hp)};
+        const T d2p{T{2} / hp * invSum};
+
+        const T ai{std::invoke(a, i)};
+        const T bi{std::invoke(b, i)};
+
+        lower_[i] = ai * d2m + bi * d1m;
+        middle_[i] = ai * d20 + bi * d10 + std::invoke(c, i);
+        upper_[i] = ai * d2p + bi * d1p;
+    }
+}
+
+template <std::floating_point T>
+template <std::size_t N, typename Diffusion, typename Convection, typename Reaction>
+void TridiagonalOperator<T>::assemble(
+    const Grid<T, N>& grid,
+    Diffusion&& diffusion,
+    Convection&& convection,
+    Reaction&& reaction
+)
+{
+    const std::size_t n{grid.size()};
+    const Stencil<T> first{grid.firstDerivative()};
+    const Stencil<T> second{grid.secondDerivative()};
+
+    lower_.resize(n);
+    middle_.resize(n);
+    upper_.resize(n);
+
+    lower_.front() = middle_.front() = upper_.front() = T{0};
+    lower_.back() = middle_.back() = upper_.back() = T{0};
+
+    auto&& a = std::forward<Diffusion>(diffusion);
+    auto&& b = std::forward<Convection>(convection);
+    auto&& c = std::forward<Reaction>(reaction);
+
+    for (std::size_t i{1}; i + 1 < n; ++i)
+    {
+        const T ai{std::invoke(a, i)};
+        const T bi{std::invoke(b, i)};
+
+        lower_[i] = ai * second.lower[i] + bi * first.lower[i];
+        middle_[i] = ai * second.middle[i] + bi * first.middle[i] + std::invoke(c, i);
+        upper_[i] = ai * second.upper[i] + bi * first.upper[i];
+    }
+}
+
+template <std::floating_point T> void TridiagonalOperator<T>::apply(
+    std::span<T> out,
+    std::span<const T> v,
+    T scale
+) const noexcept
+{
+    const std::size_t n{v.size()};
+
+    out[0] = v[0];
+    out[n - 1] = v[n - 1];
+
+    for (std::size_t i{1}; i + 1 < n; ++i)
+    {
+        const T lv{lower_[i] * v[i - 1] + middle_[i] * v[i] + upper_[i] * v[i + 1]};
+        out[i] = v[i] + scale * lv;
+    }
+}
+
+template <std::floating_point T> void TridiagonalOperator<T>::implicitSystem(
+    std::span<T> upper,
+    std::span<T> middle,
+    std::span<T> lower,
+    T scale
+) const noexcept
+{
+    const std::size_t n{middle_.size()};
+
+    for (std::size_t i{0}; i < n; ++i)
+    {
+        upper[i] = -scale * upper_[i];
+        middle[i] = T{1} - scale * middle_[i];
+        lower[i] = -scale * lower_[i];
+    }
+}
+
+template <std::floating_point T>
+std::size_t TridiagonalOperator<T>::size() const noexcept
+{
+    return middle_.size();
+}
+
+template <std::floating_point T>
+std::span<const T> TridiagonalOperator<T>::lower() const noexcept
+{
+    return lower_;
+}
+
+template <std::floating_point T>
+std::span<const T> TridiagonalOperator<T>::middle() const noexcept
+{
+    return middle_;
+}
+
+template <std::floating_point T>
+std::span<const T> TridiagonalOperator<T>::upper() const noexcept
+{
+    return upper_;
+}
+} // namespace uv::math::pde
@@ -0,0 +1,439 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Macros/Require.hpp"
+#include "Math/Interpolation/Hermite/Interpolator.hpp"
+#include "Math/LinearAlgebra/Tridiagonal.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <optional>
+#include <utility>
+
+namespace uv::math::pde::detail
+{
+template <std::floating_point T> T payoff(T z, bool isCall) noexcept;
+
+template <std::floating_point T>
+T deepInTheMoney(T z, T tau, T r, T q, bool isCall) noexcept;
+} // namespace uv::math::pde::detail
+
+namespace uv::math::pde
+{
+template <std::floating_point T>
+Pricer<T>::Pricer(const Config<T>& config)
+    : config_(config)
+{
+    validateConfig();
+}
+
+template <std::floating_point T> T Pricer<T>::price(
+    T t,
+    T r,
+    T q,
+    T vol,
+    T S,
+    T K,
+    bool isCall,
+    Exercise exercise,
+    std::span<const T> exerciseTimes
+)
+{
+    const std::array<T, 1> strikes{K};
+    std::array<T, 1> out{};
+
+    price(out, t, r, q, vol, S, strikes, isCall, exercise, exerciseTimes);
+
+    return out.front();
+}
+
+template <std::floating_point T> void Pricer<T>::price(
+    std::span<T> out,
+    T t,
+    T r,
+    T q,
+    T vol,
+    T S,
+    std::span<const T> strikes,
+    bool isCall,
+    Exercise exercise,
+    std::span<const T> exerciseTimes
+)
+{
+    validateContract(t, r, q, S, strikes, exercise, exerciseTimes);
+    REQUIRE_POSITIVE(vol);
+    REQUIRE_SAME_SIZE(out, strikes);
+
+    const Grid<T> grid{makeGrid(t, vol, S, strikes)};
+    const T variance{vol * vol};
+
+    setExerciseSteps(t, exercise, exerciseTimes);
+
+    march(
+        grid,
+        t,
+        r,
+        q,
+        isCall,
+        exercise,
+        [variance](T, std::size_t) { return variance; },
+        true
+    );
+
+    interpolate(out, grid.x(), S, strikes, isCall);
+}
+
+template <std::floating_point T>
+template <typename LocalVol>
+requires std::invocable<LocalVol&, T, T>
+T Pricer<T>::price(
+    T t,
+    T r,
+    T q,
+    LocalVol&& localVol,
+    T S,
+    T K,
+    bool isCall,
+    Exercise exercise,
+    std::span<const T> exerciseTimes
+)
+{
+    const std::array<T, 1> strikes{K};
+    std::array<T, 1> out{};
+
+    price(out, t, r, q, localVol, S, strikes, isCall, exercise, exerciseTimes);
+
+    return out.front();
+}
+
+template <std::floating_point T>
+template <typename LocalVol>
+requires std::invocable<LocalVol&, T, T>
+void Pricer<T>::price(
+    std::span<T> out,
+    T t,
+    T r,
+    T q,
+    LocalVol&& localVol,
+    T S,
+    std::span<const T> strikes,
+    bool isCall,
+    Exercise exercise,
+    std::span<const T> exerciseTimes
+)
+{
+    validateContract(t, r, q, S, strikes, exercise, exerciseTimes);
+    REQUIRE_SAME_SIZE(out, strikes);
+
+    const T volScale{std::max(
+        static_cast<T>(std::invoke(localVol, T{0}, S)),
+        static_cast<T>(std::invoke(localVol, t, S))
+    )};
+
+    REQUIRE_POSITIVE(volScale);
+
+    setExerciseSteps(t, exercise, exerciseTimes);
+
+    const T omega{isCall ? T{1} : T{-1}};
+    Vector<T> spots;
+
+    for (std::size_t j{0}; j < strikes.size(); ++j)
+    {
+        const std::span<const T> strike{strikes.subspan(j, 1)};
+        const Grid<T> grid{makeGrid(t, volScale, S, strike)};
+        const std::span<const T> z{grid.x()};
+
+        spots.resize(z.size());
+
+        for (std::size_t i{0}; i < z.size(); ++i)
+        {
+            spots[i] = strike.front() * std::exp(omega * z[i]);
+        }
+
+        march(
+            grid,
+            t,
+            r,
+            q,
+            isCall,
+            exercise,
+            [&](T tau, std::size_t i)
+            {
+                const T sigma{static_cast<T>(std::invoke(localVol, t - tau, spots[i]))};
+                return sigma * sigma;
+            },
+            false
+        );
+
+        interpolate(out.subspan(j, 1), z, S, strike, isCall);
+    }
+}
+
+template <std::floating_point T> const Config<T>& Pricer<T>::config() const noexcept
+{
+    return config_;
+}
+
+template <std::floating_point T> void Pricer<T>::validateConfig() const
+{
+    REQUIRE_GREATER(config_.numNodes, std::size_t{4});
+    REQUIRE_GREATER(config_.numTimeSteps, std::size_t{0});
+    REQUIRE_EQUAL_OR_LESS(config_.rannacherSteps, config_.numTimeSteps);
+    REQUIRE_POSITIVE(config_.numStdDevs);
+    REQUIRE_NON_NEGATIVE(config_.beta);
+}
+
+template <std::floating_point T> void Pricer<T>::validateContract(
+    T t,
+    T r,
+    T q,
+    T S,
+    std::span<const T> strikes,
+    Exercise exercise,
+    std::span<const T> exerciseTimes
+) const
+{
+    REQUIRE_POSITIVE(t);
+    REQUIRE_FINITE(r);
+    REQUIRE_FINITE(q);
+    REQUIRE_POSITIVE(S);
+    REQUIRE_NON_EMPTY(strikes);
+    REQUIRE_POSITIVE(strikes);
+
+    if (exercise == Exercise::Bermudan)
+    {
+        REQUIRE_NON_EMPTY(exerciseTimes);
+        REQUIRE_NON_NEGATIVE(exerciseTimes);
+        REQUIRE_EQUAL_OR_LESS(exerciseTimes, t);
+    }
+}
+
+template <std::floating_point T>
+Grid<T> Pricer<T>::makeGrid(T t, T volScale, T S, std::span<const T> strikes) const
+{
+    T moneynessRange{0};
+
+    for (const T K : strikes)
+    {
+        moneynessRange = std::max(moneynessRange, std::abs(std::log(S / K)));
+    }
+
+    const T zMax{moneynessRange + config_.numStdDevs * volScale * std::sqrt(t)};
+
+    return generateCenteredSinHGrid<T>(config_.numNodes | 1U, -zMax, zMax, config_.beta);
+}
+
+template <std::floating_point T> void Pricer<T>::setExerciseSteps(
+    T t,
+    Exercise exercise,
+    std::span<const T> exerciseTimes
+)
+{
+    const std::size_t numSteps{config_.numTimeSteps};
+
+    exerciseSteps_.assign(numSteps + 1, 0);
+
+    if (exercise != Exercise::Bermudan)
+        return;
+
+    const T dt{t / static_cast<T>(numSteps)};
+
+    for (const T exerciseTime : exerciseTimes)
+    {
+        const T step{std::round((t - exerciseTime) / dt)};
+        exerciseSteps_[std::min(static_cast<std::size_t>(step), numSteps)] = 1;
+    }
+}
+
+template <std::floating_point T>
+template <typename Variance>
+void Pricer<T>::march(
+    const Grid<T>& grid,
+    T t,
+    T r,
+    T q,
+    bool isCall,
+    Exercise exercise,
+    Variance&& variance,
+    bool timeHomogeneous
+)
+{
+    const std::span<const T> z{grid.x()};
+    const std::size_t n{z.size()};
+    const std::size_t last{n - 1};
+    const std::size_t numSteps{config_.numTimeSteps};
+    const std::size_t rannacherSteps{config_.rannacherSteps};
+    const bool american{exercise == Exercise::American};
+
+    const T dt{t / static_cast<T>(numSteps)};
+    const T halfDt{T{0.5} * dt};
+    const T omega{isCall ? T{1} : T{-1}};
+
+    for (Vector<T>* buffer :
+         {&values_, &rhs_, &payoff_, &upper_, &middle_, &lower_, &scratch_, &variance_})
+    {
+        buffer->resize(n);
+    }
+
+    for (std::size_t i{0}; i < n; ++i)
+    {
+        payoff_[i] = detail::payoff(z[i], isCall);
+    }
+
+    std::copy(payoff_.begin(), payoff_.end(), values_.begin());
+
+    const auto assembleAt = [&](T tau)
+    {
+        for (std::size_t i{0}; i < n; ++i)
+        {
+            variance_[i] = std::invoke(variance, tau, i);
+        }
+
+        operator_.assemble(
+            grid,
+            [&](std::size_t i) { return T{0.5} * variance_[i]; },
+            [&](std::size_t i) { return omega * (r - q - T{0.5} * variance_[i]); },
+            [&](std::size_t) { return -r; }
+        );
+    };
+
+    std::optional<linear_algebra::ThomasFactorization<T>> factorization;
+
+    if (timeHomogeneous)
+    {
+        assembleAt(T{0});
+        operator_.implicitSystem(upper_, middle_, lower_, halfDt);
+        factorization.emplace(upper_, middle_, lower_);
+    }
+
+    const auto implicitStep = [&](T tau, T scale)
+    {
+        const T boundary{detail::deepInTheMoney(z[last], tau, r, q, isCall)};
+
+        rhs_.front() = T{0};
+        rhs_.back() = (exercise == Exercise::European)
+                          ? boundary
+                          : std::max(boundary, payoff_.back());
+
+        if (timeHomogeneous)
+        {
+            if (american)
+                factorization->solveProjected(rhs_, payoff_);
+            else
+                factorization->solve(rhs_);
+        }
+        else
+        {
+            assembleAt(tau);
+            operator_.implicitSystem(upper_, middle_, lower_, scale);
+
+            if (american)
+            {
+                linear_algebra::brennanSchwartzSolve<T>(
+                    rhs_,
+                    upper_,
+                    middle_,
+                    lower_,
+                    payoff_,
+                    scratch_,
+                    false
+                );
+            }
+            else
+            {
+                linear_algebra::thomasSolve<T>(
+                    rhs_,
+                    upper_,
+                    middle_,
+                    lower_,
+                    scratch_,
+                    false
+                );
+            }
+        }
+
+        values_.swap(rhs_);
+    };
+
+    for (std::size_t step{0}; step < numSteps; ++step)
+    {
+        const T tau{static_cast<T>(step) * dt};
+
+        if (step < rannacherSteps)
+        {
+            std::copy(values_.begin(), values_.end(), rhs_.begin());
+            implicitStep(tau + halfDt, halfDt);
+
+            std::copy(values_.begin(), values_.end(), rhs_.begin());
+            implicitStep(tau + dt, halfDt);
+        }
+        else
+        {
+            if (!timeHomogeneous)
+                assembleAt(tau);
+
+            operator_.apply(rhs_, values_, halfDt);
+            implicitStep(tau + dt, halfDt);
+        }
+
+        if (exerciseSteps_[step + 1] != 0)
+        {
+            for (std::size_t i{0}; i < n; ++i)
+            {
+                values_[i] = std::max(values_[i], payoff_[i]);
+            }
+        }
+    }
+}
+
+template <std::floating_point T> void Pricer<T>::interpolate(
+    std::span<T> out,
+    std::span<const T> z,
+    T S,
+    std::span<const T> strikes,
+    bool isCall
+)
+{
+    const std::size_t m{strikes.size()};
+    const T omega{isCall ? T{1} : T{-1}};
+
+    points_.resize(m);
+    interpolated_.resize(m);
+
+    for (std::size_t j{0}; j < m; ++j)
+    {
+        points_[j] = omega * std::log(S / strikes[j]);
+    }
+
+    interp::hermite::PchipInterpolator<T>{}(
+        std::span<const T>{points_},
+        z,
+        std::span<const T>{values_},
+        std::span<T>{interpolated_},
+        false
+    );
+
+    for (std::size_t j{0}; j < m; ++j)
+    {
+        out[j] = strikes[j] * interpolated_[j];
+    }
+}
+} // namespace uv::math::pde
+
+namespace uv::math::pde::detail
+{
+template <std::floating_point T> T payoff(T z, bool isCall) noexcept
+{
+    return isCall ? std::max(std::exp(z) - T{1}, T{0})
+                  : std::max(T{1} - std::exp(-z), T{0});
+}
+
+template <std::floating_point T>
+T deepInTheMoney(T z, T tau, T r, T q, bool isCall) noexcept
+{
+    const T omega{isCall ? T{1} : T{-1}};
+
+    return omega * (std::exp(omega * z - q * tau) - std::exp(-r * tau));
+}
+} // namespace uv::math::pde::detail
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Types.hpp"
+#include "Core/Curve.hpp"
+#include "Core/Matrix.hpp"
+#include "Core/VolSurface.hpp"
+#include "Math/PDE/Config.hpp"
+#include "Math/PDE/Grid.hpp"
+#include "Math/PDE/Operator.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace uv::math::pde
+{
+template <std::floating_point T> class DupireSolver
+{
+  private:
+    Config<T> config_;
+
+    TridiagonalOperator<T> operator_;
+    Vector<T> values_;
+    Vector<T> rhs_;
+    Vector<T> upper_;
+    Vector<T> middle_;
+    Vector<T> lower_;
+    Vector<T> scratch_;
+    Vector<T> strikes_;
+    Vector<T> variance_;
+    Vector<T> points_;
+    Vector<T> interpolated_;
+
+    void validateConfig() const;
+
+    Grid<T> makeGrid(const core::VolSurface<T>& volSurface) const;
+
+    template <typename LocalVol> void assemble(
+        const Grid<T>& grid,
+        LocalVol& localVol,
+        std::span<const T> maturities,
+        std::span<const T> forwards,
+        T t
+    );
+
+    void interpolate(
+        std::span<T> out,
+        std::span<const T> x,
+        T dF,
+        T F,
+        std::span<const T> strikes
+    );
+
+  public:
+    explicit DupireSolver(const Config<T>& config = {});
+
+    template <typename LocalVol>
+    requires std::invocable<LocalVol&, T, T>
+    core::Matrix<T> callPrice(
+        const core::VolSurface<T>& volSurface,
+        const core::Curve<T>& curve,
+        LocalVol&& localVol
+    );
+
+    const Config<T>& config() const noexcept;
+};
+} // namespace uv::math::pde
+
+#include "Math/PDE/Detail/Dupire.inl"
@@ -2,29 +2,63 @@
 
 #pragma once
 
+#include "Base/Types.hpp"
+
 #include <array>
 #include <concepts>
 #include <cstddef>
 #include <span>
+#include <type_traits>
 
 namespace uv::math::pde
 {
+namespace detail
+{
+template <typename T, std::size_t N> using GridStorage =
+    std::conditional_t<N == std::dynamic_extent, Vector<T>, std::array<T, N>>;
+
+template <std::size_t N> inline constexpr std::size_t stepExtent{
+    N == std::dynamic_extent ? std::dynamic_extent : N - 1
+};
+} // namespace detail
+
+// Three-point weights of a derivative at every interior node: f'(x_i) or f''(x_i)
+// is lower[i] * f[i - 1] + middle[i] * f[i] + upper[i] * f[i + 1]. Boundary entries
+// are zero.
+template <std::floating_point T> struct Stencil
+{
+    std::span<const T> lower;
+    std::span<const T> middle;
+    std::span<const T> upper;
+};
 
-template <std::floating_point T, std::size_t N> class Grid
+template <std::floating_point T, std::size_t N = std::dynamic_extent> class Grid
 {
   private:
-    std::array<T, N> x_;
-    std::array<T, N - 1> dx_;
+    detail::GridStorage<T, N> x_;
+    detail::GridStorage<T, detail::stepExtent<N>> dx_;
+
+    detail::GridStorage<T, N> firstLower_;
+    detail::GridStorage<T, N> firstMiddle_;
+    detail::GridStorage<T, N> firstUpper_;
+    detail::GridStorage<T, N> secondLower_;
+    detail::GridStorage<T, N> secondMiddle_;
+    detail::GridStorage<T, N> secondUpper_;
 
     void validate() const;
     void setGridSteps() noexcept;
+    void setStencils() noexcept;
 
   public:
     Grid() = delete;
     explicit Grid(std::span<const T, N>);
 
+    std::size_t size() const noexcept;
     std::span<const T> x() const noexcept;
     std::span<const T> dx() const noexcept;
+
+    Stencil<T> firstDerivative() const noexcept;
+    Stencil<T> secondDerivative() const noexcept;
 };
 
 template <std::floating_point T, std::size_t N>
@@ -33,6 +67,26 @@ Grid<T, N> generateCenteredSinHGrid(T xMin, T xMax, T beta = 0);
 template <std::floating_point T, std::size_t N>
 Grid<T, N> generateUniformGrid(T xMin, T xMax);
 
+template <std::floating_point T>
+Grid<T> generateCenteredSinHGrid(std::size_t n, T xMin, T xMax, T beta = 0);
+
+template <std::floating_point T>
+Grid<T> generateUniformGrid(std::size_t n, T xMin, T xMax);
+
+// Clusters nodes around every point in centers with density proportional to
+// sum_k 1 / sqrt(alpha^2 + (x - c_k)^2), alpha = (xMax - xMin) / (2 sinh(beta)).
+// A single centre at zero on a symmetric range reproduces the centred sinh grid.
+template <std::floating_point T, std::size_t N>
+Grid<T, N> generateConcentratedGrid(T xMin, T xMax, std::span<const T> centers, T beta);
+
+template <std::floating_point T> Grid<T> generateConcentratedGrid(
+    std::size_t n,
+    T xMin,
+    T xMax,
+    std::span<const T> centers,
+    T beta
+);
+
 } // namespace uv::math::pde
 
 #include "Math/PDE/Detail/Grid.inl"
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Types.hpp"
+#include "Math/PDE/Grid.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace uv::math::pde
+{
+template <std::floating_point T> class TridiagonalOperator
+{
+  private:
+    Vector<T> lower_;
+    Vector<T> middle_;
+    Vector<T> upper_;
+
+  public:
+    TridiagonalOperator() = default;
+    explicit TridiagonalOperator(std::size_t n);
+
+    template <typename Diffusion, typename Convection, typename Reaction>
+    void assemble(
+        std::span<const T> x,
+        Diffusion&& diffusion,
+        Convection&& convection,
+        Reaction&& reaction
+    );
+
+    // Uses the stencil weights cached on the grid, so assembly is pure FMAs.
+    template <std::size_t N, typename Diffusion, typename Convection, typename Reaction>
+    void assemble(
+        const Grid<T, N>& grid,
+        Diffusion&& diffusion,
+        Convection&& convection,
+        Reaction&& reaction
+    );
+
+    void apply(std::span<T> out, std::span<const T> v, T scale) const noexcept;
+
+    void implicitSystem(
+        std::span<T> upper,
+        std::span<T> middle,
+        std::span<T> lower,
+        T scale
+    ) const noexcept;
+
+    std::size_t size() const noexcept;
+    std::span<const T> lower() const noexcept;
+    std::span<const T> middle() const noexcept;
+    std::span<const T> upper() const noexcept;
+};
+} // namespace uv::math::pde
+
+#include "Math/PDE/Detail/Operator.inl"
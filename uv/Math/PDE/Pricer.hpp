@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Types.hpp"
+#include "Math/PDE/Config.hpp"
+#include "Math/PDE/Grid.hpp"
+#include "Math/PDE/Operator.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace uv::math::pde
+{
+template <std::floating_point T> class Pricer
+{
+  private:
+    Config<T> config_;
+
+    TridiagonalOperator<T> operator_;
+    Vector<T> values_;
+    Vector<T> rhs_;
+    Vector<T> payoff_;
+    Vector<T> upper_;
+    Vector<T> middle_;
+    Vector<T> lower_;
+    Vector<T> scratch_;
+    Vector<T> variance_;
+    Vector<T> points_;
+    Vector<T> interpolated_;
+    Vector<char> exerciseSteps_;
+
+    void validateConfig() const;
+
+    void validateContract(
+        T t,
+        T r,
+        T q,
+        T S,
+        std::span<const T> strikes,
+        Exercise exercise,
+        std::span<const T> exerciseTimes
+    ) const;
+
+    Grid<T> makeGrid(T t, T volScale, T S, std::span<const T> strikes) const;
+
+    void setExerciseSteps(T t, Exercise exercise, std::span<const T> exerciseTimes);
+
+    template <typename Variance> void march(
+        const Grid<T>& grid,
+        T t,
+        T r,
+        T q,
+        bool isCall,
+        Exercise exercise,
+        Variance&& variance,
+        bool timeHomogeneous
+    );
+
+    void interpolate(
+        std::span<T> out,
+        std::span<const T> z,
+        T S,
+        std::span<const T> strikes,
+        bool isCall
+    );
+
+  public:
+    explicit Pricer(const Config<T>& config = {});
+
+    T price(
+        T t,
+        T r,
+        T q,
+        T vol,
+        T S,
+        T K,
+        bool isCall = true,
+        Exercise exercise = Exercise::European,
+        std::span<const T> exerciseTimes = {}
+    );
+
+    void price(
+        std::span<T> out,
+        T t,
+        T r,
+        T q,
+        T vol,
+        T S,
+        std::span<const T> strikes,
+        bool isCall = true,
+        Exercise exercise = Exercise::European,
+        std::span<const T> exerciseTimes = {}
+    );
+
+    template <typename LocalVol>
+    requires std::invocable<LocalVol&, T, T>
+    T price(
+        T t,
+        T r,
+        T q,
+        LocalVol&& localVol,
+        T S,
+        T K,
+        bool isCall = true,
+        Exercise exercise = Exercise::European,
+        std::span<const T> exerciseTimes = {}
+    );
+
+    template <typename LocalVol>
+    requires std::invocable<LocalVol&, T, T>
+    void price(
+        std::span<T> out,
+        T t,
+        T r,
+        T q,
+        LocalVol&& localVol,
+        T S,
+        std::span<const T> strikes,
+        bool isCall = true,
+        Exercise exercise = Exercise::European,
+        std::span<const T> exerciseTimes = {}
+    );
+
+    const Config<T>& config() const noexcept;
+};
+} // namespace uv::math::pde
+
+#include "Math/PDE/Detail/Pricer.inl"
@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstddef>
+
+namespace uv::math::random::detail
+{
+inline constexpr std::uint32_t philoxMultiplier0{0xD2511F53U};
+inline constexpr std::uint32_t philoxMultiplier1{0xCD9E8D57U};
+inline constexpr std::uint32_t philoxWeyl0{0x9E3779B9U};
+inline constexpr std::uint32_t philoxWeyl1{0xBB67AE85U};
+inline constexpr std::size_t philoxRounds{10};
+
+constexpr void philoxRound(PhiloxCounter& counter, const PhiloxKey& key) noexcept;
+} // namespace uv::math::random::detail
+
+namespace uv::math::random
+{
+constexpr Philox4x32::Philox4x32(std::uint64_t seed) noexcept
+    : key_{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)}
+{
+}
+
+constexpr Philox4x32::Philox4x32(const PhiloxKey& key) noexcept
+    : key_{key}
+{
+}
+
+constexpr PhiloxCounter
+Philox4x32::operator()(const PhiloxCounter& counter) const noexcept
+{
+    PhiloxCounter state{counter};
+    PhiloxKey key{key_};
+
+    for (std::size_t round{0}; round < detail::philoxRounds; ++round)
+    {
+        if (round > 0)
+        {
+            key[0] += detail::philoxWeyl0;
+            key[1] += detail::philoxWeyl1;
+        }
+
+        detail::philoxRound(state, key);
+    }
+
+    return state;
+}
+
+constexpr const PhiloxKey& Philox4x32::key() const noexcept
+{
+    return key_;
+}
+
+// Maps 52 random bits to the open interval (0, 1).
+template <std::floating_point T>
+constexpr T toUniform(std::uint32_t high, std::uint32_t low) noexcept
+{
+    constexpr T scale{T{1} / T{4503599627370496.0}};
+
+    const std::uint64_t bits{
+        ((static_cast<std::uint64_t>(high) << 32) | static_cast<std::uint64_t>(low)) >> 12
+    };
+
+    return (static_cast<T>(bits) + T{0.5}) * scale;
+}
+} // namespace uv::math::random
+
+namespace uv::math::random::detail
+{
+constexpr void philoxRound(PhiloxCounter& counter, const PhiloxKey& key) noexcept
+{
+    const std::uint64_t product0{
+        static_cast<std::uint64_t>(philoxMultiplier0) * std::uint64_t{counter[0]}
+    };
+    const std::uint64_t product1{
+        static_cast<std::uint64_t>(philoxMultiplier1) * std::uint64_t{counter[2]}
+    };
+
+    const auto high0{static_cast<std::uint32_t>(product0 >> 32)};
+    const auto low0{static_cast<std::uint32_t>(product0)};
+    const auto high1{static_cast<std::uint32_t>(product1 >> 32)};
+    const auto low1{static_cast<std::uint32_t>(product1)};
+
+    counter = {high1 ^ counter[1] ^ key[0], low1, high0 ^ counter[3] ^ key[1], low0};
+}
+} // namespace uv::math::random::detail
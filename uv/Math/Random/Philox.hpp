@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+
+namespace uv::math::random
+{
+using PhiloxCounter = std::array<std::uint32_t, 4>;
+using PhiloxKey = std::array<std::uint32_t, 2>;
+
+// Philox4x32-10 counter-based generator (Salmon et al. 2011): each counter maps to
+// four independent 32-bit words, so streams can be split without shared state.
+class Philox4x32
+{
+  private:
+    PhiloxKey key_;
+
+  public:
+    explicit constexpr Philox4x32(std::uint64_t seed) noexcept;
+    explicit constexpr Philox4x32(const PhiloxKey& key) noexcept;
+
+    constexpr PhiloxCounter operator()(const PhiloxCounter& counter) const noexcept;
+
+    constexpr const PhiloxKey& key() const noexcept;
+};
+
+template <std::floating_point T>
+constexpr T toUniform(std::uint32_t high, std::uint32_t low) noexcept;
+
+} // namespace uv::math::random
+
+#include "Math/Random/Detail/Philox.inl"
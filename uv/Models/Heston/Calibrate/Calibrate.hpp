@@ -8,6 +8,7 @@
 #include "Models/Heston/Params.hpp"
 #include "Models/Heston/Price/Pricer.hpp"
 #include "Optimization/Ceres/Config.hpp"
+#include "Optimization/Stop.hpp"
 
 #include <concepts>
 #include <cstddef>
@@ -36,6 +37,31 @@ Params<T> calibrate(
     const Config& config,
     price::Pricer<T, N>& pricer
 );
+
+// Same as calibrate, but also reports how the solve ended. When config.stop fires
+// the parameters are the best accepted iterate and the termination says so.
+template <
+    std::floating_point T,
+    std::size_t N = defaultNodes,
+    opt::ceres::GradientMode Mode = HestonGradient,
+    typename Policy = HestonPolicy>
+opt::Result<Params<T>> calibrateWithStatus(
+    const core::VolSurface<T>& volSurface,
+    const core::Curve<T>& curve,
+    const Config& config = {}
+);
+
+template <
+    std::floating_point T,
+    std::size_t N,
+    opt::ceres::GradientMode Mode = HestonGradient,
+    typename Policy = HestonPolicy>
+opt::Result<Params<T>> calibrateWithStatus(
+    const core::VolSurface<T>& volSurface,
+    const core::Curve<T>& curve,
+    const Config& config,
+    price::Pricer<T, N>& pricer
+);
 } // namespace uv::models::heston::calibrate
 
 #include "Models/Heston/Calibrate/Detail/Calibrate.inl"
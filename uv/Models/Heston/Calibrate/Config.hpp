@@ -2,11 +2,14 @@
 
 #pragma once
 
+#include "Models/Heston/Params.hpp"
 #include "Optimization/Ceres/Config.hpp"
 #include "Optimization/Ceres/Policy.hpp"
 #include "Optimization/Cost.hpp"
+#include "Optimization/Stop.hpp"
 
 #include <cstddef>
+#include <optional>
 
 namespace uv::models::heston::calibrate
 {
@@ -18,6 +21,10 @@ struct Config
     opt::ceres::Verbosity verbosity{opt::ceres::Verbosity::Summary};
     opt::cost::WeightATM<double> weightATM{};
     int numThreads{-1};
+    opt::StopCondition stop{};
+    // Starts the solve from these parameters instead of the default guess, e.g. the
+    // previous calibration when only a few quotes have moved.
+    std::optional<Params<double>> warmStart{};
 };
 
 inline constexpr opt::ceres::GradientMode HestonGradient =
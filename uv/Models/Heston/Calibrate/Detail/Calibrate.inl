@@ -1,5 +1,6 @@
 ﻿// SPDX-License-Identifier: Apache-2.0
 
+#include "Base/Macros/Profile.hpp"
 #include "Core/Matrix.hpp"
 #include "Math/Functions/Black.hpp"
 #include "Math/LinearAlgebra/MatrixOps.hpp"
@@ -32,7 +33,8 @@ opt::ceres::Optimizer<Policy> makeOptimizer(const Config& config)
         .gradientTol = config.tolerance,
         .paramNames = {"kappa", "theta", "sigma", "rho", "v0"},
         .verbosity = config.verbosity,
-        .numThreads = config.numThreads
+        .numThreads = config.numThreads,
+        .stop = config.stop
     }};
 }
 
@@ -45,7 +47,7 @@ Params<T> calibrate(
     const core::VolSurface<T>& volSurface,
     const core::Curve<T>& curve,
     opt::ceres::Optimizer<Policy>& optimizer,
-    const opt::cost::WeightATM<double>& weightATM,
+    const Config& config,
     price::Pricer<T, N>& pricer
 );
 
@@ -57,7 +59,7 @@ template <
 Params<T> calibrate(
     const CalibrationData<T>& data,
     opt::ceres::Optimizer<Policy>& optimizer,
-    const opt::cost::WeightATM<double>& weightATM,
+    const Config& config,
     price::Pricer<T, N>& pricer
 );
 
@@ -69,7 +71,7 @@ template <
 Params<double> calibrateDouble(
     const CalibrationData<double>& data,
     opt::ceres::Optimizer<Policy>& optimizer,
-    const opt::cost::WeightATM<double>& weightATM,
+    const Config& config,
     price::Pricer<CalcT, N>& pricer
 );
 } // namespace uv::models::heston::calibrate::detail
@@ -87,17 +89,40 @@ Params<T> calibrate(
     const core::Curve<T>& curve,
     const Config& config
 )
+{
+    return calibrateWithStatus<T, N, Mode, Policy>(volSurface, curve, config).params;
+}
+
+template <
+    std::floating_point T,
+    std::size_t N,
+    opt::ceres::GradientMode Mode,
+    typename Policy>
+Params<T> calibrate(
+    const core::VolSurface<T>& volSurface,
+    const core::Curve<T>& curve,
+    const Config& config,
+    price::Pricer<T, N>& pricer
+)
+{
+    return calibrateWithStatus<T, N, Mode, Policy>(volSurface, curve, config, pricer)
+        .params;
+}
+
+template <
+    std::floating_point T,
+    std::size_t N,
+    opt::ceres::GradientMode Mode,
+    typename Policy>
+opt::Result<Params<T>> calibrateWithStatus(
+    const core::VolSurface<T>& volSurface,
+    const core::Curve<T>& curve,
+    const Config& config
+)
 {
     price::Pricer<T, N> pricer{};
-    opt::ceres::Optimizer<Policy> optimizer{detail::makeOptimizer<Policy>(config)};
 
-    return detail::calibrate<T, N, Mode, Policy>(
-        volSurface,
-        curve,
-        optimizer,
-        config.weightATM,
-        pricer
-    );
+    return calibrateWithStatus<T, N, Mode, Policy>(volSurface, curve, config, pricer);
 }
 
 template <
@@ -105,7 +130,7 @@ template <
     std::size_t N,
     opt::ceres::GradientMode Mode,
     typename Policy>
-Params<T> calibrate(
+opt::Result<Params<T>> calibrateWithStatus(
     const core::VolSurface<T>& volSurface,
     const core::Curve<T>& curve,
     const Config& config,
@@ -114,13 +139,18 @@ Params<T> calibrate(
 {
     opt::ceres::Optimizer<Policy> optimizer{detail::makeOptimizer<Policy>(config)};
 
-    return detail::calibrate<T, N, Mode, Policy>(
+    const Params<T> params{detail::calibrate<T, N, Mode, Policy>(
         volSurface,
         curve,
         optimizer,
-        config.weightATM,
+        config,
         pricer
-    );
+    )};
+
+    return opt::Result<Params<T>>{
+        .params = params,
+        .termination = optimizer.termination()
+    };
 }
 
 } // namespace uv::models::heston::calibrate
@@ -137,7 +167,7 @@ Params<T> calibrate(
     const core::VolSurface<T>& volSurface,
     const core::Curve<T>& curve,
     opt::ceres::Optimizer<Policy>& optimizer,
-    const opt::cost::WeightATM<double>& weightATM,
+    const Config& config,
     price::Pricer<T, N>& pricer
 )
 {
@@ -152,7 +182,7 @@ Params<T> calibrate(
         .vol = volSurface.vol()
     };
 
-    return calibrate<T, N, Mode, Policy>(data, optimizer, weightATM, pricer);
+    return calibrate<T, N, Mode, Policy>(data, optimizer, config, pricer);
 }
 
 template <
@@ -163,13 +193,13 @@ template <
 Params<T> calibrate(
     const CalibrationData<T>& data,
     opt::ceres::Optimizer<Policy>& optimizer,
-    const opt::cost::WeightATM<double>& weightATM,
+    const Config& config,
     price::Pricer<T, N>& pricer
 )
 {
     if constexpr (std::is_same_v<T, double>)
     {
-        return calibrateDouble<T, N, Mode, Policy>(data, optimizer, weightATM, pricer);
+        return calibrateDouble<T, N, Mode, Policy>(data, optimizer, config, pricer);
     }
 
     const Vector<double> maturities{convertVector<double>(data.maturities)};
@@ -185,7 +215,7 @@ Params<T> calibrate(
         .vol = vol
     };
 
-    return calibrateDouble<T, N, Mode, Policy>(converted, optimizer, weightATM, pricer)
+    return calibrateDouble<T, N, Mode, Policy>(converted, optimizer, config, pricer)
         .template as<T>();
 }
 
@@ -197,11 +227,13 @@ template <
 Params<double> calibrateDouble(
     const CalibrationData<double>& data,
     opt::ceres::Optimizer<Policy>& optimizer,
-    const opt::cost::WeightATM<double>& weightATM,
+    const Config& config,
     price::Pricer<CalcT, N>& pricer
 )
 {
-    setGuessBounds(optimizer);
+    PROFILE_ZONE("heston::calibrate");
+
+    setGuessBounds(optimizer, config.warmStart ? &*config.warmStart : nullptr);
 
     optimizer.beginRun();
 
@@ -211,7 +243,7 @@ Params<double> calibrateDouble(
         data.forwards,
         data.strikes,
         data.vol,
-        weightATM
+        config.weightATM
     )};
 
     for (const auto& s : slices)
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Models/Heston/Params.hpp"
 #include "Optimization/Ceres/Optimizer.hpp"
 
 #include <array>
@@ -42,9 +43,22 @@ namespace uv::models::heston::calibrate::detail
     };
 }
 
-template <typename Policy> void setGuessBounds(opt::ceres::Optimizer<Policy>& optimizer)
+[[nodiscard]] constexpr std::array<double, 5> warmGuess(const Params<double>& p) noexcept
 {
-    optimizer.initialize(initGuess(), lowerBounds(), upperBounds());
+    return {p.kappa, p.theta, p.sigma, p.rho, p.v0};
+}
+
+// Warm starts are clamped into the bounds by the optimizer.
+template <typename Policy> void setGuessBounds(
+    opt::ceres::Optimizer<Policy>& optimizer,
+    const Params<double>* warmStart = nullptr
+)
+{
+    optimizer.initialize(
+        warmStart ? warmGuess(*warmStart) : initGuess(),
+        lowerBounds(),
+        upperBounds()
+    );
 }
 
 } // namespace uv::models::heston::calibrate::detail
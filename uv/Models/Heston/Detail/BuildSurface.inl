@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 
+#include "Base/Macros/Profile.hpp"
 #include "Base/Macros/Require.hpp"
 #include "Core/Generate.hpp"
 #include "Core/Matrix.hpp"
@@ -16,6 +17,8 @@ template <std::floating_point T, std::size_t N> core::VolSurface<T> buildSurface
     const calibrate::Config& config
 )
 {
+    PROFILE_ZONE("heston::buildSurface");
+
     price::Pricer<T, N> pricer{};
 
     pricer.setParams(calibrate::calibrate(volSurface, curve, config, pricer));
@@ -37,6 +40,8 @@ template <std::floating_point T, std::size_t N> core::VolSurface<T> buildSurface
     const price::Pricer<T, N>& pricer
 )
 {
+    PROFILE_ZONE("heston::priceSurface");
+
     return core::generateVolSurface(
         volSurface,
         math::vol::impliedVol(pricer.callPrice(volSurface, curve), volSurface, curve)
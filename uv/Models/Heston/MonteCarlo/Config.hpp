@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+namespace uv::models::heston::mc
+{
+template <std::floating_point T> struct Config
+{
+    std::size_t numPaths{std::size_t{1} << 16};
+    std::size_t numSteps{100};
+    // Paths are simulated in fixed blocks; the random stream of a path depends only
+    // on its block and slot, so results do not depend on the thread count.
+    std::size_t blockSize{512};
+    std::uint64_t seed{0x5EED5EED5EED5EEDULL};
+    bool antithetic{true};
+    bool controlVariate{true};
+    // Andersen (2008) switching level between the quadratic and exponential branches.
+    T psiCritical{T{1.5}};
+    int numThreads{-1};
+};
+
+template <std::floating_point T> struct Result
+{
+    T price;
+    T standardError;
+};
+} // namespace uv::models::heston::mc
@@ -0,0 +1,366 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Errors/Errors.hpp"
+#include "Base/Execution/Parallel.hpp"
+#include "Base/Execution/ThreadPolicy.hpp"
+#include "Base/Macros/Require.hpp"
+#include "Math/Functions/Primitive.hpp"
+#include "Models/Heston/Price/Pricer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+namespace uv::models::heston::mc
+{
+template <std::floating_point T>
+Pricer<T>::Pricer(const Config<T>& config)
+    : config_(config),
+      philox_(config.seed),
+      numWorkers_(static_cast<std::size_t>(execution::requestThreads(config.numThreads)))
+{
+    validateConfig();
+}
+
+template <std::floating_point T>
+Result<T> Pricer<T>::callPrice(T t, T r, T q, T S, T K, bool isCall)
+{
+    REQUIRE_POSITIVE(K);
+
+    auto payoff = [K, isCall](std::span<const T> path)
+    {
+        const T ST{path.back()};
+        return std::max(isCall ? ST - K : K - ST, T{0});
+    };
+
+    return run(t, r, q, S, payoff, std::nullopt);
+}
+
+template <std::floating_point T>
+template <typename Payoff>
+requires std::invocable<Payoff&, std::span<const T>>
+Result<T> Pricer<T>::price(
+    T t,
+    T r,
+    T q,
+    T S,
+    Payoff&& payoff,
+    std::optional<T> controlStrike
+)
+{
+    std::optional<T> strike;
+
+    if (config_.controlVariate)
+    {
+        strike = controlStrike.value_or(S * std::exp((r - q) * t));
+        REQUIRE_POSITIVE(*strike);
+    }
+
+    return run(t, r, q, S, payoff, strike);
+}
+
+template <std::floating_point T> void Pricer<T>::setParams(const Params<T>& params)
+{
+    REQUIRE_POSITIVE(params.kappa);
+    REQUIRE_POSITIVE(params.theta);
+    REQUIRE_POSITIVE(params.sigma);
+    REQUIRE_EQUAL_OR_LESS(std::abs(params.rho), T{1});
+    REQUIRE_NON_NEGATIVE(params.v0);
+
+    params_ = params;
+}
+
+template <std::floating_point T> const Config<T>& Pricer<T>::config() const noexcept
+{
+    return config_;
+}
+
+template <std::floating_point T> void Pricer<T>::validateConfig() const
+{
+    REQUIRE_GREATER(config_.numPaths, std::size_t{1});
+    REQUIRE_GREATER(config_.numSteps, std::size_t{0});
+    REQUIRE_GREATER(config_.blockSize, std::size_t{1});
+    REQUIRE_EQUAL_OR_LESS(T{1}, config_.psiCritical);
+    REQUIRE_EQUAL_OR_LESS(config_.psiCritical, T{2});
+
+    if (config_.antithetic &&
+        (config_.numPaths % 2 != 0 || config_.blockSize % 2 != 0)) [[unlikely]]
+    {
+        errors::raise(
+            errors::ErrorCode::InvalidArgument,
+            "numPaths and blockSize must be even with antithetic variates"
+        );
+    }
+}
+
+template <std::floating_point T>
+void Pricer<T>::validateContract(T t, T r, T q, T S) const
+{
+    if (!params_.has_value()) [[unlikely]]
+    {
+        errors::raise(errors::ErrorCode::InvalidState, "params_ must be set");
+    }
+
+    REQUIRE_POSITIVE(t);
+    REQUIRE_FINITE(r);
+    REQUIRE_FINITE(q);
+    REQUIRE_POSITIVE(S);
+}
+
+// Andersen (2008) QE moments and the central (gamma1 = gamma2 = 1/2) log-spot scheme.
+template <std::floating_point T>
+typename Pricer<T>::Step Pricer<T>::makeStep(T t, T r, T q) const noexcept
+{
+    const auto& [kappa, theta, sigma, rho, v0] = *params_;
+
+    const T dt{t / static_cast<T>(config_.numSteps)};
+    const T decay{std::exp(-kappa * dt)};
+    const T sigma2{sigma * sigma};
+    const T half{T{0.5} * dt};
+    const T tilt{kappa * rho / sigma - T{0.5}};
+
+    return Step{
+        (r - q) * dt,
+        decay,
+        sigma2 * decay * (T{1} - decay) / kappa,
+        theta * sigma2 * (T{1} - decay) * (T{1} - decay) / (T{2} * kappa),
+        -rho * kappa * theta * dt / sigma,
+        half * tilt - rho / sigma,
+        half * tilt + rho / sigma,
+        half * (T{1} - rho * rho),
+        half * (T{1} - rho * rho)
+    };
+}
+
+template <std::floating_point T>
+void Pricer<T>::advance(Arena& arena, const Step& step, std::size_t p, T u, T z)
+    const noexcept
+{
+    const T theta{params_->theta};
+    const T v{arena.variance[p]};
+
+    const T mean{theta + (v - theta) * step.decay};
+    const T psi{(v * step.varianceLinear + step.varianceConstant) / (mean * mean)};
+
+    T next;
+
+    if (psi <= config_.psiCritical)
+    {
+        const T invPsi{T{2} / psi};
+        const T b2{invPsi - T{1} + std::sqrt(invPsi * (invPsi - T{1}))};
+        const T shifted{std::sqrt(b2) + math::normalInvCDF(u)};
+
+        next = mean / (T{1} + b2) * shifted * shifted;
+    }
+    else
+    {
+        const T mass{(psi - T{1}) / (psi + T{1})};
+
+        next = (u <= mass) ? T{0}
+                           : std::log((T{1} - mass) / (T{1} - u)) * mean / (T{1} - mass);
+    }
+
+    const T diffusion{std::max(step.k3 * v + step.k4 * next, T{0})};
+
+    arena.logSpot[p] += step.drift + step.k0 + step.k1 * v + step.k2 * next +
+                        std::sqrt(diffusion) * z;
+    arena.variance[p] = next;
+}
+
+template <std::floating_point T>
+template <typename Payoff>
+typename Pricer<T>::Moments Pricer<T>::simulateBlock(
+    Arena& arena,
+    std::size_t block,
+    const Step& step,
+    T S,
+    T discount,
+    std::optional<T> controlStrike,
+    Payoff& payoff
+) const
+{
+    const std::size_t width{config_.blockSize};
+    const std::size_t numSteps{config_.numSteps};
+    const std::size_t first{block * width};
+    const std::size_t count{std::min(width, config_.numPaths - first)};
+    const bool antithetic{config_.antithetic};
+    const std::size_t numDraws{antithetic ? count / 2 : count};
+
+    std::fill_n(arena.logSpot.begin(), count, std::log(S));
+    std::fill_n(arena.variance.begin(), count, params_->v0);
+    std::fill_n(arena.paths.begin(), count, S);
+
+    const auto blockLow{static_cast<std::uint32_t>(block)};
+    const auto blockHigh{static_cast<std::uint32_t>(std::uint64_t{block} >> 32)};
+
+    for (std::size_t n{0}; n < numSteps; ++n)
+    {
+        for (std::size_t j{0}; j < numDraws; ++j)
+        {
+            const math::random::PhiloxCounter bits{philox_(
+                {static_cast<std::uint32_t>(j),
+                 static_cast<std::uint32_t>(n),
+                 blockLow,
+                 blockHigh}
+            )};
+
+            const T u{math::random::toUniform<T>(bits[0], bits[1])};
+            const T z{math::normalInvCDF(math::random::toUniform<T>(bits[2], bits[3]))};
+
+            advance(arena, step, j, u, z);
+
+            if (antithetic)
+                advance(arena, step, j + numDraws, T{1} - u, -z);
+        }
+
+        T* __restrict row{arena.paths.data() + (n + 1) * width};
+        const T* __restrict logSpot{arena.logSpot.data()};
+
+        for (std::size_t p{0}; p < count; ++p)
+            row[p] = std::exp(logSpot[p]);
+    }
+
+    const T* __restrict terminal{arena.paths.data() + numSteps * width};
+
+    const std::span<const T> path{arena.path};
+
+    for (std::size_t p{0}; p < count; ++p)
+    {
+        for (std::size_t n{0}; n <= numSteps; ++n)
+            arena.path[n] = arena.paths[n * width + p];
+
+        arena.payoffs[p] = discount * static_cast<T>(std::invoke(payoff, path));
+        arena.controls[p] = controlStrike
+                                ? discount * std::max(terminal[p] - *controlStrike, T{0})
+                                : T{0};
+    }
+
+    Moments moments;
+    const std::size_t numSamples{antithetic ? numDraws : count};
+
+    for (std::size_t k{0}; k < numSamples; ++k)
+    {
+        T y{arena.payoffs[k]};
+        T x{arena.controls[k]};
+
+        if (antithetic)
+        {
+            y = T{0.5} * (y + arena.payoffs[k + numDraws]);
+            x = T{0.5} * (x + arena.controls[k + numDraws]);
+        }
+
+        moments.sum += y;
+        moments.sumSquares += y * y;
+        moments.control += x;
+        moments.controlSquares += x * x;
+        moments.cross += x * y;
+    }
+
+    moments.count = numSamples;
+
+    return moments;
+}
+
+template <std::floating_point T>
+template <typename Payoff>
+Result<T> Pricer<T>::run(
+    T t,
+    T r,
+    T q,
+    T S,
+    Payoff& payoff,
+    std::optional<T> controlStrike
+)
+{
+    validateContract(t, r, q, S);
+
+    const std::size_t width{config_.blockSize};
+    const std::size_t numBlocks{(config_.numPaths + width - 1) / width};
+    const std::size_t numWorkers{std::min(numWorkers_, numBlocks)};
+    const std::size_t numNodes{config_.numSteps + 1};
+
+    arenas_.resize(numWorkers);
+    moments_.assign(numBlocks, Moments{});
+
+    const Step step{makeStep(t, r, q)};
+    const T discount{std::exp(-r * t)};
+
+    // Blocks are dealt round-robin to workers; each block writes its own moments,
+    // which are then reduced in block order so the sum is bit-reproducible.
+    execution::parallelFor(
+        0,
+        numWorkers,
+        [&](std::size_t worker)
+        {
+            // Sized by the worker so first touch places the arena on its node.
+            Arena& arena{arenas_[worker]};
+
+            for (Vector<T>* buffer :
+                 {&arena.logSpot, &arena.variance, &arena.payoffs, &arena.controls})
+            {
+                buffer->resize(width);
+            }
+
+            arena.paths.resize(numNodes * width);
+            arena.path.resize(numNodes);
+
+            for (std::size_t block{worker}; block < numBlocks; block += numWorkers)
+            {
+                moments_[block] = simulateBlock(
+                    arena,
+                    block,
+                    step,
+                    S,
+                    discount,
+                    controlStrike,
+                    payoff
+                );
+            }
+        },
+        static_cast<int>(numWorkers)
+    );
+
+    Moments total;
+
+    for (const Moments& moments : moments_)
+    {
+        total.sum += moments.sum;
+        total.sumSquares += moments.sumSquares;
+        total.control += moments.control;
+        total.controlSquares += moments.controlSquares;
+        total.cross += moments.cross;
+        total.count += moments.count;
+    }
+
+    const T n{static_cast<T>(total.count)};
+    const T mean{total.sum / n};
+    T variance{(total.sumSquares - n * mean * mean) / (n - T{1})};
+    T estimate{mean};
+
+    if (controlStrike)
+    {
+        price::Pricer<T> fourier;
+        fourier.setParams(*params_);
+
+        const T forward{S * std::exp((r - q) * t)};
+        const T expected{fourier.callPrice(t, discount, forward, *controlStrike)};
+        const T controlMean{total.control / n};
+        const T controlVariance{
+            (total.controlSquares - n * controlMean * controlMean) / (n - T{1})
+        };
+        const T covariance{(total.cross - n * controlMean * mean) / (n - T{1})};
+
+        if (controlVariance > T{0})
+        {
+            const T beta{covariance / controlVariance};
+
+            estimate -= beta * (controlMean - expected);
+            variance -= beta * covariance;
+        }
+    }
+
+    return Result<T>{estimate, std::sqrt(std::max(variance, T{0}) / n)};
+}
+} // namespace uv::models::heston::mc
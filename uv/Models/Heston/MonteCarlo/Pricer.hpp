@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Types.hpp"
+#include "Math/Random/Philox.hpp"
+#include "Models/Heston/MonteCarlo/Config.hpp"
+#include "Models/Heston/Params.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <span>
+
+namespace uv::models::heston::mc
+{
+template <std::floating_point T> class Pricer
+{
+  private:
+    // Per-worker scratch reused across calls. Spot paths are stored step-major as
+    // [step * blockSize + path] so that every time step is one contiguous sweep.
+    struct Arena
+    {
+        Vector<T> logSpot;
+        Vector<T> variance;
+        Vector<T> paths;
+        Vector<T> path;
+        Vector<T> payoffs;
+        Vector<T> controls;
+    };
+
+    struct Moments
+    {
+        T sum{0};
+        T sumSquares{0};
+        T control{0};
+        T controlSquares{0};
+        T cross{0};
+        std::size_t count{0};
+    };
+
+    struct Step
+    {
+        T drift;
+        T decay;
+        T varianceLinear;
+        T varianceConstant;
+        T k0;
+        T k1;
+        T k2;
+        T k3;
+        T k4;
+    };
+
+    Config<T> config_;
+    math::random::Philox4x32 philox_;
+    std::size_t numWorkers_;
+    std::optional<Params<T>> params_;
+
+    Vector<Arena> arenas_;
+    Vector<Moments> moments_;
+
+    void validateConfig() const;
+    void validateContract(T t, T r, T q, T S) const;
+
+    Step makeStep(T t, T r, T q) const noexcept;
+
+    void advance(Arena& arena, const Step& step, std::size_t p, T u, T z) const noexcept;
+
+    template <typename Payoff>
+    Moments simulateBlock(
+        Arena& arena,
+        std::size_t block,
+        const Step& step,
+        T S,
+        T discount,
+        std::optional<T> controlStrike,
+        Payoff& payoff
+    ) const;
+
+    template <typename Payoff>
+    Result<T> run(T t, T r, T q, T S, Payoff& payoff, std::optional<T> controlStrike);
+
+  public:
+    explicit Pricer(const Config<T>& config = {});
+
+    Result<T> callPrice(T t, T r, T q, T S, T K, bool isCall = true);
+
+    // Prices a payoff on the spot path S(t_0), ..., S(t_N). With controlVariate set,
+    // a European call struck at controlStrike (default: the forward) priced by the
+    // Fourier pricer is used as control.
+    template <typename Payoff>
+    requires std::invocable<Payoff&, std::span<const T>>
+    Result<T> price(
+        T t,
+        T r,
+        T q,
+        T S,
+        Payoff&& payoff,
+        std::optional<T> controlStrike = std::nullopt
+    );
+
+    void setParams(const Params<T>& params);
+
+    const Config<T>& config() const noexcept;
+};
+} // namespace uv::models::heston::mc
+
+#include "Models/Heston/MonteCarlo/Detail/Pricer.inl"
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <optional>
+
+namespace uv::models::heston::pde
+{
+enum class Scheme
+{
+    Douglas,
+    CraigSneyd,
+    ModifiedCraigSneyd,
+    HundsdorferVerwer
+};
+
+template <std::floating_point T> struct Config
+{
+    std::size_t numSpotNodes{200};
+    std::size_t numVarianceNodes{100};
+    std::size_t numTimeSteps{100};
+    std::size_t dampingSteps{2};
+    Scheme scheme{Scheme::HundsdorferVerwer};
+    std::optional<T> schemeTheta{};
+    T numStdDevs{T{5}};
+    T maxVariance{T{1}};
+    T spotBeta{T{2}};
+    T varianceBeta{T{5}};
+    int numThreads{1};
+};
+
+// Hout & Foulon (2010) parameter choices for stability with a mixed derivative.
+template <std::floating_point T> constexpr T defaultSchemeTheta(Scheme scheme) noexcept
+{
+    switch (scheme)
+    {
+    case Scheme::ModifiedCraigSneyd:
+        return T{1} / T{3};
+    case Scheme::HundsdorferVerwer:
+        return T{0.5} + T{0.28867513459481288225};
+    case Scheme::Douglas:
+    case Scheme::CraigSneyd:
+        break;
+    }
+
+    return T{0.5};
+}
+
+} // namespace uv::models::heston::pde
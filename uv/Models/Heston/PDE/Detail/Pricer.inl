@@ -0,0 +1,667 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Errors/Errors.hpp"
+#include "Base/Execution/Parallel.hpp"
+#include "Base/Execution/ThreadPolicy.hpp"
+#include "Base/Macros/Require.hpp"
+#include "Math/Interpolation/Hermite/Interpolator.hpp"
+#include "Math/PDE/Operator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <utility>
+
+namespace uv::models::heston::pde::detail
+{
+template <std::floating_point T>
+T deepInTheMoney(T S, T K, T tau, T r, T q, bool isCall, bool canExercise) noexcept;
+} // namespace uv::models::heston::pde::detail
+
+namespace uv::models::heston::pde
+{
+template <std::floating_point T>
+Pricer<T>::Pricer(const Config<T>& config)
+    : config_(config),
+      schemeTheta_(config.schemeTheta.value_or(defaultSchemeTheta<T>(config.scheme))),
+      numWorkers_(static_cast<std::size_t>(execution::requestThreads(config.numThreads)))
+{
+    validateConfig();
+}
+
+template <std::floating_point T> T Pricer<T>::price(
+    T t,
+    T r,
+    T q,
+    T S,
+    T K,
+    bool isCall,
+    Exercise exercise,
+    std::span<const T> exerciseTimes
+)
+{
+    if (!params_.has_value()) [[unlikely]]
+    {
+        errors::raise(errors::ErrorCode::InvalidState, "params_ must be set");
+    }
+
+    validateContract(t, r, q, S, K, exercise, exerciseTimes);
+
+    const math::pde::Grid<T> spotGrid{makeSpotGrid(t, S, K)};
+    const math::pde::Grid<T> varianceGrid{makeVarianceGrid()};
+    const std::span<const T> z{spotGrid.x()};
+    const std::span<const T> v{varianceGrid.x()};
+
+    numSpot_ = z.size();
+    numVariance_ = v.size();
+
+    const std::size_t size{numSpot_ * numVariance_};
+
+    for (Vector<T>* buffer :
+         {&values_,
+          &start_,
+          &stage_,
+          &explicit0_,
+          &explicit1_,
+          &explicit2_,
+          &corrected0_,
+          &corrected1_,
+          &corrected2_,
+          &payoff_})
+    {
+        buffer->resize(size);
+    }
+
+    for (std::size_t i{0}; i < numSpot_; ++i)
+    {
+        const T intrinsic{
+            std::max(isCall ? K * std::expm1(z[i]) : -K * std::expm1(z[i]), T{0})
+        };
+
+        std::fill_n(payoff_.begin() + i * numVariance_, numVariance_, intrinsic);
+    }
+
+    std::copy(payoff_.begin(), payoff_.end(), values_.begin());
+
+    setExerciseSteps(t, exercise, exerciseTimes);
+    assemble(spotGrid, varianceGrid, r, q);
+
+    const std::size_t numSteps{config_.numTimeSteps};
+    const T dt{t / static_cast<T>(numSteps)};
+    const T halfDt{T{0.5} * dt};
+    const bool american{exercise == Exercise::American};
+    const bool canExercise{exercise != Exercise::European};
+
+    const Implicit main{factorize(schemeTheta_ * dt)};
+    const Implicit damping{factorize(halfDt)};
+
+    const T lowSpot{K * std::exp(z.front())};
+    const T highSpot{K * std::exp(z.back())};
+
+    const auto boundaries = [&](T tau) -> std::pair<T, T>
+    {
+        const T deep{detail::deepInTheMoney(
+            isCall ? highSpot : lowSpot,
+            K,
+            tau,
+            r,
+            q,
+            isCall,
+            canExercise
+        )};
+
+        return isCall ? std::pair<T, T>{T{0}, deep} : std::pair<T, T>{deep, T{0}};
+    };
+
+    for (std::size_t step{0}; step < numSteps; ++step)
+    {
+        const T tau{static_cast<T>(step) * dt};
+
+        if (step < config_.dampingSteps)
+        {
+            for (const T tauNext : {tau + halfDt, tau + dt})
+            {
+                const auto [low, high] = boundaries(tauNext);
+                advance(damping, Scheme::Douglas, T{1}, halfDt, low, high);
+            }
+        }
+        else
+        {
+            const auto [low, high] = boundaries(tau + dt);
+            advance(main, config_.scheme, schemeTheta_, dt, low, high);
+        }
+
+        if (american || exerciseSteps_[step + 1] != 0)
+        {
+            for (std::size_t k{0}; k < size; ++k)
+            {
+                values_[k] = std::max(values_[k], payoff_[k]);
+            }
+        }
+    }
+
+    return interpolate(z, v, S, K);
+}
+
+template <std::floating_point T> void Pricer<T>::setParams(const Params<T>& params)
+{
+    REQUIRE_POSITIVE(params.kappa);
+    REQUIRE_POSITIVE(params.theta);
+    REQUIRE_POSITIVE(params.sigma);
+    REQUIRE_EQUAL_OR_LESS(std::abs(params.rho), T{1});
+    REQUIRE_NON_NEGATIVE(params.v0);
+    REQUIRE_EQUAL_OR_LESS(params.v0, config_.maxVariance);
+
+    params_ = params;
+}
+
+template <std::floating_point T> const Config<T>& Pricer<T>::config() const noexcept
+{
+    return config_;
+}
+
+template <std::floating_point T> void Pricer<T>::validateConfig() const
+{
+    REQUIRE_GREATER(config_.numSpotNodes, std::size_t{4});
+    REQUIRE_GREATER(config_.numVarianceNodes, std::size_t{4});
+    REQUIRE_GREATER(config_.numTimeSteps, std::size_t{0});
+    REQUIRE_EQUAL_OR_LESS(config_.dampingSteps, config_.numTimeSteps);
+    REQUIRE_POSITIVE(schemeTheta_);
+    REQUIRE_EQUAL_OR_LESS(schemeTheta_, T{1});
+    REQUIRE_POSITIVE(config_.numStdDevs);
+    REQUIRE_POSITIVE(config_.maxVariance);
+    REQUIRE_NON_NEGATIVE(config_.spotBeta);
+    REQUIRE_NON_NEGATIVE(config_.varianceBeta);
+}
+
+template <std::floating_point T> void Pricer<T>::validateContract(
+    T t,
+    T r,
+    T q,
+    T S,
+    T K,
+    Exercise exercise,
+    std::span<const T> exerciseTimes
+) const
+{
+    REQUIRE_POSITIVE(t);
+    REQUIRE_FINITE(r);
+    REQUIRE_FINITE(q);
+    REQUIRE_POSITIVE(S);
+    REQUIRE_POSITIVE(K);
+
+    if (exercise == Exercise::Bermudan)
+    {
+        REQUIRE_NON_EMPTY(exerciseTimes);
+        REQUIRE_NON_NEGATIVE(exerciseTimes);
+        REQUIRE_EQUAL_OR_LESS(exerciseTimes, t);
+    }
+}
+
+template <std::floating_point T>
+math::pde::Grid<T> Pricer<T>::makeSpotGrid(T t, T S, T K) const
+{
+    const T volScale{std::sqrt(std::max(params_->v0, params_->theta))};
+    const T zMax{
+        std::abs(std::log(S / K)) + config_.numStdDevs * volScale * std::sqrt(t)
+    };
+
+    // Nodes cluster at the payoff kink (z = 0) and at the spot, where the price is read.
+    const std::array<T, 2> centers{T{0}, std::log(S / K)};
+
+    return math::pde::generateConcentratedGrid<T>(
+        config_.numSpotNodes,
+        -zMax,
+        zMax,
+        std::span<const T>{centers}.first(centers[1] == T{0} ? 1 : 2),
+        config_.spotBeta
+    );
+}
+
+template <std::floating_point T> math::pde::Grid<T> Pricer<T>::makeVarianceGrid() const
+{
+    const std::size_t n{config_.numVarianceNodes};
+
+    // The nonnegative half of a centred sinh grid clusters nodes near v = 0.
+    const math::pde::Grid<T> centred{math::pde::generateCenteredSinHGrid<T>(
+        2 * n - 1,
+        -config_.maxVariance,
+        config_.maxVariance,
+        config_.varianceBeta
+    )};
+
+    const std::span<const T> upperHalf{centred.x().subspan(n - 1)};
+
+    Vector<T> v(upperHalf.begin(), upperHalf.end());
+    v.front() = T{0};
+
+    return math::pde::Grid<T>{std::span<const T>{v}};
+}
+
+template <std::floating_point T> void Pricer<T>::setExerciseSteps(
+    T t,
+    Exercise exercise,
+    std::span<const T> exerciseTimes
+)
+{
+    const std::size_t numSteps{config_.numTimeSteps};
+
+    exerciseSteps_.assign(numSteps + 1, 0);
+
+    if (exercise != Exercise::Bermudan)
+        return;
+
+    const T dt{t / static_cast<T>(numSteps)};
+
+    for (const T exerciseTime : exerciseTimes)
+    {
+        const T step{std::round((t - exerciseTime) / dt)};
+        exerciseSteps_[std::min(static_cast<std::size_t>(step), numSteps)] = 1;
+    }
+}
+
+template <std::floating_point T> void Pricer<T>::assemble(
+    const math::pde::Grid<T>& spotGrid,
+    const math::pde::Grid<T>& varianceGrid,
+    T r,
+    T q
+)
+{
+    const Params<T>& params{*params_};
+    const std::span<const T> v{varianceGrid.x()};
+    const std::size_t nx{numSpot_};
+    const std::size_t nv{numVariance_};
+    const std::size_t lastV{nv - 1};
+
+    const math::pde::Stencil<T> firstSpot{spotGrid.firstDerivative()};
+    const math::pde::Stencil<T> secondSpot{spotGrid.secondDerivative()};
+    const math::pde::Stencil<T> firstVariance{varianceGrid.firstDerivative()};
+
+    math::pde::TridiagonalOperator<T> varianceOperator;
+
+    varianceOperator.assemble(
+        varianceGrid,
+        [&](std::size_t j) { return T{0.5} * params.sigma * params.sigma * v[j]; },
+        [&](std::size_t j) { return params.kappa * (params.theta - v[j]); },
+        [&](std::size_t) { return T{-0.5} * r; }
+    );
+
+    spotLower_.assign(nx * nv, T{0});
+    spotMiddle_.assign(nx * nv, T{0});
+    spotUpper_.assign(nx * nv, T{0});
+    spotWeights_.assign(3 * nx, T{0});
+
+    for (std::size_t i{1}; i + 1 < nx; ++i)
+    {
+        const std::size_t row{i * nv};
+
+        for (std::size_t j{0}; j < nv; ++j)
+        {
+            const T diffusion{T{0.5} * v[j]};
+            const T convection{r - q - diffusion};
+
+            spotLower_[row + j] =
+                diffusion * secondSpot.lower[i] + convection * firstSpot.lower[i];
+            spotMiddle_[row + j] = diffusion * secondSpot.middle[i] +
+                                   convection * firstSpot.middle[i] - T{0.5} * r;
+            spotUpper_[row + j] =
+                diffusion * secondSpot.upper[i] + convection * firstSpot.upper[i];
+        }
+
+        spotWeights_[3 * i] = firstSpot.lower[i];
+        spotWeights_[3 * i + 1] = firstSpot.middle[i];
+        spotWeights_[3 * i + 2] = firstSpot.upper[i];
+    }
+
+    const std::span<const T> varianceLower{varianceOperator.lower()};
+    const std::span<const T> varianceMiddle{varianceOperator.middle()};
+    const std::span<const T> varianceUpper{varianceOperator.upper()};
+
+    varianceLower_.assign(varianceLower.begin(), varianceLower.end());
+    varianceMiddle_.assign(varianceMiddle.begin(), varianceMiddle.end());
+    varianceUpper_.assign(varianceUpper.begin(), varianceUpper.end());
+
+    // v = 0: the diffusion vanishes and the inflowing drift is upwinded.
+    const T drift{params.kappa * params.theta / (v[1] - v[0])};
+
+    varianceMiddle_.front() = -drift - T{0.5} * r;
+    varianceUpper_.front() = drift;
+
+    // v = vMax: zero-flux Neumann condition through a reflected ghost node.
+    const T hLast{v[lastV] - v[lastV - 1]};
+    const T reflected{params.sigma * params.sigma * v[lastV] / (hLast * hLast)};
+
+    varianceLower_.back() = reflected;
+    varianceMiddle_.back() = -reflected - T{0.5} * r;
+
+    mixedWeights_.assign(3 * nv, T{0});
+
+    for (std::size_t j{1}; j < lastV; ++j)
+    {
+        const T scale{params.rho * params.sigma * v[j]};
+
+        mixedWeights_[3 * j] = scale * firstVariance.lower[j];
+        mixedWeights_[3 * j + 1] = scale * firstVariance.middle[j];
+        mixedWeights_[3 * j + 2] = scale * firstVariance.upper[j];
+    }
+}
+
+template <std::floating_point T>
+typename Pricer<T>::Implicit Pricer<T>::factorize(T scale)
+{
+    const std::size_t size{numSpot_ * numVariance_};
+
+    system_.resize(3 * size);
+
+    const std::span<T> upper{std::span<T>{system_}.subspan(0, size)};
+    const std::span<T> middle{std::span<T>{system_}.subspan(size, size)};
+    const std::span<T> lower{std::span<T>{system_}.subspan(2 * size, size)};
+
+    const auto fill = [scale](
+                          std::span<const T> fromUpper,
+                          std::span<const T> fromMiddle,
+                          std::span<const T> fromLower,
+                          std::span<T> toUpper,
+                          std::span<T> toMiddle,
+                          std::span<T> toLower
+                      )
+    {
+        for (std::size_t k{0}; k < fromMiddle.size(); ++k)
+        {
+            toUpper[k] = -scale * fromUpper[k];
+            toMiddle[k] = T{1} - scale * fromMiddle[k];
+            toLower[k] = -scale * fromLower[k];
+        }
+    };
+
+    fill(spotUpper_, spotMiddle_, spotLower_, upper, middle, lower);
+
+    math::linear_algebra::ThomasFactorization<T> spot{upper, middle, lower, numVariance_};
+
+    fill(
+        varianceUpper_,
+        varianceMiddle_,
+        varianceLower_,
+        upper.first(numVariance_),
+        middle.first(numVariance_),
+        lower.first(numVariance_)
+    );
+
+    math::linear_algebra::ThomasFactorization<T> variance{
+        upper.first(numVariance_),
+        middle.first(numVariance_),
+        lower.first(numVariance_)
+    };
+
+    return Implicit{std::move(spot), std::move(variance)};
+}
+
+template <std::floating_point T>
+template <typename F>
+void Pricer<T>::forRows(std::size_t begin, std::size_t end, F&& f) const
+{
+    const std::size_t count{end - begin};
+    const std::size_t numBlocks{std::min(numWorkers_, count)};
+
+    if (numBlocks <= 1)
+    {
+        f(begin, end);
+        return;
+    }
+
+    execution::parallelFor(
+        0,
+        numBlocks,
+        [&](std::size_t block)
+        {
+            f(begin + count * block / numBlocks, begin + count * (block + 1) / numBlocks);
+        },
+        static_cast<int>(numBlocks)
+    );
+}
+
+template <std::floating_point T> void Pricer<T>::applyRows(
+    std::span<const T> in,
+    std::span<T> out0,
+    std::span<T> out1,
+    std::span<T> out2,
+    std::size_t rowBegin,
+    std::size_t rowEnd
+) const noexcept
+{
+    const std::size_t nv{numVariance_};
+    const std::size_t lastV{nv - 1};
+
+    for (std::size_t i{rowBegin}; i < rowEnd; ++i)
+    {
+        const std::size_t row{i * nv};
+
+        if (i == 0 || i + 1 == numSpot_)
+        {
+            std::fill_n(out0.begin() + row, nv, T{0});
+            std::fill_n(out1.begin() + row, nv, T{0});
+            std::fill_n(out2.begin() + row, nv, T{0});
+            continue;
+        }
+
+        const T* __restrict below{in.data() + row - nv};
+        const T* __restrict centre{in.data() + row};
+        const T* __restrict above{in.data() + row + nv};
+        const T* __restrict spotLower{spotLower_.data() + row};
+        const T* __restrict spotMiddle{spotMiddle_.data() + row};
+        const T* __restrict spotUpper{spotUpper_.data() + row};
+        const T* __restrict varianceLower{varianceLower_.data()};
+        const T* __restrict varianceMiddle{varianceMiddle_.data()};
+        const T* __restrict varianceUpper{varianceUpper_.data()};
+        T* __restrict spot{out1.data() + row};
+        T* __restrict variance{out2.data() + row};
+
+        for (std::size_t j{0}; j < nv; ++j)
+        {
+            spot[j] = spotLower[j] * below[j] + spotMiddle[j] * centre[j] +
+                      spotUpper[j] * above[j];
+        }
+
+        variance[0] = varianceMiddle[0] * centre[0] + varianceUpper[0] * centre[1];
+        variance[lastV] = varianceLower[lastV] * centre[lastV - 1] +
+                          varianceMiddle[lastV] * centre[lastV];
+
+        for (std::size_t j{1}; j < lastV; ++j)
+        {
+            variance[j] = varianceLower[j] * centre[j - 1] +
+                          varianceMiddle[j] * centre[j] +
+                          varianceUpper[j] * centre[j + 1];
+        }
+
+        const T wBelow{spotWeights_[3 * i]};
+        const T wCentre{spotWeights_[3 * i + 1]};
+        const T wAbove{spotWeights_[3 * i + 2]};
+
+        const auto spotDerivative = [&](std::size_t j)
+        { return wBelow * below[j] + wCentre * centre[j] + wAbove * above[j]; };
+
+        T dBelow{spotDerivative(0)};
+        T dCentre{spotDerivative(1)};
+
+        out0[row] = T{0};
+        out0[row + lastV] = T{0};
+
+        for (std::size_t j{1}; j < lastV; ++j)
+        {
+            const T dAbove{spotDerivative(j + 1)};
+
+            out0[row + j] = mixedWeights_[3 * j] * dBelow +
+                            mixedWeights_[3 * j + 1] * dCentre +
+                            mixedWeights_[3 * j + 2] * dAbove;
+
+            dBelow = dCentre;
+            dCentre = dAbove;
+        }
+    }
+}
+
+template <std::floating_point T> void Pricer<T>::solveSpot(
+    const Implicit& implicit,
+    std::span<T> x,
+    T lowBoundary,
+    T highBoundary
+)
+{
+    const std::size_t nv{numVariance_};
+
+    std::fill_n(x.begin(), nv, lowBoundary);
+    std::fill_n(x.begin() + (numSpot_ - 1) * nv, nv, highBoundary);
+
+    forRows(
+        0,
+        nv,
+        [&](std::size_t laneBegin, std::size_t laneEnd)
+        { implicit.spot.solve(x, laneBegin, laneEnd); }
+    );
+}
+
+template <std::floating_point T> void Pricer<T>::solveVariance(
+    const Implicit& implicit,
+    std::span<T> x,
+    std::span<const T> explicit2,
+    T scale
+)
+{
+    const std::size_t nv{numVariance_};
+
+    forRows(
+        1,
+        numSpot_ - 1,
+        [&](std::size_t rowBegin, std::size_t rowEnd)
+        {
+            for (std::size_t k{rowBegin * nv}; k < rowEnd * nv; ++k)
+            {
+                x[k] -= scale * explicit2[k];
+            }
+
+            implicit.variance.solveLines(x, rowBegin, rowEnd);
+        }
+    );
+}
+
+// Splitting schemes follow in 't Hout & Foulon (2010): A0 is the mixed term and is
+// always explicit, A1 and A2 are the spot and variance directions.
+template <std::floating_point T> void Pricer<T>::advance(
+    const Implicit& implicit,
+    Scheme scheme,
+    T theta,
+    T dt,
+    T lowBoundary,
+    T highBoundary
+)
+{
+    const std::size_t nv{numVariance_};
+    const T scale{theta * dt};
+    const T halfDt{T{0.5} * dt};
+
+    forRows(
+        0,
+        numSpot_,
+        [&](std::size_t rowBegin, std::size_t rowEnd)
+        {
+            applyRows(values_, explicit0_, explicit1_, explicit2_, rowBegin, rowEnd);
+
+            for (std::size_t k{rowBegin * nv}; k < rowEnd * nv; ++k)
+            {
+                const T full{explicit0_[k] + explicit1_[k] + explicit2_[k]};
+
+                start_[k] = values_[k] + dt * full;
+                stage_[k] = start_[k] - scale * explicit1_[k];
+            }
+        }
+    );
+
+    solveSpot(implicit, stage_, lowBoundary, highBoundary);
+    solveVariance(implicit, stage_, explicit2_, scale);
+
+    if (scheme == Scheme::Douglas)
+    {
+        values_.swap(stage_);
+        return;
+    }
+
+    forRows(
+        0,
+        numSpot_,
+        [&](std::size_t rowBegin, std::size_t rowEnd)
+        {
+            applyRows(stage_, corrected0_, corrected1_, corrected2_, rowBegin, rowEnd);
+
+            for (std::size_t k{rowBegin * nv}; k < rowEnd * nv; ++k)
+            {
+                const T mixed{corrected0_[k] - explicit0_[k]};
+                const T full{mixed + (corrected1_[k] - explicit1_[k]) +
+                             (corrected2_[k] - explicit2_[k])};
+
+                switch (scheme)
+                {
+                case Scheme::CraigSneyd:
+                    start_[k] += halfDt * mixed - scale * explicit1_[k];
+                    break;
+                case Scheme::ModifiedCraigSneyd:
+                    start_[k] += scale * mixed + (halfDt - scale) * full -
+                                 scale * explicit1_[k];
+                    break;
+                case Scheme::HundsdorferVerwer:
+                case Scheme::Douglas:
+                    start_[k] += halfDt * full - scale * corrected1_[k];
+                    break;
+                }
+            }
+        }
+    );
+
+    solveSpot(implicit, start_, lowBoundary, highBoundary);
+    solveVariance(
+        implicit,
+        start_,
+        scheme == Scheme::HundsdorferVerwer ? corrected2_ : explicit2_,
+        scale
+    );
+
+    values_.swap(start_);
+}
+
+template <std::floating_point T>
+T Pricer<T>::interpolate(std::span<const T> z, std::span<const T> v, T S, T K)
+{
+    const std::size_t nv{numVariance_};
+    const T zSpot{std::log(S / K)};
+
+    line_.resize(numSpot_ + nv);
+
+    const std::span<T> column{std::span<T>{line_}.first(numSpot_)};
+    const std::span<T> slice{std::span<T>{line_}.subspan(numSpot_, nv)};
+
+    const math::interp::hermite::PchipInterpolator<T> interpolator{};
+
+    for (std::size_t j{0}; j < nv; ++j)
+    {
+        for (std::size_t i{0}; i < numSpot_; ++i)
+        {
+            column[i] = values_[i * nv + j];
+        }
+
+        slice[j] = interpolator(zSpot, z, std::span<const T>{column}, false);
+    }
+
+    return interpolator(params_->v0, v, std::span<const T>{slice}, false);
+}
+} // namespace uv::models::heston::pde
+
+namespace uv::models::heston::pde::detail
+{
+template <std::floating_point T>
+T deepInTheMoney(T S, T K, T tau, T r, T q, bool isCall, bool canExercise) noexcept
+{
+    const T omega{isCall ? T{1} : T{-1}};
+    const T forwardValue{omega * (S * std::exp(-q * tau) - K * std::exp(-r * tau))};
+
+    return canExercise ? std::max(forwardValue, omega * (S - K)) : forwardValue;
+}
+} // namespace uv::models::heston::pde::detail
@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Types.hpp"
+#include "Math/LinearAlgebra/Tridiagonal.hpp"
+#include "Math/PDE/Config.hpp"
+#include "Math/PDE/Grid.hpp"
+#include "Models/Heston/PDE/Config.hpp"
+#include "Models/Heston/Params.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <span>
+
+namespace uv::models::heston::pde
+{
+using math::pde::Exercise;
+
+template <std::floating_point T> class Pricer
+{
+  private:
+    struct Implicit
+    {
+        math::linear_algebra::ThomasFactorization<T> spot;
+        math::linear_algebra::ThomasFactorization<T> variance;
+    };
+
+    Config<T> config_;
+    T schemeTheta_;
+    std::size_t numWorkers_;
+    std::optional<Params<T>> params_;
+
+    std::size_t numSpot_{0};
+    std::size_t numVariance_{0};
+
+    // A1 (spot direction) is stored interleaved as [i * numVariance_ + j] so that
+    // every variance level is one lane of a batched Thomas solve.
+    Vector<T> spotLower_;
+    Vector<T> spotMiddle_;
+    Vector<T> spotUpper_;
+    Vector<T> varianceLower_;
+    Vector<T> varianceMiddle_;
+    Vector<T> varianceUpper_;
+    Vector<T> spotWeights_;
+    Vector<T> mixedWeights_;
+
+    Vector<T> values_;
+    Vector<T> start_;
+    Vector<T> stage_;
+    Vector<T> explicit0_;
+    Vector<T> explicit1_;
+    Vector<T> explicit2_;
+    Vector<T> corrected0_;
+    Vector<T> corrected1_;
+    Vector<T> corrected2_;
+    Vector<T> payoff_;
+    Vector<T> system_;
+    Vector<T> line_;
+    Vector<char> exerciseSteps_;
+
+    void validateConfig() const;
+    void validateContract(
+        T t,
+        T r,
+        T q,
+        T S,
+        T K,
+        Exercise exercise,
+        std::span<const T> exerciseTimes
+    ) const;
+
+    math::pde::Grid<T> makeSpotGrid(T t, T S, T K) const;
+    math::pde::Grid<T> makeVarianceGrid() const;
+
+    void setExerciseSteps(T t, Exercise exercise, std::span<const T> exerciseTimes);
+
+    void assemble(
+        const math::pde::Grid<T>& spotGrid,
+        const math::pde::Grid<T>& varianceGrid,
+        T r,
+        T q
+    );
+    Implicit factorize(T scale);
+
+    template <typename F> void forRows(std::size_t begin, std::size_t end, F&& f) const;
+
+    void applyRows(
+        std::span<const T> in,
+        std::span<T> out0,
+        std::span<T> out1,
+        std::span<T> out2,
+        std::size_t rowBegin,
+        std::size_t rowEnd
+    ) const noexcept;
+
+    void solveSpot(
+        const Implicit& implicit,
+        std::span<T> x,
+        T lowBoundary,
+        T highBoundary
+    );
+
+    void solveVariance(
+        const Implicit& implicit,
+        std::span<T> x,
+        std::span<const T> explicit2,
+        T scale
+    );
+
+    void advance(
+        const Implicit& implicit,
+        Scheme scheme,
+        T theta,
+        T dt,
+        T lowBoundary,
+        T highBoundary
+    );
+
+    T interpolate(std::span<const T> z, std::span<const T> v, T S, T K);
+
+  public:
+    explicit Pricer(const Config<T>& config = {});
+
+    T price(
+        T t,
+        T r,
+        T q,
+        T S,
+        T K,
+        bool isCall = true,
+        Exercise exercise = Exercise::European,
+        std::span<const T> exerciseTimes = {}
+    );
+
+    void setParams(const Params<T>& params);
+
+    const Config<T>& config() const noexcept;
+};
+} // namespace uv::models::heston::pde
+
+#include "Models/Heston/PDE/Detail/Pricer.inl"
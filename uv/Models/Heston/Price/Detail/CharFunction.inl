@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Base/Types.hpp"
+#include "Base/Utils/Metrics.hpp"
 #include "Math/Functions/Primitive.hpp"
 
 #include <cmath>
@@ -23,6 +24,8 @@ template <std::floating_point T> Complex<T> charFunction( // NOSONAR -- Hot Hest
     Complex<T> u
 ) noexcept
 {
+    utils::Metrics::add(utils::Counter::CharFunction);
+
     constexpr Complex<T> i{T{0}, T{1}};
 
     const Complex<T> beta{kappa + sigmaRho * u};
@@ -64,6 +67,8 @@ charFunctionCached( // NOSONAR -- Hot Heston kernel uses precomputed scalar term
     Complex<T> u
 ) noexcept
 {
+    utils::Metrics::add(utils::Counter::CharFunctionCached);
+
     constexpr Complex<T> i{T{0}, T{1}};
 
     const Complex<T> beta{kappa + sigmaRho * u};
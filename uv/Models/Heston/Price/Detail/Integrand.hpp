@@ -2,7 +2,9 @@
 
 #include "Base/Types.hpp"
 
+#include <array>
 #include <concepts>
+#include <cstddef>
 
 namespace uv::models::heston::price::detail
 {
@@ -24,6 +26,27 @@ template <std::floating_point T> struct Integrand
     [[gnu::hot]] T operator()(T x) const noexcept;
 };
 
+// The Integrand for M log-moneyness values that share one contour: the
+// characteristic function is evaluated once per node and only the strike phase
+// exp(x * c[m]) differs between lanes.
+template <std::floating_point T, std::size_t M> struct ForwardsIntegrand
+{
+    Complex<T> iAlpha;
+    Complex<T> onePlusITanPhi;
+    std::array<Complex<T>, M> c;
+    Complex<T> tDivTwo;
+    Complex<T> sigmaRho;
+
+    T kappa;
+    T kappaThetaDivSigma2;
+    T sigma2;
+
+    T v0;
+    T t;
+
+    [[gnu::hot]] std::array<T, M> operator()(T x) const noexcept;
+};
+
 template <std::floating_point T> struct BatchIntegrand
 {
     Complex<T> sigmaRho;
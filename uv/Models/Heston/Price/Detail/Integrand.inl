@@ -32,6 +32,35 @@ template <std::floating_point T> T Integrand<T>::operator()(T x) const noexcept
     return std::real(std::exp(logPsi + (x * c)) * onePlusITanPhi * invDenom);
 }
 
+template <std::floating_point T, std::size_t M>
+std::array<T, M> ForwardsIntegrand<T, M>::operator()(T x) const noexcept
+{
+    constexpr Complex<T> i{T{0}, T{1}};
+
+    const Complex<T> h{iAlpha + x * onePlusITanPhi};
+
+    const Complex<T> hMinusI{h - i};
+
+    const Complex<T> logPsi{charFunction(
+        kappa,
+        kappaThetaDivSigma2,
+        sigma2,
+        v0,
+        t,
+        tDivTwo,
+        sigmaRho,
+        hMinusI
+    )};
+
+    const Complex<T> scale{onePlusITanPhi * math::invComplex(hMinusI * h)};
+
+    std::array<T, M> out;
+    for (std::size_t m{0}; m < M; ++m)
+        out[m] = std::real(std::exp(logPsi + (x * c[m])) * scale);
+
+    return out;
+}
+
 template <std::floating_point T>
 std::array<T, 6> BatchIntegrand<T>::operator()(T x) const noexcept
 {
@@ -2,9 +2,12 @@
 
 #include "Base/Errors/Errors.hpp"
 #include "Base/Macros/Require.hpp"
+#include "Base/Utils/CycleClock.hpp"
 #include "Math/Functions/Primitive.hpp"
 #include "Models/Heston/Price/Detail/Integrand.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
 #include <numbers>
@@ -31,6 +34,9 @@ template <std::floating_point T>
     return T{0};
 }
 
+// Forwards priced together by callPriceForwards.
+inline constexpr std::size_t forwardLanes{8};
+
 template <std::floating_point T>
 [[gnu::hot]] T getPhi(T kappa, T theta, T sigma, T rho, T v0, T t, T w) noexcept
 {
@@ -138,6 +144,8 @@ T Pricer<T, N>::callPrice( // NOSONAR -- Hot pricing kernel keeps model/market s
 template <std::floating_point T, std::size_t N>
 T Pricer<T, N>::callPrice(T t, T dF, T F, T K, bool doValidate) const
 {
+    const utils::CycleSampler sampler{utils::Histogram::CallPriceCycles};
+
     if (!params_.has_value()) [[unlikely]]
     {
         errors::raise(errors::ErrorCode::InvalidState, "params_ must be set");
@@ -182,6 +190,121 @@ template <std::floating_point T, std::size_t N> void Pricer<T, N>::callPrice(
     }
 }
 
+template <std::floating_point T, std::size_t N> void Pricer<T, N>::callPriceForwards(
+    std::span<T> out,
+    T t,
+    std::span<const T> discountFactors,
+    std::span<const T> forwards,
+    T K,
+    bool doValidate
+) const
+{
+    if (!params_.has_value()) [[unlikely]]
+    {
+        errors::raise(errors::ErrorCode::InvalidState, "params_ must be set");
+    }
+
+    if (doValidate)
+    {
+        REQUIRE_NON_EMPTY(forwards);
+        REQUIRE_SAME_SIZE(out, forwards);
+        REQUIRE_SAME_SIZE(discountFactors, forwards);
+
+        for (std::size_t m{0}; m < forwards.size(); ++m)
+            validateCallPrice(t, discountFactors[m], forwards[m], K);
+    }
+
+    constexpr std::size_t M{detail::forwardLanes};
+    constexpr Complex<T> i{T{0}, T{1}};
+    constexpr T invPi{T{1} / std::numbers::pi_v<T>};
+    constexpr T piDivTwelve{std::numbers::pi_v<T> / T{12}};
+
+    const Params<T>& p{*params_};
+    const T sigma2{p.sigma * p.sigma};
+
+    detail::ForwardsIntegrand<T, M> integrand{
+        .iAlpha = {},
+        .onePlusITanPhi = {},
+        .c = {},
+        .tDivTwo = {-t * T{0.5}},
+        .sigmaRho = {-i * (p.sigma * p.rho)},
+        .kappa = p.kappa,
+        .kappaThetaDivSigma2 = p.kappa * p.theta / sigma2,
+        .sigma2 = sigma2,
+        .v0 = p.v0,
+        .t = t
+    };
+
+    std::array<std::size_t, M> lanes{};
+
+    const auto flush = [&](std::size_t count, T alpha, T tanPhi)
+    {
+        integrand.iAlpha = {T{0}, -alpha};
+        integrand.onePlusITanPhi = {T{1}, tanPhi};
+
+        // Unused lanes repeat the last forward; they only cost one exp per node.
+        for (std::size_t m{0}; m < M; ++m)
+        {
+            const T w{std::log(forwards[lanes[std::min(m, count - 1)]] / K)};
+            integrand.c[m] = {-tanPhi * w, w};
+        }
+
+        const std::array<T, M> integrals{
+            quad_->template integrateZeroToInfMulti<M>(integrand)
+        };
+
+        for (std::size_t m{0}; m < count; ++m)
+        {
+            const std::size_t lane{lanes[m]};
+            const T F{forwards[lane]};
+            const T w{std::log(F / K)};
+
+            out[lane] = discountFactors[lane] *
+                        (detail::getResidues(alpha, F, K) -
+                         (F * invPi) * std::exp(alpha * w) * integrals[m]);
+        }
+    };
+
+    // getAlpha and getPhi take a handful of discrete values, so the forwards are
+    // grouped by contour one candidate at a time.
+    const std::array<T, 2> alphas{alphaItm_, alphaOtm_};
+    // codeql-suppress[cpp/equality-on-floats]: identical configured alphas.
+    const std::size_t numAlphas{alphaItm_ == alphaOtm_ ? 1u : 2u};
+
+    for (std::size_t a{0}; a < numAlphas; ++a)
+    {
+        const T alpha{alphas[a]};
+
+        for (const T phi : {-piDivTwelve, T{0}, piDivTwelve})
+        {
+            const T tanPhi{std::tan(phi)};
+            std::size_t count{0};
+
+            for (std::size_t m{0}; m < forwards.size(); ++m)
+            {
+                const T w{std::log(forwards[m] / K)};
+
+                // codeql-suppress[cpp/equality-on-floats]: both sides are exact
+                // picks from the same constants.
+                if (detail::getAlpha(w, alphaItm_, alphaOtm_) != alpha ||
+                    detail::getPhi(p.kappa, p.theta, p.sigma, p.rho, p.v0, t, w) != phi)
+                    continue;
+
+                lanes[count++] = m;
+
+                if (count == M)
+                {
+                    flush(count, alpha, tanPhi);
+                    count = 0;
+                }
+            }
+
+            if (count > 0)
+                flush(count, alpha, tanPhi);
+        }
+    }
+}
+
 template <std::floating_point T, std::size_t N> core::Matrix<T> Pricer<T, N>::callPrice(
     const core::VolSurface<T>& volSurface,
     const core::Curve<T>& curve,
@@ -55,6 +55,19 @@ template <std::floating_point T, std::size_t N = defaultNodes> class Pricer
         bool doValidate = true
     ) const;
 
+    // Prices one strike under several forwards and discount factors, e.g. after
+    // spot or rate shocks. Forwards whose log-moneyness selects the same
+    // integration contour share one characteristic-function evaluation per node,
+    // so a ladder costs little more than a single price.
+    void callPriceForwards(
+        std::span<T> out,
+        T t,
+        std::span<const T> discountFactors,
+        std::span<const T> forwards,
+        T K,
+        bool doValidate = true
+    ) const;
+
     core::Matrix<T> callPrice(
         const core::VolSurface<T>& volSurface,
         const core::Curve<T>& curve,
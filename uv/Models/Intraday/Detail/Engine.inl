@@ -0,0 +1,309 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Errors/Errors.hpp"
+#include "Base/Macros/Profile.hpp"
+#include "Base/Macros/Require.hpp"
+#include "Core/Generate.hpp"
+#include "Math/Functions/Volatility.hpp"
+#include "Models/Heston/Calibrate/Calibrate.hpp"
+#include "Models/SVI/BuildSurface.hpp"
+#include "Models/SVI/Calibrate/Calibrate.hpp"
+#include "Models/SVI/Math.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <format>
+#include <string_view>
+#include <utility>
+
+namespace uv::models::intraday::detail
+{
+inline double elapsedMs(
+    std::chrono::steady_clock::time_point from,
+    std::chrono::steady_clock::time_point to
+) noexcept
+{
+    return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+// Index of the grid node within a relative tolerance of value.
+template <std::floating_point T> std::size_t
+gridIndex(std::span<const T> grid, T value, double tolerance, std::string_view what)
+{
+    const auto it{std::lower_bound(grid.begin(), grid.end(), value)};
+
+    const auto matches = [&](auto node)
+    {
+        const double x{static_cast<double>(*node)};
+        const double scale{std::max(1.0, std::abs(x))};
+        return std::abs(x - static_cast<double>(value)) <= tolerance * scale;
+    };
+
+    if (it != grid.end() && matches(it))
+        return static_cast<std::size_t>(it - grid.begin());
+    if (it != grid.begin() && matches(it - 1))
+        return static_cast<std::size_t>(it - grid.begin() - 1);
+
+    errors::raise(
+        errors::ErrorCode::OutOfRange,
+        std::format("Quote {} {} is not on the surface grid", what, value)
+    );
+}
+} // namespace uv::models::intraday::detail
+
+namespace uv::models::intraday
+{
+template <std::floating_point T, std::size_t N>
+Engine<T, N>::Engine(core::MarketState<T> marketState, const Config& config)
+    : config_{config},
+      marketState_{std::move(marketState)},
+      sviOptimizer_{svi::detail::makeNLoptConfig(config_.svi)},
+      logKF_{math::vol::logKF(marketState_.volSurface).template as<double>()},
+      totalVariance_{
+          math::vol::totalVariance(marketState_.volSurface).template as<double>()
+      },
+      vol_{marketState_.volSurface.vol()},
+      dirty_(marketState_.volSurface.numMaturities(), 0),
+      sviParams_{svi::calibrate(marketState_.volSurface, sviOptimizer_)},
+      sviVol_{svi::buildSurface(marketState_.volSurface, sviParams_).vol()},
+      sviSurface_{core::generateVolSurface(marketState_.volSurface, sviVol_)},
+      pricer_{},
+      hestonParams_{heston::calibrate::calibrate<T, N>(
+          sviSurface_,
+          marketState_.interestCurve,
+          config_.heston,
+          pricer_
+      )}
+{
+    pricer_.setParams(hestonParams_);
+}
+
+template <std::floating_point T, std::size_t N>
+void Engine<T, N>::apply(const core::QuoteUpdate<T>& quote)
+{
+    REQUIRE_FINITE(quote.vol);
+    REQUIRE_NON_NEGATIVE(quote.vol);
+
+    const std::size_t i{detail::gridIndex(
+        marketState_.volSurface.maturities(),
+        quote.maturity,
+        config_.gridTolerance,
+        "maturity"
+    )};
+    const std::size_t j{detail::gridIndex(
+        marketState_.volSurface.moneyness(),
+        quote.moneyness,
+        config_.gridTolerance,
+        "moneyness"
+    )};
+
+    vol_[i][j] = quote.vol;
+    dirty_[i] = 1;
+    lastSeq_ = quote.seq;
+    ++pendingQuotes_;
+}
+
+template <std::floating_point T, std::size_t N>
+void Engine<T, N>::apply(std::span<const core::QuoteUpdate<T>> quotes)
+{
+    for (const auto& quote : quotes)
+        apply(quote);
+}
+
+template <std::floating_point T, std::size_t N> UpdateStats Engine<T, N>::recalibrate()
+{
+    PROFILE_ZONE("intraday::recalibrate");
+
+    using Clock = std::chrono::steady_clock;
+
+    const auto start{Clock::now()};
+
+    UpdateStats stats{.seq = lastSeq_, .quotes = pendingQuotes_};
+    pendingQuotes_ = 0;
+
+    if (std::none_of(dirty_.begin(), dirty_.end(), [](auto d) { return d != 0; }))
+        return stats;
+
+    marketState_.volSurface = core::generateVolSurface(marketState_.volSurface, vol_);
+
+    std::span<const T> maturities{marketState_.volSurface.maturities()};
+
+    for (std::size_t i{0}; i < maturities.size(); ++i)
+    {
+        if (!dirty_[i])
+            continue;
+
+        const double t{static_cast<double>(maturities[i])};
+        for (std::size_t j{0}; j < vol_.cols(); ++j)
+        {
+            totalVariance_[i][j] =
+                math::vol::totalVariance(t, static_cast<double>(vol_[i][j]), true);
+        }
+    }
+
+    // A slice is refitted when its quotes moved, when the slice before it moved
+    // (it seeds and calendar-constrains this one), or when the slice before it was
+    // refitted and now crosses the current fit.
+    bool previousDirty{false};
+    bool previousRefit{false};
+
+    for (std::size_t i{0}; i < maturities.size(); ++i)
+    {
+        const bool refit{
+            dirty_[i] != 0 || previousDirty || (previousRefit && crossesPrevious(i))
+        };
+
+        if (refit)
+            refitSlice(i, stats);
+
+        previousDirty = dirty_[i] != 0;
+        previousRefit = refit;
+    }
+
+    std::fill(dirty_.begin(), dirty_.end(), std::uint8_t{0});
+    sviSurface_ = core::generateVolSurface(marketState_.volSurface, sviVol_);
+
+    const auto sviEnd{Clock::now()};
+    stats.sviMs = detail::elapsedMs(start, sviEnd);
+
+    if (config_.recalibrateHeston)
+    {
+        heston::calibrate::Config hestonConfig{config_.heston};
+        hestonConfig.warmStart = hestonParams_.template as<double>();
+
+        const opt::Result<heston::Params<T>> result{
+            heston::calibrate::calibrateWithStatus<T, N>(
+                sviSurface_,
+                marketState_.interestCurve,
+                hestonConfig,
+                pricer_
+            )
+        };
+
+        hestonParams_ = result.params;
+        pricer_.setParams(hestonParams_);
+        stats.hestonTermination = result.termination;
+    }
+
+    const auto end{Clock::now()};
+    stats.hestonMs = detail::elapsedMs(sviEnd, end);
+    stats.totalMs = detail::elapsedMs(start, end);
+
+    return stats;
+}
+
+template <std::floating_point T, std::size_t N>
+Vector<std::size_t> Engine<T, N>::dirtySlices() const
+{
+    Vector<std::size_t> slices;
+
+    for (std::size_t i{0}; i < dirty_.size(); ++i)
+    {
+        if (dirty_[i])
+            slices.push_back(i);
+    }
+
+    return slices;
+}
+
+template <std::floating_point T, std::size_t N>
+const core::MarketState<T>& Engine<T, N>::marketState() const noexcept
+{
+    return marketState_;
+}
+
+template <std::floating_point T, std::size_t N>
+const Vector<svi::Params<T>>& Engine<T, N>::sviParams() const noexcept
+{
+    return sviParams_;
+}
+
+template <std::floating_point T, std::size_t N>
+const core::VolSurface<T>& Engine<T, N>::sviSurface() const noexcept
+{
+    return sviSurface_;
+}
+
+template <std::floating_point T, std::size_t N>
+const heston::Params<T>& Engine<T, N>::hestonParams() const noexcept
+{
+    return hestonParams_;
+}
+
+template <std::floating_point T, std::size_t N>
+const typename Engine<T, N>::Pricer& Engine<T, N>::pricer() const noexcept
+{
+    return pricer_;
+}
+
+template <std::floating_point T, std::size_t N>
+void Engine<T, N>::refitSlice(std::size_t i, UpdateStats& stats)
+{
+    const opt::Result<svi::Params<T>> slice{svi::detail::calibrateSlice<T>(
+        marketState_.volSurface.maturities()[i],
+        logKF_[i],
+        totalVariance_[i],
+        sviOptimizer_,
+        (i == 0) ? nullptr : &sviParams_[i - 1]
+    )};
+
+    sviParams_[i] = slice.params;
+    stats.sviTermination = opt::worst(stats.sviTermination, slice.termination);
+    stats.refitSlices.push_back(i);
+
+    updateSviVol(i);
+}
+
+template <std::floating_point T, std::size_t N>
+void Engine<T, N>::updateSviVol(std::size_t i)
+{
+    const svi::Params<T>& params{sviParams_[i]};
+    std::span<T> row{sviVol_[i]};
+
+    for (std::size_t j{0}; j < row.size(); ++j)
+        row[j] = svi::totalVariance(params, static_cast<T>(logKF_[i][j]));
+
+    math::vol::volFromTotalVariance<T>(row, params.t, row);
+}
+
+template <std::floating_point T, std::size_t N>
+bool Engine<T, N>::crossesPrevious(std::size_t i) const
+{
+    if (i == 0)
+        return false;
+
+    const svi::Params<T>& previous{sviParams_[i - 1]};
+    const svi::Params<T>& current{sviParams_[i]};
+
+    for (const double k : logKF_[i])
+    {
+        const T kT{static_cast<T>(k)};
+        if (svi::totalVariance(current, kT) < svi::totalVariance(previous, kT))
+            return true;
+    }
+
+    return false;
+}
+
+template <std::floating_point T, std::size_t N> Vector<UpdateStats>
+replay(Engine<T, N>& engine, std::span<const core::QuoteUpdate<T>> ticks)
+{
+    Vector<UpdateStats> updates;
+
+    std::size_t begin{0};
+    while (begin < ticks.size())
+    {
+        std::size_t end{begin + 1};
+        while (end < ticks.size() && ticks[end].seq == ticks[begin].seq)
+            ++end;
+
+        engine.apply(ticks.subspan(begin, end - begin));
+        updates.push_back(engine.recalibrate());
+
+        begin = end;
+    }
+
+    return updates;
+}
+} // namespace uv::models::intraday
@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Types.hpp"
+#include "Core/MarketState.hpp"
+#include "Core/Matrix.hpp"
+#include "Core/QuoteUpdate.hpp"
+#include "Core/VolSurface.hpp"
+#include "Models/Heston/Calibrate/Config.hpp"
+#include "Models/Heston/Params.hpp"
+#include "Models/Heston/Price/Pricer.hpp"
+#include "Models/SVI/Calibrate/Config.hpp"
+#include "Models/SVI/Params.hpp"
+#include "Optimization/NLopt/Optimizer.hpp"
+#include "Optimization/Stop.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace uv::models::intraday
+{
+struct Config
+{
+    svi::Config svi{.verbose = false};
+    heston::calibrate::Config heston{.verbosity = opt::ceres::Verbosity::None};
+    // When false only the SVI slices are refitted and the Heston parameters are
+    // left as they are.
+    bool recalibrateHeston{true};
+    // Relative tolerance for matching a quote's maturity and moneyness to the grid.
+    double gridTolerance{1e-9};
+};
+
+struct UpdateStats
+{
+    std::uint64_t seq{};
+    std::size_t quotes{};
+    // Slices refitted by this update, in increasing maturity order.
+    Vector<std::size_t> refitSlices;
+    opt::Termination sviTermination{opt::Termination::Converged};
+    opt::Termination hestonTermination{opt::Termination::Converged};
+    double sviMs{};
+    double hestonMs{};
+    double totalMs{};
+};
+
+// Keeps a calibrated surface resident between intraday snapshots. Quote updates
+// overwrite single nodes of the market vol surface and mark their maturity dirty;
+// recalibrate() then refits only the dirty SVI slices, each seeded and calendar
+// constrained by the slice before it exactly as a full calibration would do, plus
+// the following slice whose calendar constraint depends on the refit. Later slices
+// are refitted only if the new fit makes them cross. The Heston parameters are
+// warm-started from the current ones, so a small move converges in a few steps.
+template <std::floating_point T, std::size_t N = heston::calibrate::defaultNodes>
+class Engine
+{
+  public:
+    using Pricer = heston::price::Pricer<T, N>;
+
+    Engine() = delete;
+
+    // Runs a full SVI and Heston calibration of the initial state.
+    explicit Engine(core::MarketState<T> marketState, const Config& config = {});
+
+    // Overwrites the quoted vol of one grid node; the quote must lie on the grid.
+    void apply(const core::QuoteUpdate<T>& quote);
+
+    void apply(std::span<const core::QuoteUpdate<T>> quotes);
+
+    // Refits every slice touched since the last call. A no-op if nothing is dirty.
+    UpdateStats recalibrate();
+
+    Vector<std::size_t> dirtySlices() const;
+
+    const core::MarketState<T>& marketState() const noexcept;
+    const Vector<svi::Params<T>>& sviParams() const noexcept;
+    const core::VolSurface<T>& sviSurface() const noexcept;
+    const heston::Params<T>& hestonParams() const noexcept;
+    const Pricer& pricer() const noexcept;
+
+  private:
+    using SviOptimizer = opt::nlopt::Optimizer<4, opt::nlopt::Algorithm::LD_SLSQP>;
+
+    void refitSlice(std::size_t i, UpdateStats& stats);
+    void updateSviVol(std::size_t i);
+    bool crossesPrevious(std::size_t i) const;
+
+    Config config_;
+    core::MarketState<T> marketState_;
+    SviOptimizer sviOptimizer_;
+
+    // Double-precision SVI inputs; log-moneyness is fixed because quotes only move
+    // vols, total variance is refreshed per dirty row.
+    core::Matrix<double> logKF_;
+    core::Matrix<double> totalVariance_;
+    core::Matrix<T> vol_;
+    Vector<std::uint8_t> dirty_;
+    std::size_t pendingQuotes_{0};
+    std::uint64_t lastSeq_{0};
+
+    Vector<svi::Params<T>> sviParams_;
+    core::Matrix<T> sviVol_;
+    core::VolSurface<T> sviSurface_;
+
+    Pricer pricer_;
+    heston::Params<T> hestonParams_;
+};
+
+// Replays a recorded tick stream: each run of updates sharing a sequence number is
+// applied as one batch and followed by a recalibration.
+template <std::floating_point T, std::size_t N> Vector<UpdateStats>
+replay(Engine<T, N>& engine, std::span<const core::QuoteUpdate<T>> ticks);
+} // namespace uv::models::intraday
+
+#include "Models/Intraday/Detail/Engine.inl"
@@ -7,6 +7,7 @@
 #include "Core/VolSurface.hpp"
 #include "Models/SVI/Params.hpp"
 #include "Optimization/NLopt/Optimizer.hpp"
+#include "Optimization/Stop.hpp"
 
 #include <concepts>
 #include <span>
@@ -26,6 +27,25 @@ template <std::floating_point T, opt::nlopt::Algorithm Algo> Vector<Params<T>> c
     const opt::nlopt::Optimizer<4, Algo>& prototype,
     bool printParams = false
 );
+
+// Same as calibrate, but also reports the worst termination across slices. Once the
+// prototype's stop condition fires, each remaining slice keeps its initial guess
+// (seeded from the previous slice) and the surface is reported as truncated.
+template <std::floating_point T, opt::nlopt::Algorithm Algo>
+opt::Result<Vector<Params<T>>> calibrateWithStatus(
+    const core::VolSurface<T>& volSurface,
+    const opt::nlopt::Optimizer<4, Algo>& prototype,
+    bool printParams = false
+);
+
+template <std::floating_point T, opt::nlopt::Algorithm Algo>
+opt::Result<Vector<Params<T>>> calibrateWithStatus(
+    std::span<const T> maturities,
+    const core::Matrix<T>& logKF,
+    const core::Matrix<T>& totalVariance,
+    const opt::nlopt::Optimizer<4, Algo>& prototype,
+    bool printParams = false
+);
 } // namespace uv::models::svi
 
 #include "Models/SVI/Calibrate/Detail/Calibrate.inl"
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Optimization/NLopt/Config.hpp"
+#include "Optimization/Stop.hpp"
 
 namespace uv::models::svi
 {
@@ -13,19 +14,21 @@ struct Config
     unsigned int maxEval{10000};
     bool verbose{true};
     bool printParams{false};
+    opt::StopCondition stop{};
 };
 
 namespace detail
 {
 
-constexpr opt::nlopt::Config<4> makeNLoptConfig(const Config& config) noexcept
+inline opt::nlopt::Config<4> makeNLoptConfig(const Config& config) noexcept
 {
     return opt::nlopt::Config<4>{
         .tol = config.objectiveTol,
         .ftolRel = config.objectiveTol,
         .maxEval = config.maxEval,
         .verbose = config.verbose,
-        .paramNames = {"b", "rho", "m", "sigma"}
+        .paramNames = {"b", "rho", "m", "sigma"},
+        .stop = config.stop
     };
 }
 
@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 
+#include "Base/Macros/Profile.hpp"
 #include "Base/Macros/Require.hpp"
 #include "Math/Functions/Volatility.hpp"
 #include "Models/SVI/Calibrate/Detail/Constraints.hpp"
@@ -9,10 +10,12 @@
 
 #include <cstddef>
 #include <format>
+#include <utility>
 
 namespace uv::models::svi::detail
 {
-template <std::floating_point T, opt::nlopt::Algorithm Algo> Params<T> calibrateSlice(
+template <std::floating_point T, opt::nlopt::Algorithm Algo>
+opt::Result<Params<T>> calibrateSlice(
     T t,
     std::span<const double> logKF,
     std::span<const double> totalVariance,
@@ -38,7 +41,36 @@ template <std::floating_point T, opt::nlopt::Algorithm Algo> Vector<Params<T>> c
     bool printParams
 )
 {
-    return calibrate<T, Algo>(
+    return calibrateWithStatus<T, Algo>(volSurface, prototype, printParams).params;
+}
+
+template <std::floating_point T, opt::nlopt::Algorithm Algo> Vector<Params<T>> calibrate(
+    std::span<const T> maturities,
+    const core::Matrix<T>& logKF,
+    const core::Matrix<T>& totalVariance,
+    const opt::nlopt::Optimizer<4, Algo>& prototype,
+    bool printParams
+)
+{
+    opt::Result<Vector<Params<T>>> result{calibrateWithStatus<T, Algo>(
+        maturities,
+        logKF,
+        totalVariance,
+        prototype,
+        printParams
+    )};
+
+    return std::move(result.params);
+}
+
+template <std::floating_point T, opt::nlopt::Algorithm Algo>
+opt::Result<Vector<Params<T>>> calibrateWithStatus(
+    const core::VolSurface<T>& volSurface,
+    const opt::nlopt::Optimizer<4, Algo>& prototype,
+    bool printParams
+)
+{
+    return calibrateWithStatus<T, Algo>(
         volSurface.maturities(),
         math::vol::logKF(volSurface),
         math::vol::totalVariance(volSurface),
@@ -47,7 +79,8 @@ template <std::floating_point T, opt::nlopt::Algorithm Algo> Vector<Params<T>> c
     );
 }
 
-template <std::floating_point T, opt::nlopt::Algorithm Algo> Vector<Params<T>> calibrate(
+template <std::floating_point T, opt::nlopt::Algorithm Algo>
+opt::Result<Vector<Params<T>>> calibrateWithStatus(
     std::span<const T> maturities,
     const core::Matrix<T>& logKF,
     const core::Matrix<T>& totalVariance,
@@ -55,6 +88,8 @@ template <std::floating_point T, opt::nlopt::Algorithm Algo> Vector<Params<T>> c
     bool printParams
 )
 {
+    PROFILE_ZONE("svi::calibrate");
+
     detail::validateInputs<T>(maturities, logKF, totalVariance);
 
     const auto logKFD{logKF.template as<double>()};
@@ -62,13 +97,14 @@ template <std::floating_point T, opt::nlopt::Algorithm Algo> Vector<Params<T>> c
 
     const std::size_t numMaturities{maturities.size()};
 
-    Vector<Params<T>> surfaceParams;
+    opt::Result<Vector<Params<T>>> result;
+    Vector<Params<T>>& surfaceParams{result.params};
     surfaceParams.reserve(numMaturities);
 
     for (std::size_t i = 0; i < numMaturities; ++i)
     {
 
-        Params<T> sliceParams{detail::calibrateSlice<T>(
+        const opt::Result<Params<T>> slice{detail::calibrateSlice<T>(
             maturities[i],
             logKFD[i],
             totalVarianceD[i],
@@ -77,12 +113,13 @@ template <std::floating_point T, opt::nlopt::Algorithm Algo> Vector<Params<T>> c
         )};
 
         if (printParams)
-            detail::logParams(sliceParams);
+            detail::logParams(slice.params);
 
-        surfaceParams.emplace_back(sliceParams);
+        surfaceParams.emplace_back(slice.params);
+        result.termination = opt::worst(result.termination, slice.termination);
     }
 
-    return surfaceParams;
+    return result;
 }
 
 } // namespace uv::models::svi
@@ -109,7 +146,8 @@ void logParams(const Params<T>& params, unsigned int valuePrec)
     ));
 }
 
-template <std::floating_point T, opt::nlopt::Algorithm Algo> Params<T> calibrateSlice(
+template <std::floating_point T, opt::nlopt::Algorithm Algo>
+opt::Result<Params<T>> calibrateSlice(
     const T t,
     std::span<const double> logKF,
     std::span<const double> totalVariance,
@@ -117,6 +155,8 @@ template <std::floating_point T, opt::nlopt::Algorithm Algo> Params<T> calibrate
     const Params<T>* prevParams
 )
 {
+    PROFILE_ZONE("svi::calibrateSlice");
+
     const SliceData sliceData(logKF, totalVariance);
 
     const double atmTotalVariance{sliceData.atmTotalVariance};
@@ -140,7 +180,12 @@ template <std::floating_point T, opt::nlopt::Algorithm Algo> Params<T> calibrate
 
     setMinObjective(optimizer, obj);
 
-    return Params<T>{t, optimizer.optimize(), atmTotalVariance};
+    const Params<T> params{t, optimizer.optimize(), atmTotalVariance};
+
+    return opt::Result<Params<T>>{
+        .params = params,
+        .termination = optimizer.termination()
+    };
 }
 
 template <std::floating_point T> void validateInputs(
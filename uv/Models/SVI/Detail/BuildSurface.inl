@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 
+#include "Base/Macros/Profile.hpp"
 #include "Base/Macros/Require.hpp"
 #include "Core/Generate.hpp"
 #include "Math/Functions/Volatility.hpp"
@@ -22,6 +23,8 @@ buildSurface(const core::MarketState<T>& marketState, const Config& config)
 template <std::floating_point T> core::VolSurface<T>
 buildSurface(const core::VolSurface<T>& volSurface, const Config& config)
 {
+    PROFILE_ZONE("svi::buildSurface");
+
     opt::nlopt::Optimizer<4, opt::nlopt::Algorithm::LD_SLSQP> nloptOptimizer{
         detail::makeNLoptConfig(config)
     };
@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Errors/Errors.hpp"
+#include "Base/Macros/Require.hpp"
+#include "Models/SVI/Math.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace uv::models::svi::detail
+{
+template <std::floating_point T> struct TimeWeights
+{
+    std::size_t lower;
+    std::size_t upper;
+    T lowerWeight;
+    T upperWeight;
+    T lowerSlope;
+    T upperSlope;
+};
+
+template <std::floating_point T> void validateSlices(const Vector<Params<T>>& params);
+
+template <std::floating_point T>
+TimeWeights<T> timeWeights(const Vector<Params<T>>& params, T t) noexcept;
+
+template <std::floating_point T>
+std::array<T, 3> totalVarianceDerivatives(const Params<T>& params, T k) noexcept;
+} // namespace uv::models::svi::detail
+
+namespace uv::models::svi
+{
+template <std::floating_point T>
+T localVol(const Vector<Params<T>>& params, T t, T k, bool doValidate)
+{
+    std::array<T, 1> out{};
+    const std::array<T, 1> strikes{k};
+
+    localVol<T>(out, params, t, strikes, doValidate);
+
+    return out.front();
+}
+
+template <std::floating_point T> core::Matrix<T> localVol(
+    const Vector<Params<T>>& params,
+    std::span<const T> t,
+    std::span<const T> k,
+    bool doValidate
+)
+{
+    if (doValidate)
+    {
+        detail::validateSlices(params);
+        REQUIRE_NON_EMPTY(t);
+        REQUIRE_FINITE(t);
+        REQUIRE_POSITIVE(t);
+        REQUIRE_NON_EMPTY(k);
+        REQUIRE_FINITE(k);
+    }
+
+    core::Matrix<T> out{t.size(), k.size()};
+
+    for (std::size_t i{0}; i < t.size(); ++i)
+    {
+        localVol<T>(out[i], params, t[i], k, false);
+
+        if (doValidate)
+        {
+            REQUIRE_FINITE(std::span<const T>{out[i]});
+        }
+    }
+
+    return out;
+}
+
+template <std::floating_point T> void localVol(
+    std::span<T> out,
+    const Vector<Params<T>>& params,
+    T t,
+    std::span<const T> k,
+    bool doValidate
+)
+{
+    if (doValidate)
+    {
+        detail::validateSlices(params);
+        REQUIRE_FINITE(t);
+        REQUIRE_POSITIVE(t);
+        REQUIRE_FINITE(k);
+        REQUIRE_SAME_SIZE(out, k);
+    }
+
+    const detail::TimeWeights<T> weights{detail::timeWeights(params, t)};
+    const Params<T>& lower{params[weights.lower]};
+    const Params<T>& upper{params[weights.upper]};
+
+    // Dupire in total variance: sigma_loc^2 = (dw/dt) / g(k).
+    for (std::size_t j{0}; j < k.size(); ++j)
+    {
+        const std::array<T, 3> wLower{detail::totalVarianceDerivatives(lower, k[j])};
+        const std::array<T, 3> wUpper{detail::totalVarianceDerivatives(upper, k[j])};
+
+        const T w{weights.lowerWeight * wLower[0] + weights.upperWeight * wUpper[0]};
+        const T wD1{weights.lowerWeight * wLower[1] + weights.upperWeight * wUpper[1]};
+        const T wD2{weights.lowerWeight * wLower[2] + weights.upperWeight * wUpper[2]};
+        const T wDt{weights.lowerSlope * wLower[0] + weights.upperSlope * wUpper[0]};
+
+        out[j] = std::sqrt(wDt / gk(k[j], w, wD1, wD2));
+    }
+
+    if (doValidate)
+    {
+        REQUIRE_FINITE(std::span<const T>{out});
+    }
+}
+} // namespace uv::models::svi
+
+namespace uv::models::svi::detail
+{
+template <std::floating_point T> void validateSlices(const Vector<Params<T>>& params)
+{
+    if (params.empty())
+    {
+        errors::raise(errors::ErrorCode::InvalidArgument, "SVI slices must not be empty");
+    }
+    REQUIRE_POSITIVE(params.front().t);
+
+    for (std::size_t i{1}; i < params.size(); ++i)
+    {
+        REQUIRE_GREATER(params[i].t, params[i - 1].t);
+    }
+}
+
+// Total variance is linear in t at fixed k between slices, rises linearly from
+// zero before the first slice and extends the last segment beyond the last one.
+template <std::floating_point T>
+TimeWeights<T> timeWeights(const Vector<Params<T>>& params, T t) noexcept
+{
+    const std::size_t n{params.size()};
+
+    if (n == 1 || t <= params.front().t)
+    {
+        const T invT{T{1} / params.front().t};
+
+        return {0, 0, T{0}, t * invT, T{0}, invT};
+    }
+
+    std::size_t upper{1};
+
+    while (upper + 1 < n && params[upper].t < t)
+    {
+        ++upper;
+    }
+
+    const std::size_t lower{upper - 1};
+    const T invDt{T{1} / (params[upper].t - params[lower].t)};
+    const T upperWeight{(t - params[lower].t) * invDt};
+
+    return {lower, upper, T{1} - upperWeight, upperWeight, -invDt, invDt};
+}
+
+template <std::floating_point T>
+std::array<T, 3> totalVarianceDerivatives(const Params<T>& params, T k) noexcept
+{
+    const T x{k - params.m};
+    const T sigmaSquared{params.sigma * params.sigma};
+    const T R{std::sqrt(std::fma(x, x, sigmaSquared))};
+    const T invR{T{1} / R};
+
+    return {
+        std::fma(params.b, params.rho * x + R, params.a),
+        params.b * (params.rho + x * invR),
+        params.b * sigmaSquared * invR * invR * invR
+    };
+}
+} // namespace uv::models::svi::detail
@@ -26,24 +26,29 @@ template <std::floating_point T> T gk(T a, T b, T rho, T m, T sigma, T k) noexce
     T invR{1.0 / R};
 
     T wk{std::fma(b, (rho * x + R), a)};
-    T wkInv{1.0 / wk};
-
     T wkD1{b * (rho + x * invR)};
-    T wkD1Squared{wkD1 * wkD1};
 
     T invR2{invR * invR};
     T invRCubed{invR2 * invR};
 
     T wkD2{b * sigmaSquared * invRCubed};
 
-    T A{1.0 - 0.5 * k * wkD1 * wkInv};
-    T B{wkInv + 0.25};
-
-    return (A * A) - 0.25 * wkD1Squared * B + wkD2 * 0.5;
+    return gk(k, wk, wkD1, wkD2);
 }
 
 template <std::floating_point T> T gk(const Params<T>& params, T k) noexcept
 {
     return gk(params.a, params.b, params.rho, params.m, params.sigma, k);
 }
+
+template <std::floating_point T> T gk(T k, T wk, T wkD1, T wkD2) noexcept
+{
+    T wkInv{1.0 / wk};
+    T wkD1Squared{wkD1 * wkD1};
+
+    T A{1.0 - 0.5 * k * wkD1 * wkInv};
+    T B{wkInv + 0.25};
+
+    return (A * A) - 0.25 * wkD1Squared * B + wkD2 * 0.5;
+}
 } // namespace uv::models::svi
@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Types.hpp"
+#include "Core/Matrix.hpp"
+#include "Models/SVI/Params.hpp"
+
+#include <concepts>
+#include <span>
+
+namespace uv::models::svi
+{
+template <std::floating_point T>
+T localVol(const Vector<Params<T>>& params, T t, T k, bool doValidate = true);
+
+template <std::floating_point T> core::Matrix<T> localVol(
+    const Vector<Params<T>>& params,
+    std::span<const T> t,
+    std::span<const T> k,
+    bool doValidate = true
+);
+
+template <std::floating_point T> void localVol(
+    std::span<T> out,
+    const Vector<Params<T>>& params,
+    T t,
+    std::span<const T> k,
+    bool doValidate = true
+);
+
+} // namespace uv::models::svi
+
+#include "Models/SVI/Detail/LocalVol.inl"
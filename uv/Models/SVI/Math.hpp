@@ -18,6 +18,8 @@ template <std::floating_point T> T gk(T a, T b, T rho, T m, T sigma, T k) noexce
 
 template <std::floating_point T> T gk(const Params<T>& params, T k) noexcept;
 
+template <std::floating_point T> T gk(T k, T wk, T wkD1, T wkD2) noexcept;
+
 } // namespace uv::models::svi
 
 #include "Models/SVI/Detail/Math.inl"
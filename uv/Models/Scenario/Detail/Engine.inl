@@ -0,0 +1,369 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Base/Errors/Errors.hpp"
+#include "Base/Execution/Parallel.hpp"
+#include "Base/Macros/Require.hpp"
+#include "Base/Macros/Unreachable.hpp"
+#include "Math/Functions/Black.hpp"
+#include "Math/Functions/Volatility.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <utility>
+
+namespace uv::models::scenario::detail
+{
+// Scenarios that share a Heston parameter set.
+struct ShockGroup
+{
+    double vol;
+    double skew;
+    Vector<std::size_t> scenarios;
+};
+
+inline Vector<ShockGroup> groupByModelShift(std::span<const Shock> shocks)
+{
+    Vector<ShockGroup> groups;
+
+    for (std::size_t s{0}; s < shocks.size(); ++s)
+    {
+        // codeql-suppress[cpp/equality-on-floats]: scenarios built from the same
+        // shift carry identical values.
+        const auto it{std::find_if(
+            groups.begin(),
+            groups.end(),
+            [&](const ShockGroup& g)
+            { return g.vol == shocks[s].vol && g.skew == shocks[s].skew; }
+        )};
+
+        if (it == groups.end())
+            groups.push_back({shocks[s].vol, shocks[s].skew, {s}});
+        else
+            it->scenarios.push_back(s);
+    }
+
+    return groups;
+}
+
+inline void validateShocks(std::span<const Shock> shocks)
+{
+    for (std::size_t s{0}; s < shocks.size(); ++s)
+    {
+        const Shock& shock{shocks[s]};
+
+        if (!std::isfinite(shock.spot) || !std::isfinite(shock.vol) ||
+            !std::isfinite(shock.skew) || !std::isfinite(shock.rate) ||
+            !(shock.spot > -1.0))
+        {
+            errors::raise(
+                errors::ErrorCode::InvalidArgument,
+                std::format(
+                    "Scenario {} is invalid: spot={}, vol={}, skew={}, rate={}",
+                    s,
+                    shock.spot,
+                    shock.vol,
+                    shock.skew,
+                    shock.rate
+                )
+            );
+        }
+    }
+}
+
+template <std::floating_point T>
+heston::Params<T> shockedParams(const heston::Params<T>& params, const Shock& shock)
+{
+    const T sqrtV0{std::sqrt(params.v0) + static_cast<T>(shock.vol)};
+    const T sqrtTheta{std::sqrt(params.theta) + static_cast<T>(shock.vol)};
+    const T rho{params.rho + static_cast<T>(shock.skew)};
+
+    if (!(sqrtV0 > T{0}) || !(sqrtTheta > T{0}))
+    {
+        errors::raise(
+            errors::ErrorCode::OutOfRange,
+            std::format("Vol shift {} leaves no Heston variance", shock.vol)
+        );
+    }
+
+    if (!(rho > T{-1}) || !(rho < T{1}))
+    {
+        errors::raise(
+            errors::ErrorCode::OutOfRange,
+            std::format("Skew shift {} moves rho to {}, outside (-1, 1)", shock.skew, rho)
+        );
+    }
+
+    return {params.kappa, sqrtTheta * sqrtTheta, params.sigma, rho, sqrtV0 * sqrtV0};
+}
+} // namespace uv::models::scenario::detail
+
+namespace uv::models::scenario
+{
+template <std::floating_point T>
+Grid<T>::Grid(std::size_t numScenarios, std::size_t numMaturities, std::size_t numStrikes)
+    : numScenarios_{numScenarios},
+      numMaturities_{numMaturities},
+      numStrikes_{numStrikes},
+      data_(numScenarios * numMaturities * numStrikes)
+{
+}
+
+template <std::floating_point T>
+T& Grid<T>::operator()(std::size_t s, std::size_t i, std::size_t j) noexcept
+{
+    return data_[(s * numMaturities_ + i) * numStrikes_ + j];
+}
+
+template <std::floating_point T>
+const T& Grid<T>::operator()(std::size_t s, std::size_t i, std::size_t j) const noexcept
+{
+    return data_[(s * numMaturities_ + i) * numStrikes_ + j];
+}
+
+template <std::floating_point T>
+std::span<T> Grid<T>::row(std::size_t s, std::size_t i) noexcept
+{
+    return {data_.data() + (s * numMaturities_ + i) * numStrikes_, numStrikes_};
+}
+
+template <std::floating_point T>
+std::span<const T> Grid<T>::row(std::size_t s, std::size_t i) const noexcept
+{
+    return {data_.data() + (s * numMaturities_ + i) * numStrikes_, numStrikes_};
+}
+
+template <std::floating_point T> std::size_t Grid<T>::numScenarios() const noexcept
+{
+    return numScenarios_;
+}
+
+template <std::floating_point T> std::size_t Grid<T>::numMaturities() const noexcept
+{
+    return numMaturities_;
+}
+
+template <std::floating_point T> std::size_t Grid<T>::numStrikes() const noexcept
+{
+    return numStrikes_;
+}
+
+template <std::floating_point T> std::span<const T> Grid<T>::data() const noexcept
+{
+    return data_;
+}
+
+template <std::floating_point T, std::size_t N>
+Engine<T, N>::Engine(const core::MarketState<T>& base, const Config& config)
+    : config_{config},
+      maturities_{convertVector<T>(base.volSurface.maturities())},
+      discountFactors_{base.interestCurve.interpolateDF(base.volSurface.maturities())},
+      forwards_{convertVector<T>(base.volSurface.forwards())},
+      strikes_{convertVector<T>(base.volSurface.strikes())},
+      vol_{base.volSurface.vol()},
+      logKF_{math::vol::logKF(base.volSurface)},
+      hestonParams_{},
+      pricer_{}
+{
+}
+
+template <std::floating_point T, std::size_t N> Engine<T, N>::Engine(
+    const core::MarketState<T>& base,
+    const heston::Params<T>& hestonParams,
+    const Config& config
+)
+    : Engine(base, config)
+{
+    hestonParams_ = hestonParams;
+    pricer_.setParams(hestonParams);
+}
+
+template <std::floating_point T, std::size_t N>
+Grid<T> Engine<T, N>::revalue(std::span<const Shock> shocks, Model model) const
+{
+    detail::validateShocks(shocks);
+
+    switch (model)
+    {
+        using enum Model;
+
+    case Black:
+        return revalueBlack(shocks);
+    case Heston:
+        return revalueHeston(shocks);
+    }
+
+    UNREACHABLE(Model, model);
+}
+
+template <std::floating_point T, std::size_t N>
+std::size_t Engine<T, N>::numMaturities() const noexcept
+{
+    return maturities_.size();
+}
+
+template <std::floating_point T, std::size_t N>
+std::size_t Engine<T, N>::numStrikes() const noexcept
+{
+    return strikes_.size();
+}
+
+template <std::floating_point T, std::size_t N>
+Grid<T> Engine<T, N>::revalueBlack(std::span<const Shock> shocks) const
+{
+    const std::size_t numMaturities{maturities_.size()};
+    const std::size_t numStrikes{strikes_.size()};
+
+    Grid<T> out{shocks.size(), numMaturities, numStrikes};
+
+    execution::parallelFor(
+        0,
+        shocks.size() * numMaturities,
+        [&](std::size_t task)
+        {
+            const std::size_t s{task / numMaturities};
+            const std::size_t i{task % numMaturities};
+            const Shock& shock{shocks[s]};
+
+            const T t{maturities_[i]};
+            const T growth{std::exp(static_cast<T>(shock.rate) * t)};
+            const T dF{discountFactors_[i] / growth};
+            const T F{forwards_[i] * (T{1} + static_cast<T>(shock.spot)) * growth};
+
+            // Sticky strike: each strike keeps its vol, tilted around the base
+            // forward. Strikes are priced one at a time so that a task needs no
+            // scratch.
+            const std::span<T> row{out.row(s, i)};
+            for (std::size_t j{0}; j < numStrikes; ++j)
+            {
+                const T vol{
+                    vol_[i][j] + static_cast<T>(shock.vol) +
+                    static_cast<T>(shock.skew) * logKF_[i][j]
+                };
+
+                if (!(vol > T{0}))
+                {
+                    errors::raise(
+                        errors::ErrorCode::OutOfRange,
+                        std::format(
+                            "Scenario {} leaves a non-positive vol at t={}, K={}",
+                            s,
+                            t,
+                            strikes_[j]
+                        )
+                    );
+                }
+
+                row[j] = math::black::priceB76<T>(t, dF, F, vol, strikes_[j], false);
+            }
+        },
+        config_.numThreads
+    );
+
+    return out;
+}
+
+template <std::floating_point T, std::size_t N>
+Grid<T> Engine<T, N>::revalueHeston(std::span<const Shock> shocks) const
+{
+    if (!hestonParams_.has_value())
+    {
+        errors::raise(
+            errors::ErrorCode::InvalidState,
+            "Heston revaluation needs an engine built with Heston parameters"
+        );
+    }
+
+    const std::size_t numMaturities{maturities_.size()};
+    const std::size_t numStrikes{strikes_.size()};
+
+    Grid<T> out{shocks.size(), numMaturities, numStrikes};
+
+    const Vector<detail::ShockGroup> groups{detail::groupByModelShift(shocks)};
+
+    Vector<Pricer> pricers;
+    pricers.reserve(groups.size());
+
+    for (const detail::ShockGroup& group : groups)
+    {
+        Pricer pricer{pricer_};
+        pricer.setParams(
+            detail::shockedParams(*hestonParams_, shocks[group.scenarios.front()])
+        );
+        pricers.push_back(std::move(pricer));
+    }
+
+    // Shocked discount factors and forwards, and the scratch the tasks price into,
+    // are laid out group by group and sized once: the offset of group g is the
+    // number of scenarios in the groups before it.
+    Vector<std::size_t> offsets(groups.size() + 1, 0);
+    for (std::size_t g{0}; g < groups.size(); ++g)
+        offsets[g + 1] = offsets[g] + groups[g].scenarios.size();
+
+    Vector<T> dF(shocks.size() * numMaturities);
+    Vector<T> F(shocks.size() * numMaturities);
+    Vector<T> prices(shocks.size() * numMaturities * numStrikes);
+
+    for (std::size_t g{0}; g < groups.size(); ++g)
+    {
+        const Vector<std::size_t>& scenarios{groups[g].scenarios};
+        const std::size_t m{scenarios.size()};
+
+        for (std::size_t i{0}; i < numMaturities; ++i)
+        {
+            const T t{maturities_[i]};
+            const std::size_t first{offsets[g] * numMaturities + i * m};
+
+            for (std::size_t k{0}; k < m; ++k)
+            {
+                const Shock& shock{shocks[scenarios[k]]};
+                const T growth{std::exp(static_cast<T>(shock.rate) * t)};
+
+                dF[first + k] = discountFactors_[i] / growth;
+                F[first + k] =
+                    forwards_[i] * (T{1} + static_cast<T>(shock.spot)) * growth;
+            }
+        }
+    }
+
+    const std::size_t tasksPerGroup{numMaturities * numStrikes};
+
+    execution::parallelFor(
+        0,
+        groups.size() * tasksPerGroup,
+        [&](std::size_t task)
+        {
+            const std::size_t g{task / tasksPerGroup};
+            const std::size_t i{(task % tasksPerGroup) / numStrikes};
+            const std::size_t j{task % numStrikes};
+
+            const Vector<std::size_t>& scenarios{groups[g].scenarios};
+            const std::size_t m{scenarios.size()};
+
+            const std::size_t curve{offsets[g] * numMaturities + i * m};
+            const std::size_t slot{offsets[g] * tasksPerGroup + (i * numStrikes + j) * m};
+
+            const std::span<const T> groupDF{std::span<const T>{dF}.subspan(curve, m)};
+            const std::span<const T> groupF{std::span<const T>{F}.subspan(curve, m)};
+            const std::span<T> groupPrices{std::span<T>{prices}.subspan(slot, m)};
+
+            // Spot and rate shocks only move the forward, so the whole group
+            // shares the characteristic function at every quadrature node.
+            pricers[g].callPriceForwards(
+                groupPrices,
+                maturities_[i],
+                groupDF,
+                groupF,
+                strikes_[j],
+                false
+            );
+
+            for (std::size_t k{0}; k < m; ++k)
+                out(scenarios[k], i, j) = groupPrices[k];
+        },
+        config_.numThreads
+    );
+
+    return out;
+}
+} // namespace uv::models::scenario
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Types.hpp"
+#include "Core/MarketState.hpp"
+#include "Core/Matrix.hpp"
+#include "Models/Heston/Params.hpp"
+#include "Models/Heston/Price/Config.hpp"
+#include "Models/Heston/Price/Pricer.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <span>
+
+namespace uv::models::scenario
+{
+// One stress of the base market. Every field is a shift from the base, so a
+// default Shock revalues the base itself.
+struct Shock
+{
+    // Relative spot move: 0.05 revalues at 105% of the base spot.
+    double spot{0.0};
+    // Parallel shift of implied vols. Under Heston it shifts sqrt(v0) and
+    // sqrt(theta) instead.
+    double vol{0.0};
+    // Implied vol added per unit of base log-moneyness log(K/F). Under Heston it
+    // shifts rho instead.
+    double skew{0.0};
+    // Parallel shift of the continuously compounded interest rate; the dividend
+    // yield is unchanged.
+    double rate{0.0};
+};
+
+enum class Model
+{
+    // Black-76 on the base surface's vols, sticky strike.
+    Black,
+    Heston
+};
+
+struct Config
+{
+    int numThreads{-1};
+};
+
+// Call prices for every scenario on the base (t, K) grid, scenario-major.
+template <std::floating_point T> class Grid
+{
+  public:
+    Grid() = delete;
+
+    Grid(std::size_t numScenarios, std::size_t numMaturities, std::size_t numStrikes);
+
+    T& operator()(std::size_t s, std::size_t i, std::size_t j) noexcept;
+    const T& operator()(std::size_t s, std::size_t i, std::size_t j) const noexcept;
+
+    // Prices of scenario s at maturity i, one per strike.
+    std::span<T> row(std::size_t s, std::size_t i) noexcept;
+    std::span<const T> row(std::size_t s, std::size_t i) const noexcept;
+
+    std::size_t numScenarios() const noexcept;
+    std::size_t numMaturities() const noexcept;
+    std::size_t numStrikes() const noexcept;
+
+    std::span<const T> data() const noexcept;
+
+  private:
+    std::size_t numScenarios_;
+    std::size_t numMaturities_;
+    std::size_t numStrikes_;
+    Vector<T> data_;
+};
+
+// Revalues the base surface's option grid under many shocks without rebuilding
+// market state per shock. Axes, discount factors, base forwards, vols and
+// log-moneyness are computed once. Under Heston, shocks that only move spot or
+// rates leave the model untouched, so all of them are priced per strike from one
+// set of characteristic-function evaluations; only distinct vol and skew shifts
+// need their own. Scenarios run in parallel.
+template <std::floating_point T, std::size_t N = heston::price::defaultNodes>
+class Engine
+{
+  public:
+    using Pricer = heston::price::Pricer<T, N>;
+
+    Engine() = delete;
+
+    explicit Engine(const core::MarketState<T>& base, const Config& config = {});
+
+    Engine(
+        const core::MarketState<T>& base,
+        const heston::Params<T>& hestonParams,
+        const Config& config = {}
+    );
+
+    Grid<T> revalue(std::span<const Shock> shocks, Model model) const;
+
+    std::size_t numMaturities() const noexcept;
+    std::size_t numStrikes() const noexcept;
+
+  private:
+    Grid<T> revalueBlack(std::span<const Shock> shocks) const;
+    Grid<T> revalueHeston(std::span<const Shock> shocks) const;
+
+    Config config_;
+
+    Vector<T> maturities_;
+    Vector<T> discountFactors_;
+    Vector<T> forwards_;
+    Vector<T> strikes_;
+    core::Matrix<T> vol_;
+    core::Matrix<T> logKF_;
+
+    std::optional<heston::Params<T>> hestonParams_;
+    Pricer pricer_;
+};
+} // namespace uv::models::scenario
+
+#include "Models/Scenario/Detail/Engine.inl"
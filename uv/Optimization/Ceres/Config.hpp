@@ -3,6 +3,7 @@
 #pragma once
 
 #include <Base/Types.hpp>
+#include <Optimization/Stop.hpp>
 
 #include <string_view>
 
@@ -60,6 +61,8 @@ struct Config
     Verbosity verbosity;
 
     int numThreads{1};
+
+    StopCondition stop{};
 };
 
 } // namespace uv::opt::ceres
\ No newline at end of file
@@ -3,9 +3,11 @@
 #pragma once
 
 #include "Optimization/Ceres/Config.hpp"
+#include "Optimization/Stop.hpp"
 
 #include <ceres/ceres.h>
 #include <memory>
+#include <optional>
 
 namespace uv::opt::ceres::detail
 {
@@ -15,4 +17,25 @@ namespace uv::opt::ceres::detail
 
 std::unique_ptr<::ceres::LossFunction> makeLoss(Loss, double lossParam);
 
+// Ends the solve after the current iteration once the stop condition fires. Ceres
+// then writes the last accepted step back to the parameter block.
+class StopCallback final : public ::ceres::IterationCallback
+{
+  public:
+    explicit StopCallback(const StopCondition& stop) noexcept;
+
+    ::ceres::CallbackReturnType operator()(const ::ceres::IterationSummary&) override;
+
+    std::optional<Termination> reason() const noexcept;
+
+  private:
+    const StopCondition& stop_;
+    std::optional<Termination> reason_;
+};
+
+Termination toTermination(
+    ::ceres::TerminationType type,
+    std::optional<Termination> stopReason
+) noexcept;
+
 } // namespace uv::opt::ceres::detail
@@ -1,11 +1,16 @@
 ﻿// SPDX-License-Identifier: Apache-2.0
 
 #include "Base/Execution/ThreadPolicy.hpp"
+#include "Base/Macros/Profile.hpp"
 #include "Base/Macros/Require.hpp"
 #include "Base/Utils/ConsoleRedirect.hpp"
+#include "Base/Utils/Metrics.hpp"
 #include "Optimization/Ceres/Config.hpp"
+#include "Optimization/Ceres/Detail/CeresAdapter.hpp"
 #include "Optimization/Helpers.hpp"
 
+#include <string_view>
+
 namespace uv::opt::ceres
 {
 
@@ -144,9 +149,17 @@ template <typename PolicyT> void Optimizer<PolicyT>::solveInPlace()
     requireInitialized();
     requireRunStarted();
 
+    PROFILE_ZONE("ceres::solve");
+
     const Verbosity v{config_.verbosity};
 
     ::ceres::Solver::Summary summary;
+    detail::StopCallback stopCallback{config_.stop};
+
+    options_.callbacks.clear();
+
+    if (config_.stop.active())
+        options_.callbacks.push_back(&stopCallback);
 
     if (v == Verbosity::FullReport)
     {
@@ -160,6 +173,18 @@ template <typename PolicyT> void Optimizer<PolicyT>::solveInPlace()
         ::ceres::Solve(options_, &problem_, &summary);
     }
 
+    options_.callbacks.clear();
+    termination_ = detail::toTermination(summary.termination_type, stopCallback.reason());
+
+    utils::Metrics::add(
+        utils::Counter::CeresResidual,
+        static_cast<std::uint64_t>(summary.num_residual_evaluations)
+    );
+    utils::Metrics::add(
+        utils::Counter::CeresJacobian,
+        static_cast<std::uint64_t>(summary.num_jacobian_evaluations)
+    );
+
     if (v == Verbosity::None)
         return;
 
@@ -171,8 +196,9 @@ template <typename PolicyT> void Optimizer<PolicyT>::solveInPlace()
         summary.final_cost * 2.0,
         summary.iterations.size(),
         summary.total_time_in_seconds * 1000.0,
-        (summary.termination_type == ::ceres::CONVERGENCE ||
-         summary.termination_type == ::ceres::USER_SUCCESS)
+        termination_ == Termination::Converged,
+        (termination_ == Termination::Converged) ? std::string_view{}
+                                                 : toString(termination_)
     );
 }
 
@@ -189,4 +215,9 @@ template <typename Policy> std::span<const double> Optimizer<Policy>::params() c
     return std::span<const double>{x_};
 }
 
+template <typename Policy> Termination Optimizer<Policy>::termination() const noexcept
+{
+    return termination_;
+}
+
 } // namespace uv::opt::ceres
@@ -5,6 +5,7 @@
 #include "Base/Types.hpp"
 #include "Optimization/Ceres/Config.hpp"
 #include "Optimization/Ceres/Policy.hpp"
+#include "Optimization/Stop.hpp"
 
 #include <ceres/ceres.h>
 #include <memory>
@@ -22,6 +23,7 @@ template <typename PolicyT = Policy<>> class Optimizer
 
     bool isInitialized_{false};
     bool isRunStarted_{false};
+    Termination termination_{Termination::Converged};
 
     std::optional<Vector<double>> lowerBounds_;
     std::optional<Vector<double>> upperBounds_;
@@ -61,6 +63,8 @@ template <typename PolicyT = Policy<>> class Optimizer
     std::span<const double> solve();
 
     std::span<const double> params() const;
+
+    Termination termination() const noexcept;
 };
 } // namespace uv::opt::ceres
 
@@ -0,0 +1,9 @@
+// SPDX-License-Identifier: Apache-2.0
+
+namespace uv::opt
+{
+template <typename P> bool Result<P>::truncated() const noexcept
+{
+    return isTruncated(termination);
+}
+} // namespace uv::opt
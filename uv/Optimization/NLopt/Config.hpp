@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "Optimization/Stop.hpp"
+
 #include <array>
 #include <cstddef>
 #include <string_view>
@@ -17,5 +19,6 @@ template <std::size_t N> struct Config
     unsigned int maxEval{};
     bool verbose{};
     std::array<std::string_view, N> paramNames;
+    StopCondition stop{};
 };
 } // namespace uv::opt::nlopt
@@ -2,7 +2,10 @@
 
 #pragma once
 
+#include "Optimization/Stop.hpp"
+
 #include <nlopt.hpp>
+#include <optional>
 #include <string_view>
 
 namespace uv::opt::nlopt::detail
@@ -30,4 +33,6 @@ std::string_view toString(NLoptStatus) noexcept;
 
 std::string_view toString(const ::nlopt::result&) noexcept;
 
+Termination toTermination(NLoptStatus, std::optional<Termination> stopReason) noexcept;
+
 } // namespace uv::opt::nlopt::detail
@@ -2,6 +2,7 @@
 
 #include "Base/Errors/Errors.hpp"
 #include "Base/Macros/Require.hpp"
+#include "Base/Utils/Metrics.hpp"
 #include "Optimization/Helpers.hpp"
 #include "Optimization/NLopt/Detail/MapAlgorithm.hpp"
 #include "Optimization/NLopt/Detail/NLoptStatus.hpp"
@@ -56,13 +57,52 @@ template <std::size_t N, Algorithm Algo> double Optimizer<N, Algo>::objectiveThu
 {
     auto* self = static_cast<Optimizer<N, Algo>*>(p);
     ++self->iterCount_;
+
+    // NLopt finishes this evaluation and returns the best point found so far.
+    if (!self->stopReason_)
+    {
+        self->stopReason_ = self->config_.stop.check();
+
+        if (self->stopReason_)
+            self->opt_.force_stop();
+    }
+
     return self->userFn_ ? self->userFn_(n, x, grad, self->userData_) : 0.0;
 }
 
+template <std::size_t N, Algorithm Algo> double Optimizer<N, Algo>::constraintThunk(
+    unsigned n,
+    const double* x,
+    double* grad,
+    void* p // NOSONAR -- NLopt's C callback ABI requires an opaque void pointer.
+) noexcept
+{
+    const auto* c = static_cast<const Constraint*>(p);
+    utils::Metrics::add(utils::Counter::NLoptConstraint);
+
+    return c->fn(n, x, grad, c->data);
+}
+
+template <std::size_t N, Algorithm Algo> void Optimizer<N, Algo>::mconstraintThunk(
+    unsigned m,
+    double* result,
+    unsigned n,
+    const double* x,
+    double* grad,
+    void* p // NOSONAR -- NLopt's C callback ABI requires an opaque void pointer.
+) noexcept
+{
+    const auto* c = static_cast<const Constraint*>(p);
+    utils::Metrics::add(utils::Counter::NLoptConstraint);
+
+    c->mfn(m, result, n, x, grad, c->data);
+}
+
 template <std::size_t N, Algorithm Algo>
 void Optimizer<N, Algo>::addInequalityConstraint(NloptFunction c, void* data) // NOSONAR
 {
-    opt_.add_inequality_constraint(c, data, config_.tol);
+    Constraint& constraint{constraints_.emplace_back(Constraint{c, nullptr, data})};
+    opt_.add_inequality_constraint(&constraintThunk, &constraint, config_.tol);
 }
 
 template <std::size_t N, Algorithm Algo>
@@ -73,7 +113,8 @@ void Optimizer<N, Algo>::addInequalityMConstraint(
 )
 {
     Vector<double> tol(m, config_.tol);
-    opt_.add_inequality_mconstraint(c, data, tol);
+    Constraint& constraint{constraints_.emplace_back(Constraint{nullptr, c, data})};
+    opt_.add_inequality_mconstraint(&mconstraintThunk, &constraint, tol);
 }
 
 template <std::size_t N, Algorithm Algo>
@@ -83,7 +124,7 @@ void Optimizer<N, Algo>::setMinObjective(NloptFunction f, void* data) // NOSONAR
     userFn_ = f;
     userData_ = data;
 
-    if (config_.verbose)
+    if (config_.verbose || config_.stop.active())
     {
         opt_.set_min_objective(&Optimizer<N, Algo>::objectiveThunk, this);
     }
@@ -99,11 +140,28 @@ template <std::size_t N, Algorithm Algo> Vector<double> Optimizer<N, Algo>::opti
     Vector<double> x(initGuess_.cbegin(), initGuess_.cend());
     double sse{0.0};
 
+    stopReason_.reset();
     timer_.StartStopWatch();
 
-    ::nlopt::result successCode = opt_.optimize(x, sse);
+    ::nlopt::result successCode{::nlopt::FORCED_STOP};
+
+    try
+    {
+        successCode = opt_.optimize(x, sse);
+    }
+    catch (const ::nlopt::forced_stop&)
+    {
+        // The C++ wrapper reports force_stop() by throwing; x and sse already hold
+        // the best point found, which is returned as a truncated result.
+    }
 
     timer_.StopStopWatch();
+    termination_ = detail::toTermination(detail::toStatus(successCode), stopReason_);
+
+    utils::Metrics::add(
+        utils::Counter::NLoptObjective,
+        static_cast<std::uint64_t>(opt_.get_numevals())
+    );
 
     if (config_.verbose)
     {
@@ -151,4 +209,10 @@ const double& Optimizer<N, Algo>::userValue() const
 
     return *userValue_;
 }
+
+template <std::size_t N, Algorithm Algo>
+Termination Optimizer<N, Algo>::termination() const noexcept
+{
+    return termination_;
+}
 } // namespace uv::opt::nlopt
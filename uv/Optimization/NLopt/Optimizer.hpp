@@ -7,9 +7,11 @@
 #include "Base/Utils/StopWatch.hpp"
 #include "Optimization/NLopt/Algorithm.hpp"
 #include "Optimization/NLopt/Config.hpp"
+#include "Optimization/Stop.hpp"
 
 #include <array>
 #include <cstddef>
+#include <deque>
 #include <nlopt.hpp>
 #include <optional>
 
@@ -28,8 +30,17 @@ template <std::size_t N, Algorithm Algo> class Optimizer
         void* data
     );
 
+    // Forwards a constraint callback so that its evaluations can be counted.
+    struct Constraint
+    {
+        NloptFunction fn{nullptr};
+        NloptMFunction mfn{nullptr};
+        void* data{nullptr};
+    };
+
     Config<N> config_;
     ::nlopt::opt opt_;
+    std::deque<Constraint> constraints_;
     utils::StopWatch timer_;
 
     std::array<double, N> lowerBounds_{};
@@ -41,10 +52,24 @@ template <std::size_t N, Algorithm Algo> class Optimizer
     unsigned iterCount_{0U};
 
     std::optional<double> userValue_;
+    std::optional<Termination> stopReason_;
+    Termination termination_{Termination::Converged};
 
     [[gnu::hot]] static double
     objectiveThunk(unsigned n, const double* x, double* grad, void* p) noexcept;
 
+    static double
+    constraintThunk(unsigned n, const double* x, double* grad, void* p) noexcept;
+
+    static void mconstraintThunk(
+        unsigned m,
+        double* result,
+        unsigned n,
+        const double* x,
+        double* grad,
+        void* p
+    ) noexcept;
+
   public:
     Optimizer() = delete;
 
@@ -73,6 +98,8 @@ template <std::size_t N, Algorithm Algo> class Optimizer
     double tol() const noexcept;
 
     const double& userValue() const;
+
+    Termination termination() const noexcept;
 };
 } // namespace uv::opt::nlopt
 
@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <stop_token>
+#include <string_view>
+
+namespace uv::opt
+{
+// Ordered by severity so that a surface reports the worst outcome of its slices.
+enum class Termination
+{
+    Converged,
+    MaxEval,
+    Failed,
+    DeadlineExceeded,
+    Cancelled
+};
+
+// Cooperative stop request polled by the optimizers between iterations. A default
+// constructed condition never fires.
+struct StopCondition
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::stop_token token{};
+    Clock::time_point deadline{Clock::time_point::max()};
+
+    static StopCondition within(Clock::duration budget, std::stop_token token = {});
+
+    bool active() const noexcept;
+
+    std::optional<Termination> check() const noexcept;
+};
+
+template <typename P> struct Result
+{
+    P params;
+    Termination termination{Termination::Converged};
+
+    bool truncated() const noexcept;
+};
+
+bool isTruncated(Termination termination) noexcept;
+
+Termination worst(Termination a, Termination b) noexcept;
+
+std::string_view toString(Termination termination) noexcept;
+} // namespace uv::opt
+
+#include "Optimization/Detail/Stop.inl"
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Types.hpp"
+#include "Core/MarketData.hpp"
+#include "Models/Heston/Params.hpp"
+#include "Models/Heston/Price/Pricer.hpp"
+#include "Models/SVI/Params.hpp"
+#include "Service/Protocol.hpp"
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+namespace uv::service
+{
+// Everything the service needs to price off one calibrated underlying. Rates are
+// flat, so any requested maturity can be discounted, not only the quoted ones.
+struct CalibratedSurface
+{
+    std::string name;
+    core::MarketData<double> marketData;
+    Vector<models::svi::Params<double>> sviParams;
+    models::heston::Params<double> hestonParams;
+};
+
+// Answers a batch of requests. Requests for the same surface, model and maturity
+// share one forward and discount factor and one strike-batched pricing call, plus
+// one call per spot bump when any of them asks for greeks. Greeks are spot delta
+// and gamma from central differences on a relative spot bump, and Black vega at
+// the request's implied vol.
+class BatchPricer
+{
+  public:
+    BatchPricer() = delete;
+
+    explicit BatchPricer(Vector<CalibratedSurface> surfaces, double spotBump = 1e-4);
+
+    // Fills one response per request, in request order, and returns the number of
+    // strike-batched pricing calls it made. Stats requests are left to the caller
+    // and answered with InvalidRequest.
+    std::size_t
+    price(std::span<const Request> requests, std::span<Response> responses) const;
+
+    std::size_t numSurfaces() const noexcept;
+
+  private:
+    struct Entry
+    {
+        CalibratedSurface surface;
+        models::heston::price::Pricer<double> pricer;
+    };
+
+    Vector<Entry> entries_;
+    std::unordered_map<std::string, std::size_t> index_;
+    double spotBump_;
+};
+} // namespace uv::service
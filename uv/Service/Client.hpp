@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Types.hpp"
+#include "Service/Detail/Socket.hpp"
+#include "Service/Protocol.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace uv::service
+{
+// Blocking client for the pricing service; one connection, not thread-safe.
+class Client
+{
+  public:
+    Client() = delete;
+
+    explicit Client(const std::filesystem::path& socketPath);
+
+    Response call(const Request& request);
+
+    // Sends every request before reading any response so the server can price them
+    // as one batch. Responses are returned in request order. The server drops a
+    // client with more than Config::maxPendingResponses unread responses, so very
+    // large batches should be split.
+    Vector<Response> call(std::span<const Request> requests);
+
+    // The server's latency summary as {requests, p50, p99, max} in microseconds.
+    Response stats();
+
+  private:
+    void send(const Request& request);
+    Response receive(std::uint64_t expectedId);
+
+    detail::Socket socket_;
+    std::uint64_t nextStatsId_{0};
+};
+} // namespace uv::service
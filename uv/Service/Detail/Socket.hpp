@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace uv::service::detail
+{
+// Owns a socket descriptor and closes it on destruction.
+class Socket
+{
+  public:
+    Socket() noexcept = default;
+    explicit Socket(int fd) noexcept;
+
+    Socket(const Socket&) = delete;
+    Socket& operator=(const Socket&) = delete;
+
+    Socket(Socket&& other) noexcept;
+    Socket& operator=(Socket&& other) noexcept;
+
+    ~Socket();
+
+    int fd() const noexcept;
+    explicit operator bool() const noexcept;
+
+    // Wakes any thread blocked reading, writing or accepting on this socket.
+    void shutdown() noexcept;
+
+    // Ends the read side only: blocked reads return end of stream while writes
+    // still go through.
+    void shutdownRead() noexcept;
+
+  private:
+    int fd_{-1};
+};
+
+bool socketsSupported() noexcept;
+
+// Binds and listens on a Unix domain socket, replacing a stale socket file.
+Socket listenUnix(const std::filesystem::path& path, int backlog = 64);
+
+Socket connectUnix(const std::filesystem::path& path);
+
+// Returns an invalid socket once the listener has been shut down.
+Socket acceptConnection(const Socket& listener);
+
+// Reads exactly buffer.size() bytes. Returns false on a clean end of stream before
+// the first byte and raises FileIO on an error or a truncated read.
+bool readExact(const Socket& socket, std::span<std::byte> buffer);
+
+// Makes a send that cannot progress for this long fail, so writeExact raises
+// instead of blocking on a peer that stops reading. Zero waits indefinitely.
+void setSendTimeout(const Socket& socket, std::chrono::microseconds timeout);
+
+void writeExact(const Socket& socket, std::span<const std::byte> buffer);
+} // namespace uv::service::detail
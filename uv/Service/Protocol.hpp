@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace uv::service
+{
+inline constexpr std::uint8_t ProtocolVersion{1};
+
+// Surface names travel as a length-prefixed byte string after the request header.
+inline constexpr std::size_t MaxSurfaceNameLength{255};
+
+enum class RequestKind : std::uint8_t
+{
+    Price,
+    Vol,
+    // Price, spot delta, spot gamma and Black vega.
+    Greeks,
+    // Server latency: request count, p50, p99 and max in microseconds.
+    Stats
+};
+
+enum class Model : std::uint8_t
+{
+    Heston,
+    // Black-76 on the calibrated SVI smile.
+    SVI
+};
+
+enum class OptionType : std::uint8_t
+{
+    Call,
+    Put
+};
+
+enum class Status : std::uint8_t
+{
+    Ok,
+    UnknownSurface,
+    InvalidRequest,
+    PricingError
+};
+
+struct Request
+{
+    std::uint64_t id{};
+    RequestKind kind{RequestKind::Price};
+    Model model{Model::Heston};
+    OptionType optionType{OptionType::Call};
+    std::string surface;
+    double maturity{};
+    double strike{};
+};
+
+// Wire layout, native byte order: the service only listens on a local socket, so
+// client and server always share one machine. Each request is a header followed by
+// surfaceLength bytes of surface name; each response is a single frame.
+struct RequestHeader
+{
+    std::array<char, 4> magic{'U', 'V', 'P', 'Q'};
+    std::uint8_t version{ProtocolVersion};
+    RequestKind kind{};
+    Model model{};
+    OptionType optionType{};
+    std::uint64_t id{};
+    double maturity{};
+    double strike{};
+    std::uint16_t surfaceLength{};
+    std::array<std::uint8_t, 6> reserved{};
+};
+
+struct Response
+{
+    std::array<char, 4> magic{'U', 'V', 'P', 'R'};
+    std::uint8_t version{ProtocolVersion};
+    Status status{Status::Ok};
+    std::uint16_t reserved{};
+    std::uint64_t id{};
+    // Price: {price}; Vol: {vol}; Greeks: {price, delta, gamma, vega};
+    // Stats: {requests, p50, p99, max}. Unused entries are zero.
+    std::array<double, 4> values{};
+};
+
+static_assert(sizeof(RequestHeader) == 40);
+static_assert(sizeof(Response) == 48);
+
+RequestHeader makeHeader(const Request& request);
+
+// Checks magic, version and enum ranges and raises DataFormat on a bad frame.
+void validate(const RequestHeader& header);
+
+void validate(const Response& response);
+
+Request makeRequest(const RequestHeader& header, std::string surface);
+
+std::string_view toString(Status status) noexcept;
+} // namespace uv::service
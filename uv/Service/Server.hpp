@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Base/Types.hpp"
+#include "Service/BatchPricer.hpp"
+#include "Service/Detail/Socket.hpp"
+#include "Service/Protocol.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+
+namespace uv::service
+{
+struct Config
+{
+    std::filesystem::path socketPath;
+    // Most requests priced in one batch.
+    std::size_t maxBatch{256};
+    // After the first request of a batch arrives, wait this long for concurrent
+    // requests to join it. Zero batches only what is already queued.
+    std::chrono::microseconds batchWindow{100};
+    // Latencies kept for the percentiles; older ones are overwritten.
+    std::size_t latencySamples{1 << 16};
+    // Responses queued for one connection. A client that falls this far behind
+    // is not reading them and is disconnected.
+    std::size_t maxPendingResponses{4096};
+    // A response write that makes no progress for this long also disconnects the
+    // client. Zero waits indefinitely.
+    std::chrono::milliseconds writeTimeout{1000};
+};
+
+struct LatencySummary
+{
+    std::size_t requests{};
+    std::size_t batches{};
+    std::size_t pricingCalls{};
+    // From the request being read off the socket to its response being queued
+    // for the connection's writer.
+    double p50Us{};
+    double p90Us{};
+    double p99Us{};
+    double maxUs{};
+};
+
+// Serves BatchPricer over a Unix domain socket. One thread per connection reads
+// requests into a shared queue and a single dispatcher drains it in batches, so
+// concurrent requests from any connection for the same maturity are priced
+// together. The dispatcher hands responses to a writer thread per connection, so
+// a client that stops reading holds up only itself. Responses on a connection
+// come back in request order.
+class Server
+{
+  public:
+    Server() = delete;
+
+    // Binds the socket; clients can connect as soon as this returns.
+    Server(BatchPricer pricer, Config config);
+
+    Server(const Server&) = delete;
+    Server& operator=(const Server&) = delete;
+
+    ~Server();
+
+    void start();
+
+    // Stops accepting, closes every connection and joins all threads. Requests
+    // already queued are answered first, unless their client has stopped reading.
+    void stop();
+
+    LatencySummary latency() const;
+
+    const std::filesystem::path& socketPath() const noexcept;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Connection
+    {
+        detail::Socket socket;
+
+        std::mutex outboxMutex;
+        std::condition_variable outboxReady;
+        // Responses waiting for the writer, in request order.
+        std::deque<Response> outbox;
+        // Requests read off the socket whose responses are not yet written.
+        std::size_t inFlight{0};
+        bool readDone{false};
+        bool dropped{false};
+
+        // Set by the writer once it has finished with the connection.
+        std::atomic<bool> closed{false};
+    };
+
+    // The threads live beside their connection rather than inside it: a thread's
+    // own copy of the pointer may be the last one, and a connection that owned its
+    // threads would then be destroyed on, and try to join, that thread.
+    struct Session
+    {
+        std::shared_ptr<Connection> connection;
+        // Declared last so they are joined before the connection is released.
+        std::jthread reader;
+        std::jthread writer;
+    };
+
+    struct Pending
+    {
+        Request request;
+        std::shared_ptr<Connection> connection;
+        Clock::time_point received;
+    };
+
+    void acceptLoop();
+    void readLoop(const std::shared_ptr<Connection>& connection);
+    void writeLoop(const std::shared_ptr<Connection>& connection);
+    void dispatchLoop();
+    void deliver(Connection& connection, const Response& response);
+    // Gives up on a client: discards its queued responses and shuts the socket so
+    // both of its threads finish. Called with the connection's outbox mutex held.
+    static void drop(Connection& connection) noexcept;
+    void record(std::span<const Pending> batch, std::size_t pricingCalls);
+
+    BatchPricer pricer_;
+    Config config_;
+    detail::Socket listener_;
+
+    std::mutex queueMutex_;
+    std::condition_variable queueReady_;
+    std::deque<Pending> queue_;
+    bool stopping_{false};
+
+    std::mutex connectionsMutex_;
+    Vector<Session> sessions_;
+
+    mutable std::mutex statsMutex_;
+    Vector<double> latencyUs_;
+    std::size_t nextSample_{0};
+    LatencySummary totals_;
+
+    bool started_{false};
+    std::jthread dispatcher_;
+    std::jthread acceptor_;
+};
+} // namespace uv::service
@@ -5,9 +5,18 @@
 #include "Base/Config.hpp"
 #include "Base/Errors/Errors.hpp"
 #include "Base/Errors/Validate.hpp"
+#include "Base/Execution/Affinity.hpp"
+#include "Base/Execution/BoundedQueue.hpp"
+#include "Base/Execution/Executor.hpp"
+#include "Base/Execution/Parallel.hpp"
+#include "Base/Execution/Pipeline.hpp"
 #include "Base/Execution/ThreadPolicy.hpp"
 #include "Base/Types.hpp"
 #include "Base/Utils/ConsoleRedirect.hpp"
+#include "Base/Utils/CycleClock.hpp"
+#include "Base/Utils/Metrics.hpp"
+#include "Base/Utils/Profiler.hpp"
+#include "Base/Utils/RingBuffer.hpp"
 #include "Base/Utils/ScopedTimer.hpp"
 #include "Base/Utils/StopWatch.hpp"
 
@@ -16,9 +25,14 @@
 #include "Core/MarketData.hpp"
 #include "Core/MarketState.hpp"
 #include "Core/Matrix.hpp"
+#include "Core/QuoteUpdate.hpp"
 #include "Core/VolSurface.hpp"
 
+#include "IO/Binary/VolSurface.hpp"
 #include "IO/CSV/Load.hpp"
+#include "IO/CSV/Manifest.hpp"
+#include "IO/CSV/Ticks.hpp"
+#include "IO/CSV/Write.hpp"
 #include "IO/Console/Report.hpp"
 #include "IO/JSON/Read.hpp"
 
@@ -30,6 +44,7 @@
 #include "Optimization/NLopt/Algorithm.hpp"
 #include "Optimization/NLopt/Config.hpp"
 #include "Optimization/NLopt/Optimizer.hpp"
+#include "Optimization/Stop.hpp"
 
 #include "Math/Functions/Black.hpp"
 #include "Math/Functions/Primitive.hpp"
@@ -41,17 +56,37 @@
 #include "Math/LinearAlgebra/MatrixOps.hpp"
 #include "Math/LinearAlgebra/Tridiagonal.hpp"
 #include "Math/LinearAlgebra/VectorOps.hpp"
+#include "Math/PDE/Config.hpp"
+#include "Math/PDE/DeAmericanize.hpp"
+#include "Math/PDE/Dupire.hpp"
 #include "Math/PDE/Grid.hpp"
+#include "Math/PDE/Operator.hpp"
+#include "Math/PDE/Pricer.hpp"
+#include "Math/Random/Philox.hpp"
 
 #include "Models/SVI/BuildSurface.hpp"
 #include "Models/SVI/Calibrate/Calibrate.hpp"
 #include "Models/SVI/Calibrate/Config.hpp"
+#include "Models/SVI/LocalVol.hpp"
 #include "Models/SVI/Math.hpp"
 #include "Models/SVI/Params.hpp"
 
 #include "Models/Heston/BuildSurface.hpp"
 #include "Models/Heston/Calibrate/Calibrate.hpp"
 #include "Models/Heston/Calibrate/Config.hpp"
+#include "Models/Heston/MonteCarlo/Config.hpp"
+#include "Models/Heston/MonteCarlo/Pricer.hpp"
+#include "Models/Heston/PDE/Config.hpp"
+#include "Models/Heston/PDE/Pricer.hpp"
 #include "Models/Heston/Params.hpp"
 #include "Models/Heston/Price/Config.hpp"
 #include "Models/Heston/Price/Pricer.hpp"
+
+#include "Models/Intraday/Engine.hpp"
+
+#include "Models/Scenario/Engine.hpp"
+
+#include "Service/BatchPricer.hpp"
+#include "Service/Client.hpp"
+#include "Service/Protocol.hpp"
+#include "Service/Server.hpp"